@@ -61,6 +61,7 @@ class MPUnitsConan(ConanFile):
         "no_crtp": [True, False],
         "contracts": ["none", "std", "gsl-lite", "ms-gsl"],
         "freestanding": [True, False],
+        "bounds_audit": [True, False],
     }
     default_options = {
         # "cxx_modules" default set in config_options()
@@ -70,6 +71,7 @@ class MPUnitsConan(ConanFile):
         "import_std": False,  # still experimental in CMake
         "contracts": "gsl-lite",
         "freestanding": False,
+        "bounds_audit": False,
     }
     # third-party libraries exercised by the linear algebra integration example and tests. These are
     # never runtime requirements of mp-units: the integration headers are dependency-free (guarded
@@ -331,6 +333,7 @@ class MPUnitsConan(ConanFile):
             tc.cache_variables["MP_UNITS_API_STD_FORMAT"] = opt.std_format
         tc.cache_variables["MP_UNITS_API_NO_CRTP"] = opt.no_crtp
         tc.cache_variables["MP_UNITS_API_CONTRACTS"] = str(opt.contracts).upper()
+        tc.cache_variables["MP_UNITS_API_BOUNDS_AUDIT"] = opt.bounds_audit
 
         tc.generate()
         deps = CMakeDeps(self)
@@ -408,6 +411,9 @@ class MPUnitsConan(ConanFile):
             self.cpp_info.components["core"].defines.append(
                 "MP_UNITS_API_NO_CRTP=" + str(int(self.options.no_crtp == True))
             )
+            self.cpp_info.components["core"].defines.append(
+                "MP_UNITS_API_BOUNDS_AUDIT=" + str(int(self.options.bounds_audit == True))
+            )
 
             # handle hosted configuration
             if self.options.freestanding:
@@ -0,0 +1,140 @@
+// The MIT License (MIT)
+//
+// Copyright (c) 2018 Mateusz Pusz
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+#include "geodesy.h"
+#include "geographic.h"
+#include <mp-units/ext/format.h>
+#ifdef MP_UNITS_IMPORT_STD
+import std;
+#else
+#include <algorithm>
+#include <chrono>
+#include <cstddef>
+#include <iostream>
+#include <random>
+#include <span>
+#include <string_view>
+#include <vector>
+#endif
+#ifdef MP_UNITS_MODULES
+import mp_units;
+#else
+#include <mp-units/math.h>
+#include <mp-units/systems/isq/space_and_time.h>
+#include <mp-units/systems/si.h>
+#endif
+
+// Distances and initial bearings from one position to a million random positions: the scalar
+// `spherical_distance()` in a loop compared with the batch great-circle and Vincenty kernels.
+
+using namespace mp_units;
+using namespace mp_units::si::unit_symbols;
+using namespace geographic;
+
+namespace {
+
+inline constexpr std::size_t positions = 1'000'000;
+
+// the example of Vincenty's paper (Survey Review, 1975) as recomputed by Geoscience Australia
+bool check_flinders_peak_to_buninyong()
+{
+  const position<double> flinders_peak{-(37. + 57. / 60. + 3.72030 / 3600.) * geo_latitude[deg] + equator,
+                                       (144. + 25. / 60. + 29.52440 / 3600.) * geo_longitude[deg] + prime_meridian};
+  const position<double> buninyong{-(37. + 39. / 60. + 10.15610 / 3600.) * geo_latitude[deg] + equator,
+                                   (143. + 55. / 60. + 35.38390 / 3600.) * geo_longitude[deg] + prime_meridian};
+  const auto [distance, bearing] = vincenty_inverse(flinders_peak, buninyong, ulp_accuracy);
+  const quantity expected_bearing = (306. + 52. / 60. + 5.37 / 3600. - 360.) * deg;
+  std::cout << MP_UNITS_STD_FMT::format("Flinders Peak -> Buninyong: {::N[.3f]} ({})\n", distance.in(m), bearing);
+  return abs(distance - 54'972.271 * m) < 1. * mm &&
+         abs(isq::angular_measure(bearing.quantity_from(north_cw)) - expected_bearing) < 0.01 * deg / 3600;
+}
+
+template<typename F>
+double pairs_per_second(F f)
+{
+  const auto begin = std::chrono::steady_clock::now();
+  f();
+  return static_cast<double>(positions) /
+         std::chrono::duration<double>(std::chrono::steady_clock::now() - begin).count();
+}
+
+quantity<isq::distance[km]> max_diff(std::span<const geodesic_distance<>> a, std::span<const geodesic_distance<>> b)
+{
+  quantity result = isq::distance(0. * km);
+  for (std::size_t i = 0; i < a.size(); ++i) result = std::max(result, abs(a[i] - b[i]));
+  return result;
+}
+
+}  // namespace
+
+int main()
+{
+  if (!check_flinders_peak_to_buninyong()) return 1;
+
+  const position<double> origin{52.2 * geo_latitude[deg] + equator, 20.97 * geo_longitude[deg] + prime_meridian};
+  std::mt19937_64 gen(42);
+  std::uniform_real_distribution<double> lat(-89.9, 89.9);
+  std::uniform_real_distribution<double> lon(-180., 180.);
+  position_soa<double> targets;
+  targets.reserve(positions);
+  for (std::size_t i = 0; i < positions; ++i)
+    targets.push_back({lat(gen) * geo_latitude[deg] + equator, lon(gen) * geo_longitude[deg] + prime_meridian});
+  const position_span<double> to = targets.view();
+
+  std::vector<geodesic_distance<>> reference(positions), haversine(positions), haversine_fast(positions),
+    vincenty(positions), vincenty_fast(positions);
+  std::vector<bearing<>> bearings(positions);
+
+  std::cout << MP_UNITS_STD_FMT::format("\n{:<32} | {:>16} | {:>14}\n", "method", "[pairs/s]", "max diff");
+  const auto report = [](std::string_view method, double rate, quantity<isq::distance[km]> diff) {
+    std::cout << MP_UNITS_STD_FMT::format("{:<32} | {:>16.3e} | {::N[.1e]}\n", method, rate, diff.in(m));
+  };
+  const double reference_rate = pairs_per_second([&] {
+    for (std::size_t i = 0; i < positions; ++i) reference[i] = spherical_distance(origin, to[i]);
+  });
+  const double haversine_rate =
+    pairs_per_second([&] { haversine_distance(origin, to, std::span{haversine}, libm_accuracy); });
+  const double haversine_fast_rate =
+    pairs_per_second([&] { haversine_distance(origin, to, std::span{haversine_fast}); });
+  const double bearing_rate = pairs_per_second([&] { initial_bearing(origin, to, std::span{bearings}); });
+  const double vincenty_rate =
+    pairs_per_second([&] { vincenty_distance(origin, to, std::span{vincenty}, ulp_accuracy); });
+  const double vincenty_fast_rate =
+    pairs_per_second([&] { vincenty_distance(origin, to, std::span{vincenty_fast}); });
+
+  const auto zero = isq::distance(0. * km);
+  report("spherical_distance() loop", reference_rate, zero);
+  report("haversine_distance, libm", haversine_rate, max_diff(haversine, reference));
+  report("haversine_distance, fast", haversine_fast_rate, max_diff(haversine_fast, haversine));
+  report("initial_bearing, fast", bearing_rate, zero);
+  report("vincenty_distance, ulp", vincenty_rate, zero);
+  report("vincenty_distance, fast", vincenty_fast_rate, max_diff(vincenty_fast, vincenty));
+
+  // the haversine formula agrees with the law of cosines, and the fast kernels with the accurate
+  // ones, except for the haversine formula of nearly antipodal positions, which amplifies any
+  // error of its sines
+  if (max_diff(haversine, reference) > 1. * m || max_diff(vincenty_fast, vincenty) > 1. * m) return 1;
+  for (std::size_t i = 0; i < positions; ++i)
+    if (haversine[i] < 19'000. * km && abs(haversine_fast[i] - haversine[i]) > 1. * m) return 1;
+  // the sphere differs from the ellipsoid by less than 0.6 %
+  for (std::size_t i = 0; i < positions; ++i)
+    if (abs(vincenty[i] - haversine[i]) > 0.006 * vincenty[i]) return 1;
+}
@@ -0,0 +1,389 @@
+// The MIT License (MIT)
+//
+// Copyright (c) 2018 Mateusz Pusz
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+#pragma once
+
+#include <mp-units/compat_macros.h>
+//
+#include "geographic.h"
+#include <cassert>
+#ifdef MP_UNITS_IMPORT_STD
+import std;
+#else
+#include <algorithm>
+#include <cmath>
+#include <concepts>
+#include <cstddef>
+#include <limits>
+#include <span>
+#include <vector>
+#endif
+#ifdef MP_UNITS_MODULES
+import mp_units;
+#else
+#include <mp-units/framework.h>
+#include <mp-units/math.h>
+#include <mp-units/systems/isq/space_and_time.h>
+#include <mp-units/systems/si.h>
+#endif
+
+// Great-circle and ellipsoidal distances and initial bearings between geographic positions,
+// computed one pair at a time or in batches over structure-of-arrays spans of positions.
+//
+// The batch forms work on spans of latitudes and longitudes, which hold just the numerical values
+// in degrees. The trigonometry goes through the accuracy-tiered `sin`, `cos`, `sincos`, and
+// `atan2` of mp-units that reduce the angles exactly in degrees. By default, all the functions use
+// `fast_accuracy`, which keeps the loops free of branches, so that the compiler can vectorize them
+// (GCC needs `-fno-math-errno` for `std::sqrt`, and SSE4.1 or AVX2 for the rounding in the angle
+// reduction); pass `ulp_accuracy` or `libm_accuracy` as the last argument for more accurate results.
+
+namespace geographic {
+
+// the radius of the sphere used by the great-circle formulas
+inline constexpr mp_units::quantity earth_mean_radius =
+  6'371. * mp_units::isq::radius[mp_units::si::kilo<mp_units::si::metre>];
+
+// the ellipsoid used by the Vincenty formulas
+namespace wgs84 {
+
+inline constexpr mp_units::quantity semi_major_axis = 6'378'137. * mp_units::isq::radius[mp_units::si::metre];
+inline constexpr double flattening = 1 / 298.257223563;
+
+}  // namespace wgs84
+
+// latitudes and longitudes of many positions stored in separate contiguous arrays
+template<typename T = double>
+struct position_span {
+  std::span<const latitude<T>> lat;
+  std::span<const longitude<T>> lon;
+
+  [[nodiscard]] constexpr std::size_t size() const { return lat.size(); }
+  [[nodiscard]] constexpr position<T> operator[](std::size_t i) const { return {lat[i], lon[i]}; }
+};
+
+// an owning structure-of-arrays container of positions
+template<typename T = double>
+class position_soa {
+public:
+  position_soa() = default;
+  explicit position_soa(std::span<const position<T>> positions)
+  {
+    reserve(positions.size());
+    for (const position<T>& p : positions) push_back(p);
+  }
+
+  void reserve(std::size_t n)
+  {
+    lat_.reserve(n);
+    lon_.reserve(n);
+  }
+  void push_back(position<T> p)
+  {
+    lat_.push_back(p.lat);
+    lon_.push_back(p.lon);
+  }
+
+  [[nodiscard]] std::size_t size() const { return lat_.size(); }
+  [[nodiscard]] position<T> operator[](std::size_t i) const { return {lat_[i], lon_[i]}; }
+  [[nodiscard]] position_span<T> view() const { return {lat_, lon_}; }
+
+private:
+  std::vector<latitude<T>> lat_;
+  std::vector<longitude<T>> lon_;
+};
+
+template<typename T = double>
+using geodesic_distance = mp_units::quantity<mp_units::isq::distance[mp_units::si::kilo<mp_units::si::metre>], T>;
+
+namespace detail {
+
+// `from` is either one position that is paired with all the positions in `to` or a span of
+// positions paired with the positions in `to` at the same index
+template<typename T>
+[[nodiscard]] constexpr latitude<T> lat_at(position<T> from, std::size_t) { return from.lat; }
+template<typename T>
+[[nodiscard]] constexpr latitude<T> lat_at(position_span<T> from, std::size_t i) { return from.lat[i]; }
+template<typename T>
+[[nodiscard]] constexpr longitude<T> lon_at(position<T> from, std::size_t) { return from.lon; }
+template<typename T>
+[[nodiscard]] constexpr longitude<T> lon_at(position_span<T> from, std::size_t i) { return from.lon[i]; }
+
+template<typename T>
+[[nodiscard]] constexpr mp_units::quantity<mp_units::isq::angular_measure[mp_units::si::degree], T> angle(
+  latitude<T> lat)
+{
+  return mp_units::isq::angular_measure(lat.quantity_ref_from(equator));
+}
+
+// the great-circle distance between two positions given by the haversine formula
+template<typename T, mp_units::MathAccuracy Accuracy>
+MP_UNITS_ALWAYS_INLINE [[nodiscard]] inline geodesic_distance<T> haversine(latitude<T> lat1, longitude<T> lon1,
+                                                                         latitude<T> lat2, longitude<T> lon2,
+                                                                         Accuracy acc)
+{
+  using namespace mp_units;
+  using si::sin, si::cos, si::atan2;
+
+  const quantity phi1 = angle(lat1);
+  const quantity phi2 = angle(lat2);
+  const quantity delta_lambda = isq::angular_measure(lon2 - lon1);
+  const T sin_half_phi = sin((phi2 - phi1) / T{2}, acc).numerical_value_in(one);
+  const T sin_half_lambda = sin(delta_lambda / T{2}, acc).numerical_value_in(one);
+  const T a = sin_half_phi * sin_half_phi +
+              cos(phi1, acc).numerical_value_in(one) * cos(phi2, acc).numerical_value_in(one) * sin_half_lambda *
+                sin_half_lambda;
+  // rounding may take `a` slightly out of [0, 1]; unlike clamping, `abs` keeps the loop vectorizable
+  const T central_angle =
+    T{2} * atan2(std::sqrt(std::abs(a)) * one, std::sqrt(std::abs(1 - a)) * one, acc).numerical_value_in(si::radian);
+  constexpr T radius = static_cast<T>(earth_mean_radius.numerical_value_in(si::kilo<si::metre>));
+  return geodesic_distance<T>(isq::distance(radius * central_angle * si::kilo<si::metre>));
+}
+
+// the initial bearing of the great circle from the first to the second position, measured from
+// `north_cw` (the bounds of `north_cw` are applied once the bearings of a block are computed, so
+// that the loop computing them stays free of branches)
+template<typename T, mp_units::MathAccuracy Accuracy>
+MP_UNITS_ALWAYS_INLINE [[nodiscard]] inline mp_units::quantity<geo_bearing[mp_units::si::degree], T>
+great_circle_bearing(latitude<T> lat1, longitude<T> lon1, latitude<T> lat2, longitude<T> lon2, Accuracy acc)
+{
+  using namespace mp_units;
+  using si::sincos, si::atan2;
+
+  const auto [sin_phi1, cos_phi1] = sincos(angle(lat1), acc);
+  const auto [sin_phi2, cos_phi2] = sincos(angle(lat2), acc);
+  const auto [sin_lambda, cos_lambda] = sincos(isq::angular_measure(lon2 - lon1), acc);
+  return geo_bearing(
+    atan2(sin_lambda * cos_phi2, cos_phi1 * sin_phi2 - sin_phi1 * cos_phi2 * cos_lambda, acc).in(si::degree));
+}
+
+// the number of position pairs that the batch kernels stage their results for
+inline constexpr std::size_t batch_block = 64;
+
+// calls `f(first, count)` for the consecutive blocks of at most `batch_block` elements of [0, n)
+template<typename F>
+void for_each_block(std::size_t n, F f)
+{
+  for (std::size_t first = 0; first < n; first += batch_block) f(first, std::min(batch_block, n - first));
+}
+
+// Solves the inverse geodesic problem on the WGS 84 ellipsoid with the Vincenty formulas for the
+// pairs [first, first + count) and calls `out(i, distance, bearing)` for each of them.
+//
+// All the pairs of a block iterate together until the longitude on the auxiliary sphere
+// converges for all of them, which keeps every step a branch-free loop over the block.
+template<typename T, typename From, mp_units::MathAccuracy Accuracy, typename Out>
+void vincenty(const From& from, position_span<T> to, std::size_t first, std::size_t count, Accuracy acc, Out out)
+{
+  using namespace mp_units;
+  using si::sincos, si::atan2;
+
+  constexpr T f = static_cast<T>(wgs84::flattening);
+  constexpr T a = static_cast<T>(wgs84::semi_major_axis.numerical_value_in(si::metre));
+  constexpr T b = a * (1 - f);
+  // about 0.1 mm on the Earth's surface for `double`, and the best achievable for `float`
+  constexpr T tolerance = sizeof(T) >= 8 ? T(1e-11) : T(1e-6);
+  constexpr int max_iterations = 100;
+
+  T big_l[batch_block], sin_u1[batch_block], cos_u1[batch_block], sin_u2[batch_block],
+    cos_u2[batch_block], lambda[batch_block], sin_lambda[batch_block], cos_lambda[batch_block],
+    sin_sigma[batch_block], cos_sigma[batch_block], sigma[batch_block], cos2_alpha[batch_block],
+    cos_2sigma_m[batch_block];
+  geodesic_distance<T> distance[batch_block];
+  quantity<geo_bearing[si::degree], T> alpha1[batch_block];
+
+  // the reduced latitudes: tan U = (1 - f) tan φ, written without the tangents so that the poles
+  // need no special handling
+  const auto reduced = [&](latitude<T> lat, T& sin_u, T& cos_u) {
+    const auto [s, c] = sincos(angle(lat), acc);
+    const T sin_phi = (1 - f) * s.numerical_value_in(one);
+    const T cos_phi = c.numerical_value_in(one);
+    const T norm = 1 / std::sqrt(sin_phi * sin_phi + cos_phi * cos_phi);
+    sin_u = sin_phi * norm;
+    cos_u = cos_phi * norm;
+  };
+  for (std::size_t k = 0; k < count; ++k) {
+    const std::size_t i = first + k;
+    reduced(lat_at(from, i), sin_u1[k], cos_u1[k]);
+    reduced(to.lat[i], sin_u2[k], cos_u2[k]);
+    big_l[k] = isq::angular_measure(to.lon[i] - lon_at(from, i)).numerical_value_in(si::radian);
+    lambda[k] = big_l[k];
+  }
+
+  for (int iteration = 0; iteration < max_iterations; ++iteration) {
+    // counted rather than taking the largest change, which would not vectorize
+    std::size_t pending = 0;
+    for (std::size_t k = 0; k < count; ++k) {
+      const auto [sl, cl] = sincos(lambda[k] * si::radian, acc);
+      sin_lambda[k] = sl.numerical_value_in(one);
+      cos_lambda[k] = cl.numerical_value_in(one);
+      const T y = cos_u2[k] * sin_lambda[k];
+      const T x = cos_u1[k] * sin_u2[k] - sin_u1[k] * cos_u2[k] * cos_lambda[k];
+      sin_sigma[k] = std::sqrt(y * y + x * x);
+      cos_sigma[k] = sin_u1[k] * sin_u2[k] + cos_u1[k] * cos_u2[k] * cos_lambda[k];
+      sigma[k] = atan2(sin_sigma[k] * one, cos_sigma[k] * one, acc).numerical_value_in(si::radian);
+      // Coincident positions (σ = 0) have zero numerators here, and so do equatorial lines
+      // (cos²α = 0), whose `cos_2sigma_m` is then multiplied by zero. Keeping the divisors away
+      // from zero gives these cases without branches (`abs` only undoes rounding below zero).
+      constexpr T floor = std::numeric_limits<T>::epsilon();
+      const T sin_alpha = cos_u1[k] * cos_u2[k] * sin_lambda[k] / std::max(sin_sigma[k], floor);
+      cos2_alpha[k] = std::abs(1 - sin_alpha * sin_alpha);
+      cos_2sigma_m[k] = cos_sigma[k] - 2 * sin_u1[k] * sin_u2[k] / std::max(cos2_alpha[k], floor);
+      const T c = f / 16 * cos2_alpha[k] * (4 + f * (4 - 3 * cos2_alpha[k]));
+      const T next = big_l[k] + (1 - c) * f * sin_alpha *
+                                  (sigma[k] + c * sin_sigma[k] *
+                                                (cos_2sigma_m[k] +
+                                                 c * cos_sigma[k] * (-1 + 2 * cos_2sigma_m[k] * cos_2sigma_m[k])));
+      pending += std::abs(next - lambda[k]) > tolerance;
+      lambda[k] = next;
+    }
+    if (pending == 0) break;
+  }
+
+  for (std::size_t k = 0; k < count; ++k) {
+    const T u2 = cos2_alpha[k] * (a * a - b * b) / (b * b);
+    const T big_a = 1 + u2 / 16384 * (4096 + u2 * (-768 + u2 * (320 - 175 * u2)));
+    const T big_b = u2 / 1024 * (256 + u2 * (-128 + u2 * (74 - 47 * u2)));
+    const T c2sm = cos_2sigma_m[k];
+    const T delta_sigma =
+      big_b * sin_sigma[k] *
+      (c2sm + big_b / 4 *
+                (cos_sigma[k] * (-1 + 2 * c2sm * c2sm) -
+                 big_b / 6 * c2sm * (-3 + 4 * sin_sigma[k] * sin_sigma[k]) * (-3 + 4 * c2sm * c2sm)));
+    distance[k] = isq::distance(b * big_a * (sigma[k] - delta_sigma) * si::metre);
+    alpha1[k] = geo_bearing(atan2(cos_u2[k] * sin_lambda[k] * one,
+                                  (cos_u1[k] * sin_u2[k] - sin_u1[k] * cos_u2[k] * cos_lambda[k]) * one, acc)
+                              .in(si::degree));
+  }
+  for (std::size_t k = 0; k < count; ++k) out(first + k, distance[k], north_cw + alpha1[k]);
+}
+
+template<typename T, typename From, mp_units::MathAccuracy Accuracy, typename Out>
+void vincenty(const From& from, position_span<T> to, Accuracy acc, Out out)
+{
+  for_each_block(to.size(), [&](std::size_t first, std::size_t count) { vincenty(from, to, first, count, acc, out); });
+}
+
+}  // namespace detail
+
+// The great-circle distance on the sphere of `earth_mean_radius` given by the haversine formula.
+// With the default `fast_accuracy`, it stays within about 0.5 m of the `libm_accuracy` result for
+// positions more than 1000 km away from being antipodal; closer to the antipode, the formula
+// amplifies the errors of the sines to a few metres, about 40 m within 100 km, and hundreds of
+// metres within 10 km.
+template<typename T, mp_units::MathAccuracy Accuracy = mp_units::fast_accuracy_t>
+[[nodiscard]] geodesic_distance<T> haversine_distance(position<T> from, position<T> to, Accuracy acc = Accuracy{})
+{
+  return detail::haversine(from.lat, from.lon, to.lat, to.lon, acc);
+}
+
+// the haversine distances from `from` to all the positions in `to`, or between the positions at
+// the same index of `from` and `to` when `from` is a span
+template<typename T, typename From, mp_units::MathAccuracy Accuracy = mp_units::fast_accuracy_t>
+  requires std::same_as<From, position<T>> || std::same_as<From, position_span<T>>
+void haversine_distance(const From& from, position_span<T> to, std::span<geodesic_distance<T>> out,
+                        Accuracy acc = Accuracy{})
+{
+  if constexpr (std::same_as<From, position_span<T>>) assert(from.size() == to.size());
+  assert(to.size() <= out.size());
+  for (std::size_t i = 0; i < to.size(); ++i)
+    out[i] = detail::haversine(detail::lat_at(from, i), detail::lon_at(from, i), to.lat[i], to.lon[i], acc);
+}
+
+// the initial bearing of the great circle from `from` to `to`
+template<typename T, mp_units::MathAccuracy Accuracy = mp_units::fast_accuracy_t>
+[[nodiscard]] bearing<T> initial_bearing(position<T> from, position<T> to, Accuracy acc = Accuracy{})
+{
+  return north_cw + detail::great_circle_bearing(from.lat, from.lon, to.lat, to.lon, acc);
+}
+
+// the great-circle initial bearings from `from` to all the positions in `to`, or between the
+// positions at the same index of `from` and `to` when `from` is a span
+template<typename T, typename From, mp_units::MathAccuracy Accuracy = mp_units::fast_accuracy_t>
+  requires std::same_as<From, position<T>> || std::same_as<From, position_span<T>>
+void initial_bearing(const From& from, position_span<T> to, std::span<bearing<T>> out, Accuracy acc = Accuracy{})
+{
+  if constexpr (std::same_as<From, position_span<T>>) assert(from.size() == to.size());
+  assert(to.size() <= out.size());
+  detail::for_each_block(to.size(), [&](std::size_t first, std::size_t count) {
+    mp_units::quantity<geo_bearing[mp_units::si::degree], T> theta[detail::batch_block];
+    for (std::size_t k = 0; k < count; ++k) {
+      const std::size_t i = first + k;
+      theta[k] = detail::great_circle_bearing(detail::lat_at(from, i), detail::lon_at(from, i), to.lat[i], to.lon[i],
+                                              acc);
+    }
+    for (std::size_t k = 0; k < count; ++k) out[first + k] = north_cw + theta[k];
+  });
+}
+
+// the distance and the initial bearing along the geodesic on the WGS 84 ellipsoid
+template<typename T = double>
+struct geodesic {
+  geodesic_distance<T> distance;
+  bearing<T> initial_bearing;
+};
+
+// The solution of the inverse geodesic problem on the WGS 84 ellipsoid given by the Vincenty
+// formulas. With `ulp_accuracy` or `libm_accuracy`, the distance is accurate to a fraction of a
+// millimetre; the default `fast_accuracy` trades that for vectorized trigonometry and deviates from
+// it by up to about 10 cm. The iteration does not converge for nearly antipodal positions, which
+// then get only an approximate result.
+template<typename T, mp_units::MathAccuracy Accuracy = mp_units::fast_accuracy_t>
+[[nodiscard]] geodesic<T> vincenty_inverse(position<T> from, position<T> to, Accuracy acc = Accuracy{})
+{
+  geodesic<T> result{};
+  detail::vincenty(from, position_span<T>{std::span{&to.lat, 1}, std::span{&to.lon, 1}}, 0, 1, acc,
+                   [&](std::size_t, geodesic_distance<T> d, bearing<T> brg) { result = {d, brg}; });
+  return result;
+}
+
+template<typename T, mp_units::MathAccuracy Accuracy = mp_units::fast_accuracy_t>
+[[nodiscard]] geodesic_distance<T> vincenty_distance(position<T> from, position<T> to, Accuracy acc = Accuracy{})
+{
+  return vincenty_inverse(from, to, acc).distance;
+}
+
+// the Vincenty distances from `from` to all the positions in `to`, or between the positions at the
+// same index of `from` and `to` when `from` is a span
+template<typename T, typename From, mp_units::MathAccuracy Accuracy = mp_units::fast_accuracy_t>
+  requires std::same_as<From, position<T>> || std::same_as<From, position_span<T>>
+void vincenty_distance(const From& from, position_span<T> to, std::span<geodesic_distance<T>> out,
+                       Accuracy acc = Accuracy{})
+{
+  if constexpr (std::same_as<From, position_span<T>>) assert(from.size() == to.size());
+  assert(to.size() <= out.size());
+  detail::vincenty(from, to, acc, [&](std::size_t i, geodesic_distance<T> d, bearing<T>) { out[i] = d; });
+}
+
+// the Vincenty distances and initial bearings, see `vincenty_distance()`
+template<typename T, typename From, mp_units::MathAccuracy Accuracy = mp_units::fast_accuracy_t>
+  requires std::same_as<From, position<T>> || std::same_as<From, position_span<T>>
+void vincenty_inverse(const From& from, position_span<T> to, std::span<geodesic_distance<T>> distances,
+                      std::span<bearing<T>> bearings, Accuracy acc = Accuracy{})
+{
+  if constexpr (std::same_as<From, position_span<T>>) assert(from.size() == to.size());
+  assert(to.size() <= distances.size() && to.size() <= bearings.size());
+  detail::vincenty(from, to, acc, [&](std::size_t i, geodesic_distance<T> d, bearing<T> brg) {
+    distances[i] = d;
+    bearings[i] = brg;
+  });
+}
+
+}  // namespace geographic
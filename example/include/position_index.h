@@ -0,0 +1,281 @@
+// The MIT License (MIT)
+//
+// Copyright (c) 2018 Mateusz Pusz
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+#pragma once
+
+#include <mp-units/compat_macros.h>
+//
+#include "geodesy.h"
+#include "geographic.h"
+#include <cassert>
+#ifdef MP_UNITS_IMPORT_STD
+import std;
+#else
+#include <algorithm>
+#include <array>
+#include <cmath>
+#include <cstddef>
+#include <cstdint>
+#include <limits>
+#include <numbers>
+#include <numeric>
+#include <span>
+#include <utility>
+#include <vector>
+#endif
+#ifdef MP_UNITS_MODULES
+import mp_units;
+#else
+#include <mp-units/framework.h>
+#include <mp-units/math.h>
+#include <mp-units/systems/isq/space_and_time.h>
+#include <mp-units/systems/si.h>
+#endif
+
+// A static spatial index of geographic positions answering the nearest-neighbour and radius
+// queries in logarithmic time.
+//
+// The positions are mapped to unit vectors, so that the tree needs no special handling of the
+// antimeridian and the poles: the chord between two unit vectors grows monotonically with the
+// great-circle distance, so the nearest positions by chord are also the nearest ones on the
+// sphere, and a great-circle radius maps to a chord length.
+//
+// The index is a balanced k-d tree over the unit vectors with an implicit layout. Each split halves
+// the range of positions, so the ranges of the nodes follow from their depth and need not be
+// stored. The split planes are stored breadth-first in one array, which keeps the top levels of
+// the tree visited by every query in a few cache lines, and the unit vectors are stored in the tree
+// order as a structure of arrays, which makes each leaf a short contiguous scan.
+
+namespace geographic {
+
+// a position found in `position_index` and its great-circle distance from the queried position
+template<typename T = double>
+struct neighbour {
+  std::size_t index;  // in the span the index was built from
+  geodesic_distance<T> distance;
+};
+
+template<typename T = double>
+class position_index {
+public:
+  // the largest number of positions in a leaf of the tree
+  static constexpr std::size_t leaf_size = 32;
+
+  position_index() = default;
+
+  // builds the index of the positions; the results of the queries refer to them by their index in
+  // `positions`
+  explicit position_index(position_span<T> positions) : size_(positions.size())
+  {
+    assert(size_ <= std::numeric_limits<std::uint32_t>::max());
+    // the left half gets the middle element, so the leftmost leaf is the largest one
+    for (std::size_t largest = size_; largest > leaf_size; largest = (largest + 1) / 2) ++depth_;
+
+    // the unit vectors in the input order
+    std::array<std::vector<T>, 3> unit;
+    for (auto& u : unit) u.resize(size_);
+    for (std::size_t i = 0; i < size_; ++i) {
+      const auto [x, y, z] = to_unit_vector(positions.lat[i], positions.lon[i]);
+      unit[0][i] = x;
+      unit[1][i] = y;
+      unit[2][i] = z;
+    }
+
+    index_.resize(size_);
+    std::iota(index_.begin(), index_.end(), std::uint32_t{0});
+    split_.resize((std::size_t{1} << depth_) - 1);
+    build(unit, 0, 0, size_, 0);
+
+    for (std::size_t d = 0; d < 3; ++d) {
+      coord_[d].resize(size_);
+      for (std::size_t i = 0; i < size_; ++i) coord_[d][i] = unit[d][index_[i]];
+    }
+  }
+
+  [[nodiscard]] std::size_t size() const { return size_; }
+  [[nodiscard]] bool empty() const { return size_ == 0; }
+
+  // the indexed position nearest to `p`
+  [[nodiscard]] neighbour<T> nearest(position<T> p) const
+  {
+    assert(!empty());
+    neighbour<T> result{};
+    nearest(p, std::span{&result, 1});
+    return result;
+  }
+
+  // the `out.size()` indexed positions nearest to `p` ordered by distance; returns the part of
+  // `out` that was filled, which is shorter only when there are fewer positions in the index
+  std::span<neighbour<T>> nearest(position<T> p, std::span<neighbour<T>> out) const
+  {
+    const std::size_t k = std::min(out.size(), size_);
+    if (k == 0) return out.first(0);
+
+    // the best candidates so far ordered by their squared chords
+    std::vector<std::pair<T, std::uint32_t>> best;
+    best.reserve(k);
+    const auto worst = [&] { return best.size() < k ? std::numeric_limits<T>::infinity() : best.back().first; };
+    search(to_unit_vector(p.lat, p.lon), worst, [&](T chord2, std::uint32_t slot) {
+      if (best.size() == k) best.pop_back();
+      best.insert(std::ranges::upper_bound(best, chord2, {}, &std::pair<T, std::uint32_t>::first), {chord2, slot});
+    });
+
+    for (std::size_t i = 0; i < k; ++i) out[i] = {index_[best[i].second], to_distance(best[i].first)};
+    return out.first(k);
+  }
+
+  // all the indexed positions within `radius` of `p` ordered by distance; `radius` has to be
+  // non-negative
+  template<mp_units::QuantityOf<mp_units::isq::distance> Q>
+  [[nodiscard]] std::vector<neighbour<T>> within(position<T> p, Q radius) const
+  {
+    assert(radius >= Q::zero());
+    std::vector<neighbour<T>> result;
+    const T chord2 = to_chord2(geodesic_distance<T>(mp_units::value_cast<T>(radius)));
+    search(to_unit_vector(p.lat, p.lon), [&] { return chord2; },
+           [&](T d2, std::uint32_t slot) { result.push_back({index_[slot], to_distance(d2)}); });
+    std::ranges::sort(result, {}, [](const neighbour<T>& n) { return n.distance; });
+    return result;
+  }
+
+private:
+  struct split_plane {
+    T value;
+    std::uint8_t axis;
+  };
+
+  std::size_t size_ = 0;
+  std::size_t depth_ = 0;
+  std::vector<split_plane> split_;       // breadth-first: the children of node i are 2i+1 and 2i+2
+  std::vector<std::uint32_t> index_;     // the input index of each position in the tree order
+  std::array<std::vector<T>, 3> coord_;  // the unit vectors in the tree order
+
+  // each split puts the lower half of the range of a node, rounded up, on the left
+  [[nodiscard]] static constexpr std::size_t middle(std::size_t begin, std::size_t end)
+  {
+    return begin + (end - begin + 1) / 2;
+  }
+
+  [[nodiscard]] static std::array<T, 3> to_unit_vector(latitude<T> lat, longitude<T> lon)
+  {
+    using namespace mp_units;
+    const auto [sin_phi, cos_phi] = si::sincos(isq::angular_measure(lat.quantity_ref_from(equator)), ulp_accuracy);
+    const auto [sin_lambda, cos_lambda] =
+      si::sincos(isq::angular_measure(lon.quantity_ref_from(prime_meridian)), ulp_accuracy);
+    return {(cos_phi * cos_lambda).numerical_value_in(one), (cos_phi * sin_lambda).numerical_value_in(one),
+            sin_phi.numerical_value_in(one)};
+  }
+
+  // the squared chord of a great-circle distance and back
+  [[nodiscard]] static T to_chord2(geodesic_distance<T> d)
+  {
+    const T half_angle = d.numerical_value_in(mp_units::si::kilo<mp_units::si::metre>) / (2 * radius_km);
+    // a radius beyond the antipode covers the whole sphere
+    if (half_angle >= std::numbers::pi_v<T> / 2) return std::numeric_limits<T>::infinity();
+    const T half_chord = std::sin(half_angle);
+    return 4 * half_chord * half_chord;
+  }
+  [[nodiscard]] static geodesic_distance<T> to_distance(T chord2)
+  {
+    const T half_angle = std::asin(std::min(T{1}, std::sqrt(chord2) / 2));
+    return geodesic_distance<T>(mp_units::isq::distance(2 * radius_km * half_angle *
+                                                        mp_units::si::kilo<mp_units::si::metre>));
+  }
+  static constexpr T radius_km =
+    static_cast<T>(earth_mean_radius.numerical_value_in(mp_units::si::kilo<mp_units::si::metre>));
+
+  void build(std::array<std::vector<T>, 3>& unit, std::size_t node, std::size_t begin, std::size_t end,
+             std::size_t level)
+  {
+    if (level == depth_) return;
+
+    // split across the axis of the largest extent of the range
+    std::array<T, 3> extent{};
+    for (std::size_t d = 0; d < 3; ++d) {
+      const auto [lo, hi] =
+        std::ranges::minmax(std::span{index_}.subspan(begin, end - begin), {}, [&](std::uint32_t i) {
+          return unit[d][i];
+        });
+      extent[d] = unit[d][hi] - unit[d][lo];
+    }
+    const auto axis = static_cast<std::uint8_t>(std::ranges::max_element(extent) - extent.begin());
+    const std::size_t mid = middle(begin, end);
+    const auto by_axis = [&](std::uint32_t i) { return unit[axis][i]; };
+    std::ranges::nth_element(index_.begin() + static_cast<std::ptrdiff_t>(begin),
+                             index_.begin() + static_cast<std::ptrdiff_t>(mid),
+                             index_.begin() + static_cast<std::ptrdiff_t>(end), {}, by_axis);
+    split_[node] = {unit[axis][index_[mid]], axis};
+
+    build(unit, 2 * node + 1, begin, mid, level + 1);
+    build(unit, 2 * node + 2, mid, end, level + 1);
+  }
+
+  // Visits the leaves that may hold positions not farther from `q` than `worst()` (a squared
+  // chord), the nearer ones first, and calls `found(chord2, slot)` for each such position.
+  template<typename Worst, typename Found>
+  void search(const std::array<T, 3>& q, Worst worst, Found found) const
+  {
+    struct pending {
+      std::size_t node, begin, end, level;
+      T bound;  // a lower bound of the squared chord to any position of the node
+    };
+    // each level adds at most one node to the stack, and there are at most 32 levels
+    pending stack[64];
+    std::size_t top = 0;
+    stack[top++] = {0, 0, size_, 0, T{0}};
+
+    while (top > 0) {
+      const pending n = stack[--top];
+      if (n.bound > worst()) continue;
+
+      if (n.level == depth_) {
+        // the squared chords of the whole leaf first, which the compiler vectorizes
+        T chord2[leaf_size];
+        const std::size_t count = n.end - n.begin;
+        for (std::size_t i = 0; i < count; ++i) {
+          const T dx = coord_[0][n.begin + i] - q[0];
+          const T dy = coord_[1][n.begin + i] - q[1];
+          const T dz = coord_[2][n.begin + i] - q[2];
+          chord2[i] = dx * dx + dy * dy + dz * dz;
+        }
+        for (std::size_t i = 0; i < count; ++i)
+          if (chord2[i] <= worst()) found(chord2[i], static_cast<std::uint32_t>(n.begin + i));
+        continue;
+      }
+
+      const split_plane s = split_[n.node];
+      const T diff = q[s.axis] - s.value;
+      const std::size_t mid = middle(n.begin, n.end);
+      const pending left{2 * n.node + 1, n.begin, mid, n.level + 1, n.bound};
+      const pending right{2 * n.node + 2, mid, n.end, n.level + 1, n.bound};
+      // the far side is at least as far as the split plane; the near side is visited first
+      if (diff < 0) {
+        stack[top++] = {right.node, right.begin, right.end, right.level, std::max(n.bound, diff * diff)};
+        stack[top++] = left;
+      } else {
+        stack[top++] = {left.node, left.begin, left.end, left.level, std::max(n.bound, diff * diff)};
+        stack[top++] = right;
+      }
+    }
+  }
+};
+
+}  // namespace geographic
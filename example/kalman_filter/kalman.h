@@ -28,8 +28,15 @@
 import std;
 #else
 #include <algorithm>
+#include <array>
+#include <cmath>
+#include <concepts>
+#include <cstddef>
+#include <functional>
 #include <locale>
 #include <tuple>
+#include <type_traits>
+#include <utility>
 #endif
 #ifdef MP_UNITS_MODULES
 import mp_units;
@@ -39,6 +46,7 @@ import mp_units;
 #include <mp-units/framework/quantity_point.h>
 #include <mp-units/math.h>
 #include <mp-units/systems/isq/base_quantities.h>
+#include <mp-units/utility/dimensioned_matrix.h>
 #endif
 
 namespace kalman {
@@ -59,7 +67,7 @@ constexpr bool are_time_derivatives<D1, D2, Ds...> =
 
 // system state
 template<mp_units::QuantityPoint... QPs>
-  requires(sizeof...(QPs) > 0) && (sizeof...(QPs) <= 3) && detail::are_time_derivatives<QPs::dimension...>
+  requires(sizeof...(QPs) > 0)
 class system_state {
   std::tuple<QPs...> variables_;
 public:
@@ -124,7 +132,8 @@ template<typename QP, mp_units::QuantityPoint QM, mp_units::QuantityOf<mp_units:
 
 template<typename QP1, typename QP2, mp_units::QuantityPoint QM, mp_units::QuantityOf<mp_units::dimensionless> K,
          mp_units::QuantityOf<mp_units::isq::duration> T>
-  requires(implicitly_convertible(QM::quantity_spec, QP1::quantity_spec))
+  requires(implicitly_convertible(QM::quantity_spec, QP1::quantity_spec)) &&
+          detail::are_time_derivatives<QP1::dimension, QP2::dimension>
 [[nodiscard]] constexpr system_state<QP1, QP2> state_update(const system_state<QP1, QP2>& predicted, QM measured,
                                                             std::array<K, 2> gain, T interval)
 {
@@ -135,7 +144,8 @@ template<typename QP1, typename QP2, mp_units::QuantityPoint QM, mp_units::Quant
 
 template<typename QP1, typename QP2, typename QP3, mp_units::QuantityPoint QM,
          mp_units::QuantityOf<mp_units::dimensionless> K, mp_units::QuantityOf<mp_units::isq::duration> T>
-  requires(implicitly_convertible(QM::quantity_spec, QP1::quantity_spec))
+  requires(implicitly_convertible(QM::quantity_spec, QP1::quantity_spec)) &&
+          detail::are_time_derivatives<QP1::dimension, QP2::dimension, QP3::dimension>
 [[nodiscard]] constexpr system_state<QP1, QP2, QP3> state_update(const system_state<QP1, QP2, QP3>& predicted,
                                                                  QM measured, std::array<K, 3> gain, T interval)
 {
@@ -162,6 +172,7 @@ template<mp_units::QuantityPoint... QPs, mp_units::QuantityPoint QP, mp_units::Q
 
 // state extrapolation
 template<typename QP1, typename QP2, mp_units::QuantityOf<mp_units::isq::duration> T>
+  requires detail::are_time_derivatives<QP1::dimension, QP2::dimension>
 [[nodiscard]] constexpr system_state<QP1, QP2> state_extrapolation(const system_state<QP1, QP2>& estimated, T interval)
 {
   auto to_quantity = [](const auto& qp) { return qp.quantity_ref_from(qp.point_origin); };
@@ -171,6 +182,7 @@ template<typename QP1, typename QP2, mp_units::QuantityOf<mp_units::isq::duratio
 }
 
 template<typename QP1, typename QP2, typename QP3, mp_units::QuantityOf<mp_units::isq::duration> T>
+  requires detail::are_time_derivatives<QP1::dimension, QP2::dimension, QP3::dimension>
 [[nodiscard]] constexpr system_state<QP1, QP2, QP3> state_extrapolation(const system_state<QP1, QP2, QP3>& estimated,
                                                                         T interval)
 {
@@ -190,6 +202,179 @@ template<mp_units::Quantity Q1, mp_units::Quantity Q2>
   return uncertainty + process_noise_variance;
 }
 
+// matrix form
+
+// The matrices of a filter are `mp_units::utility::dimensioned_matrix`es: the element `(i, j)` of
+// `matrix<Rows, Cols>` is a quantity of `Rows_i / Cols_j`, so the state transition matrix of a state
+// `x` has the references `<x, x>`, its covariance `<x, 1/x>` (the elements are of `x_i * x_j`), an
+// observation matrix `<z, x>`, and a column vector `<x, one>`.
+template<mp_units::Reference auto... Rs>
+using references = mp_units::utility::typed_index<Rs...>;
+
+template<typename Refs>
+using inverse_references_t = mp_units::utility::inverse_typed_index_t<Refs>;
+
+template<typename Rows, typename Cols, typename Rep = double>
+using matrix = mp_units::utility::dimensioned_matrix<Rows, Cols, Rep>;
+
+template<typename Refs, typename Rep = double>
+using column_vector = mp_units::utility::dimensioned_vector<Refs, Rep>;
+
+template<typename T>
+struct state_traits;
+
+template<mp_units::QuantityPoint... QPs>
+struct state_traits<system_state<QPs...>> {
+  using references_type = references<QPs::reference...>;
+  using rep = std::common_type_t<typename QPs::rep...>;
+};
+
+// The matrices of a filter for the state `S` (and the measurement `M`), both `system_state`s.
+template<SystemState S>
+using state_transition_matrix =
+  matrix<typename state_traits<S>::references_type, typename state_traits<S>::references_type,
+         typename state_traits<S>::rep>;
+
+template<SystemState S>
+using covariance_matrix = matrix<typename state_traits<S>::references_type,
+                                 inverse_references_t<typename state_traits<S>::references_type>,
+                                 typename state_traits<S>::rep>;
+
+template<SystemState M, SystemState S>
+using observation_matrix =
+  matrix<typename state_traits<M>::references_type, typename state_traits<S>::references_type,
+         typename state_traits<S>::rep>;
+
+template<SystemState S, SystemState M>
+using gain_matrix =
+  matrix<typename state_traits<S>::references_type, typename state_traits<M>::references_type,
+         typename state_traits<S>::rep>;
+
+// conversions between the states and the column vectors of their values relative to the origins
+template<mp_units::QuantityPoint... QPs>
+[[nodiscard]] constexpr column_vector<references<QPs::reference...>, typename state_traits<system_state<QPs...>>::rep>
+to_vector(const system_state<QPs...>& s)
+{
+  column_vector<references<QPs::reference...>, typename state_traits<system_state<QPs...>>::rep> v;
+  [&]<std::size_t... Is>(std::index_sequence<Is...>) {
+    ((v(Is, 0) = get<Is>(s).quantity_ref_from(QPs::point_origin).numerical_value_in(QPs::unit)), ...);
+  }(std::index_sequence_for<QPs...>{});
+  return v;
+}
+
+template<SystemState S, typename Refs, typename Rep>
+  requires std::same_as<Refs, typename state_traits<S>::references_type>
+[[nodiscard]] constexpr S to_state(const column_vector<Refs, Rep>& v)
+{
+  return [&]<mp_units::QuantityPoint... QPs, std::size_t... Is>(std::type_identity<system_state<QPs...>>,
+                                                               std::index_sequence<Is...>) {
+    return S{QPs(typename QPs::quantity_type(v.template get<Is, 0>()), QPs::point_origin)...};
+  }(std::type_identity<S>{}, std::make_index_sequence<Refs::size>{});
+}
+
+// system state estimate with a full covariance matrix
+template<mp_units::QuantityPoint... QPs>
+class system_state_covariance_estimate {
+public:
+  using state_type = system_state<QPs...>;
+  using covariance_type = covariance_matrix<state_type>;
+private:
+  state_type state_;
+  covariance_type covariance_;
+public:
+  constexpr system_state_covariance_estimate(state_type state, covariance_type covariance) :
+      state_(state), covariance_(covariance)
+  {
+  }
+  [[nodiscard]] constexpr const state_type& state() const { return state_; }
+  [[nodiscard]] constexpr const covariance_type& covariance() const { return covariance_; }
+
+  template<std::size_t I>
+  [[nodiscard]] constexpr mp_units::Quantity auto variance() const
+  {
+    return covariance_.template get<I, I>();
+  }
+
+  template<std::size_t I>
+  [[nodiscard]] constexpr mp_units::Quantity auto standard_deviation() const
+  {
+    return sqrt(variance<I>());
+  }
+};
+
+// kalman gain: K = P·Hᵀ·(H·P·Hᵀ + R)⁻¹
+template<SystemState S, SystemState M>
+[[nodiscard]] constexpr gain_matrix<S, M> kalman_gain(const covariance_matrix<S>& covariance,
+                                                      const observation_matrix<M, S>& observation,
+                                                      const covariance_matrix<M>& measurement_covariance)
+{
+  const auto pht = covariance * transpose(observation);
+  return pht * inverse(observation * pht + measurement_covariance);
+}
+
+// linear state estimate extrapolation: x = F·x, P = F·P·Fᵀ + Q
+template<mp_units::QuantityPoint... QPs>
+[[nodiscard]] constexpr system_state_covariance_estimate<QPs...> state_estimate_extrapolation(
+  const system_state_covariance_estimate<QPs...>& estimated,
+  const state_transition_matrix<system_state<QPs...>>& transition,
+  const covariance_matrix<system_state<QPs...>>& process_noise)
+{
+  using state = system_state<QPs...>;
+  return {to_state<state>(transition * to_vector(estimated.state())),
+          transition * estimated.covariance() * transpose(transition) + process_noise};
+}
+
+// extended state estimate extrapolation with the non-linear state transition `f` and its Jacobian
+template<mp_units::QuantityPoint... QPs, std::invocable<const system_state<QPs...>&> F>
+  requires std::same_as<std::invoke_result_t<F, const system_state<QPs...>&>, system_state<QPs...>>
+[[nodiscard]] constexpr system_state_covariance_estimate<QPs...> state_estimate_extrapolation(
+  const system_state_covariance_estimate<QPs...>& estimated, F&& f,
+  const state_transition_matrix<system_state<QPs...>>& jacobian,
+  const covariance_matrix<system_state<QPs...>>& process_noise)
+{
+  return {std::invoke(f, estimated.state()), jacobian * estimated.covariance() * transpose(jacobian) + process_noise};
+}
+
+namespace detail {
+
+// x = x + K·(z - h(x)), P = (I - K·H)·P·(I - K·H)ᵀ + K·R·Kᵀ (the Joseph form keeps P symmetric and
+// positive definite despite rounding)
+template<mp_units::QuantityPoint... QPs, typename M>
+[[nodiscard]] constexpr system_state_covariance_estimate<QPs...> state_estimate_update(
+  const system_state_covariance_estimate<QPs...>& predicted, const M& measured, const M& expected,
+  const observation_matrix<M, system_state<QPs...>>& observation, const covariance_matrix<M>& measurement_covariance)
+{
+  using state = system_state<QPs...>;
+  const auto& p = predicted.covariance();
+  const gain_matrix<state, M> gain = kalman_gain<state, M>(p, observation, measurement_covariance);
+  const auto i_kh = state_transition_matrix<state>::identity() - gain * observation;
+  return {to_state<state>(to_vector(predicted.state()) + gain * (to_vector(measured) - to_vector(expected))),
+          i_kh * p * transpose(i_kh) + gain * measurement_covariance * transpose(gain)};
+}
+
+}  // namespace detail
+
+// linear state estimate update with the measurement `z = H·x`
+template<mp_units::QuantityPoint... QPs, SystemState M>
+[[nodiscard]] constexpr system_state_covariance_estimate<QPs...> state_estimate_update(
+  const system_state_covariance_estimate<QPs...>& predicted, const M& measured,
+  const observation_matrix<M, system_state<QPs...>>& observation, const covariance_matrix<M>& measurement_covariance)
+{
+  const M expected = to_state<M>(observation * to_vector(predicted.state()));
+  return detail::state_estimate_update(predicted, measured, expected, observation, measurement_covariance);
+}
+
+// extended state estimate update with the non-linear observation `h` and its Jacobian
+template<mp_units::QuantityPoint... QPs, SystemState M, std::invocable<const system_state<QPs...>&> H>
+  requires std::same_as<std::invoke_result_t<H, const system_state<QPs...>&>, M>
+[[nodiscard]] constexpr system_state_covariance_estimate<QPs...> state_estimate_update(
+  const system_state_covariance_estimate<QPs...>& predicted, const M& measured, H&& h,
+  const observation_matrix<M, system_state<QPs...>>& jacobian, const covariance_matrix<M>& measurement_covariance)
+{
+  return detail::state_estimate_update(predicted, measured, std::invoke(h, predicted.state()), jacobian,
+                                       measurement_covariance);
+}
+
 }  // namespace kalman
 
 template<typename... QPs, typename Char>
@@ -0,0 +1,457 @@
+// The MIT License (MIT)
+//
+// Copyright (c) 2018 Mateusz Pusz
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+
+#pragma once
+
+#include "kalman.h"
+#include <mp-units/compat_macros.h>
+#ifdef MP_UNITS_IMPORT_STD
+import std;
+#else
+#include <algorithm>
+#include <array>
+#include <atomic>
+#include <concepts>
+#include <condition_variable>
+#include <cstddef>
+#include <functional>
+#include <memory>
+#include <mutex>
+#include <span>
+#include <stdexcept>
+#include <thread>
+#include <vector>
+#endif
+#ifdef MP_UNITS_MODULES
+import mp_units;
+#else
+#include <mp-units/framework/quantity_point.h>
+#endif
+
+namespace kalman {
+
+namespace detail {
+
+// The number of tracks processed together by a batch kernel. All the intermediate matrices of
+// a block are kept as `[row][column][track]` arrays on the stack, so every arithmetic operation
+// of the filter becomes a loop of a fixed length over contiguous tracks that the compiler
+// vectorizes without any remainder handling; the batches are padded to a whole number of blocks.
+inline constexpr std::size_t batch_block = 64;
+
+[[nodiscard]] constexpr std::size_t padded_batch_size(std::size_t size)
+{
+  return (size + batch_block - 1) / batch_block * batch_block;
+}
+
+}  // namespace detail
+
+// The states of many independent tracks stored as a structure of arrays: one contiguous array per
+// state variable holding its numerical values (in the unit of the variable, relative to its origin)
+// for all the tracks. The units are a property of the type, so they are checked once at compile
+// time for the whole batch, whatever its size.
+template<SystemState S>
+class state_batch;
+
+template<mp_units::QuantityPoint... QPs>
+class state_batch<system_state<QPs...>> {
+public:
+  using state_type = system_state<QPs...>;
+  using rep = state_traits<state_type>::rep;
+  static constexpr std::size_t dimension = sizeof...(QPs);
+private:
+  std::size_t size_;
+  std::array<std::vector<rep>, dimension> values_;
+public:
+  explicit state_batch(std::size_t size) : size_(size)
+  {
+    for (auto& v : values_) v.resize(detail::padded_batch_size(size));
+  }
+
+  [[nodiscard]] std::size_t size() const { return size_; }
+
+  // the values of the state variable `i` of all the tracks, followed by the padding
+  [[nodiscard]] std::span<rep> values(std::size_t i) { return values_[i]; }
+  [[nodiscard]] std::span<const rep> values(std::size_t i) const { return values_[i]; }
+
+  void set(std::size_t track, const state_type& s)
+  {
+    const auto v = to_vector(s);
+    for (std::size_t i = 0; i < dimension; ++i) values_[i][track] = v(i, 0);
+  }
+
+  [[nodiscard]] state_type get(std::size_t track) const
+  {
+    column_vector<typename state_traits<state_type>::references_type, rep> v;
+    for (std::size_t i = 0; i < dimension; ++i) v(i, 0) = values_[i][track];
+    return to_state<state_type>(v);
+  }
+};
+
+namespace detail {
+
+// The number of tracks a thread claims at a time.
+inline constexpr std::size_t batch_chunk = 64 * batch_block;
+
+// Threads that stay alive between the passes of a batch, so that a radar scan does not pay for
+// starting and joining threads in every `extrapolate()` and `update()`. `run(job)` runs `job` on
+// all the helper threads and on the calling one, and returns when all of them have finished.
+class batch_workers {
+  std::mutex mutex_;
+  std::condition_variable start_;
+  std::condition_variable done_;
+  const std::function<void()>* job_ = nullptr;
+  std::size_t generation_ = 0;
+  std::size_t running_ = 0;
+  bool stop_ = false;
+  std::vector<std::jthread> threads_;
+
+  void work()
+  {
+    std::size_t seen = 0;
+    while (true) {
+      const std::function<void()>* job = nullptr;
+      {
+        std::unique_lock lock(mutex_);
+        start_.wait(lock, [&] { return stop_ || generation_ != seen; });
+        if (stop_) return;
+        seen = generation_;
+        job = job_;
+      }
+      (*job)();
+      const std::scoped_lock lock(mutex_);
+      if (--running_ == 0) done_.notify_one();
+    }
+  }
+public:
+  // `threads` in total, including the calling one
+  explicit batch_workers(std::size_t threads)
+  {
+    for (std::size_t t = 1; t < threads; ++t) threads_.emplace_back([this] { work(); });
+  }
+  batch_workers(const batch_workers&) = delete;
+  batch_workers& operator=(const batch_workers&) = delete;
+  ~batch_workers()
+  {
+    {
+      const std::scoped_lock lock(mutex_);
+      stop_ = true;
+    }
+    start_.notify_all();
+  }
+
+  [[nodiscard]] std::size_t size() const { return threads_.size() + 1; }
+
+  void run(const std::function<void()>& job)
+  {
+    {
+      const std::scoped_lock lock(mutex_);
+      job_ = &job;
+      running_ = threads_.size();
+      ++generation_;
+    }
+    start_.notify_all();
+    job();
+    std::unique_lock lock(mutex_);
+    done_.wait(lock, [&] { return running_ == 0; });
+  }
+};
+
+// The number of threads worth using for `size` tracks when `threads` are requested (`0` uses all
+// the hardware threads): each thread needs at least one chunk to claim.
+[[nodiscard]] inline std::size_t batch_threads(std::size_t size, std::size_t threads)
+{
+  if (threads == 0) threads = std::thread::hardware_concurrency();
+  const std::size_t chunks = (size + batch_chunk - 1) / batch_chunk;
+  return std::max<std::size_t>(1, std::min(threads, chunks));
+}
+
+// Calls `f(first)` for the blocks of `[0, size)` on the calling thread and the `workers`, if any.
+template<typename F>
+void for_each_block(std::size_t size, batch_workers* workers, F f)
+{
+  const std::size_t chunks = (size + batch_chunk - 1) / batch_chunk;
+  std::atomic<std::size_t> next{0};
+  const std::function<void()> worker = [&] {
+    for (std::size_t c = next.fetch_add(1, std::memory_order_relaxed); c < chunks;
+         c = next.fetch_add(1, std::memory_order_relaxed)) {
+      const std::size_t last = std::min(size, (c + 1) * batch_chunk);
+      for (std::size_t first = c * batch_chunk; first < last; first += batch_block) f(first);
+    }
+  };
+  if (workers != nullptr)
+    workers->run(worker);
+  else
+    worker();
+}
+
+template<typename Rep>
+using batch_lanes = Rep[batch_block];
+
+// x = F·x, P = F·P·Fᵀ + Q for a block of tracks; P stays symmetric (Q has to be symmetric), so
+// only its upper triangle is computed
+template<std::size_t N, typename Rep>
+void batch_extrapolation(const std::array<Rep*, N>& x, const std::array<Rep*, N * N>& p, const Rep (&f)[N][N],
+                         const Rep (&q)[N][N])
+{
+  batch_lanes<Rep> fx[N];
+  batch_lanes<Rep> fp[N][N];
+  for (std::size_t i = 0; i < N; ++i) {
+    for (std::size_t t = 0; t < batch_block; ++t) {
+      Rep acc{};
+      for (std::size_t k = 0; k < N; ++k) acc += f[i][k] * x[k][t];
+      fx[i][t] = acc;
+    }
+    for (std::size_t j = 0; j < N; ++j)
+      for (std::size_t t = 0; t < batch_block; ++t) {
+        Rep acc{};
+        for (std::size_t k = 0; k < N; ++k) acc += f[i][k] * p[k * N + j][t];
+        fp[i][j][t] = acc;
+      }
+  }
+  for (std::size_t i = 0; i < N; ++i) {
+    std::copy_n(fx[i], batch_block, x[i]);
+    for (std::size_t j = i; j < N; ++j)
+      for (std::size_t t = 0; t < batch_block; ++t) {
+        Rep acc = q[i][j];
+        for (std::size_t k = 0; k < N; ++k) acc += fp[i][k][t] * f[j][k];
+        p[i * N + j][t] = acc;
+        p[j * N + i][t] = acc;
+      }
+  }
+}
+
+// x = x + K·(z - H·x), P = (I - K·H)·P·(I - K·H)ᵀ + K·R·Kᵀ with K = P·Hᵀ·(H·P·Hᵀ + R)⁻¹ for a
+// block of tracks; the innovation covariance is symmetric positive definite, so it is inverted
+// without pivoting, which keeps every track on the same instruction stream
+template<std::size_t N, std::size_t M, typename Rep>
+void batch_update(const std::array<Rep*, N>& x, const std::array<Rep*, N * N>& p,
+                  const std::array<const Rep*, M>& z, const Rep (&h)[M][N], const Rep (&r)[M][M])
+{
+  // innovation y = z - H·x, P·Hᵀ, and S = H·P·Hᵀ + R
+  batch_lanes<Rep> y[M];
+  batch_lanes<Rep> pht[N][M];
+  batch_lanes<Rep> s[M][M];
+  for (std::size_t a = 0; a < M; ++a) {
+    for (std::size_t t = 0; t < batch_block; ++t) {
+      Rep acc = z[a][t];
+      for (std::size_t k = 0; k < N; ++k) acc -= h[a][k] * x[k][t];
+      y[a][t] = acc;
+    }
+    for (std::size_t i = 0; i < N; ++i)
+      for (std::size_t t = 0; t < batch_block; ++t) {
+        Rep acc{};
+        for (std::size_t k = 0; k < N; ++k) acc += p[i * N + k][t] * h[a][k];
+        pht[i][a][t] = acc;
+      }
+  }
+  for (std::size_t a = 0; a < M; ++a)
+    for (std::size_t b = 0; b < M; ++b)
+      for (std::size_t t = 0; t < batch_block; ++t) {
+        Rep acc = r[a][b];
+        for (std::size_t k = 0; k < N; ++k) acc += h[a][k] * pht[k][b][t];
+        s[a][b][t] = acc;
+      }
+
+  // S⁻¹ by the Gauss-Jordan elimination
+  batch_lanes<Rep> s_inv[M][M];
+  for (std::size_t a = 0; a < M; ++a)
+    for (std::size_t b = 0; b < M; ++b) std::fill_n(s_inv[a][b], batch_block, a == b ? Rep{1} : Rep{});
+  for (std::size_t col = 0; col < M; ++col) {
+    for (std::size_t t = 0; t < batch_block; ++t) {
+      const Rep scale = Rep{1} / s[col][col][t];
+      for (std::size_t j = 0; j < M; ++j) {
+        s[col][j][t] *= scale;
+        s_inv[col][j][t] *= scale;
+      }
+    }
+    for (std::size_t row = 0; row < M; ++row) {
+      if (row == col) continue;
+      for (std::size_t t = 0; t < batch_block; ++t) {
+        const Rep factor = s[row][col][t];
+        for (std::size_t j = 0; j < M; ++j) {
+          s[row][j][t] -= factor * s[col][j][t];
+          s_inv[row][j][t] -= factor * s_inv[col][j][t];
+        }
+      }
+    }
+  }
+
+  // K = P·Hᵀ·S⁻¹, x = x + K·y, and I - K·H
+  batch_lanes<Rep> gain[N][M];
+  batch_lanes<Rep> i_kh[N][N];
+  for (std::size_t i = 0; i < N; ++i) {
+    for (std::size_t a = 0; a < M; ++a)
+      for (std::size_t t = 0; t < batch_block; ++t) {
+        Rep acc{};
+        for (std::size_t b = 0; b < M; ++b) acc += pht[i][b][t] * s_inv[b][a][t];
+        gain[i][a][t] = acc;
+      }
+    for (std::size_t t = 0; t < batch_block; ++t) {
+      Rep acc = x[i][t];
+      for (std::size_t a = 0; a < M; ++a) acc += gain[i][a][t] * y[a][t];
+      x[i][t] = acc;
+    }
+    for (std::size_t k = 0; k < N; ++k)
+      for (std::size_t t = 0; t < batch_block; ++t) {
+        Rep acc = i == k ? Rep{1} : Rep{};
+        for (std::size_t a = 0; a < M; ++a) acc -= gain[i][a][t] * h[a][k];
+        i_kh[i][k][t] = acc;
+      }
+  }
+
+  // the Joseph form of the covariance update; the result is symmetric, so only its upper
+  // triangle is computed
+  batch_lanes<Rep> i_kh_p[N][N];
+  batch_lanes<Rep> kr[N][M];
+  for (std::size_t i = 0; i < N; ++i) {
+    for (std::size_t j = 0; j < N; ++j)
+      for (std::size_t t = 0; t < batch_block; ++t) {
+        Rep acc{};
+        for (std::size_t k = 0; k < N; ++k) acc += i_kh[i][k][t] * p[k * N + j][t];
+        i_kh_p[i][j][t] = acc;
+      }
+    for (std::size_t b = 0; b < M; ++b)
+      for (std::size_t t = 0; t < batch_block; ++t) {
+        Rep acc{};
+        for (std::size_t a = 0; a < M; ++a) acc += gain[i][a][t] * r[a][b];
+        kr[i][b][t] = acc;
+      }
+  }
+  for (std::size_t i = 0; i < N; ++i)
+    for (std::size_t j = i; j < N; ++j)
+      for (std::size_t t = 0; t < batch_block; ++t) {
+        Rep acc{};
+        for (std::size_t k = 0; k < N; ++k) acc += i_kh_p[i][k][t] * i_kh[j][k][t];
+        for (std::size_t b = 0; b < M; ++b) acc += kr[i][b][t] * gain[j][b][t];
+        p[i * N + j][t] = acc;
+        p[j * N + i][t] = acc;
+      }
+}
+
+}  // namespace detail
+
+// The estimates of many independent tracks that share the same filter model: the states and the
+// full covariance matrices, all stored as structures of arrays. `extrapolate()` and `update()`
+// run the matrix-form filter for every track in vectorized passes over blocks of tracks,
+// distributed over many threads. The matrices of the model are checked against the state and the
+// measurement once, when the call compiles; at runtime only the raw numbers are processed, giving
+// the same results (up to rounding) as a loop of `state_estimate_extrapolation()` and
+// `state_estimate_update()` over `system_state_covariance_estimate`s.
+template<SystemState S>
+class track_batch;
+
+template<mp_units::QuantityPoint... QPs>
+class track_batch<system_state<QPs...>> {
+public:
+  using state_type = system_state<QPs...>;
+  using estimate_type = system_state_covariance_estimate<QPs...>;
+  using rep = state_traits<state_type>::rep;
+  static constexpr std::size_t dimension = sizeof...(QPs);
+private:
+  state_batch<state_type> states_;
+  std::array<std::vector<rep>, dimension * dimension> covariances_;
+  std::unique_ptr<detail::batch_workers> workers_;
+
+  // the helper threads for a pass on `threads` threads, started on the first pass that needs them
+  // and kept for the following ones
+  [[nodiscard]] detail::batch_workers* workers(std::size_t threads)
+  {
+    threads = detail::batch_threads(size(), threads);
+    if (threads == 1) return nullptr;
+    if (!workers_ || workers_->size() != threads) workers_ = std::make_unique<detail::batch_workers>(threads);
+    return workers_.get();
+  }
+
+  [[nodiscard]] std::array<rep*, dimension> state_pointers(std::size_t first)
+  {
+    std::array<rep*, dimension> res;
+    for (std::size_t i = 0; i < dimension; ++i) res[i] = states_.values(i).data() + first;
+    return res;
+  }
+
+  [[nodiscard]] std::array<rep*, dimension * dimension> covariance_pointers(std::size_t first)
+  {
+    std::array<rep*, dimension * dimension> res;
+    for (std::size_t i = 0; i < res.size(); ++i) res[i] = covariances_[i].data() + first;
+    return res;
+  }
+public:
+  explicit track_batch(std::size_t size) : states_(size)
+  {
+    for (auto& v : covariances_) v.resize(detail::padded_batch_size(size));
+  }
+
+  [[nodiscard]] std::size_t size() const { return states_.size(); }
+  [[nodiscard]] const state_batch<state_type>& states() const { return states_; }
+
+  // the values of the covariance element `(i, j)` of all the tracks, followed by the padding
+  [[nodiscard]] std::span<const rep> covariances(std::size_t i, std::size_t j) const
+  {
+    return covariances_[i * dimension + j];
+  }
+
+  void set(std::size_t track, const estimate_type& estimate)
+  {
+    states_.set(track, estimate.state());
+    for (std::size_t i = 0; i < dimension; ++i)
+      for (std::size_t j = 0; j < dimension; ++j) covariances_[i * dimension + j][track] = estimate.covariance()(i, j);
+  }
+
+  [[nodiscard]] estimate_type get(std::size_t track) const
+  {
+    typename estimate_type::covariance_type covariance;
+    for (std::size_t i = 0; i < dimension; ++i)
+      for (std::size_t j = 0; j < dimension; ++j) covariance(i, j) = covariances_[i * dimension + j][track];
+    return {states_.get(track), covariance};
+  }
+
+  // x = F·x, P = F·P·Fᵀ + Q for every track; `threads == 0` uses all the hardware threads
+  void extrapolate(const state_transition_matrix<state_type>& transition,
+                   const covariance_matrix<state_type>& process_noise, std::size_t threads = 0)
+  {
+    detail::for_each_block(size(), workers(threads), [&](std::size_t first) {
+      detail::batch_extrapolation<dimension>(state_pointers(first), covariance_pointers(first),
+                                             transition.numerical_values(), process_noise.numerical_values());
+    });
+  }
+
+  // the linear update of every track with its measurement `z = H·x`; `measured` holds one
+  // measurement per track, and a batch of a different size throws `std::invalid_argument`
+  template<SystemState M>
+    requires std::same_as<typename state_batch<M>::rep, rep>
+  void update(const state_batch<M>& measured, const observation_matrix<M, state_type>& observation,
+              const covariance_matrix<M>& measurement_covariance, std::size_t threads = 0)
+  {
+    if (measured.size() != size())
+      throw std::invalid_argument("the number of the measurements does not match the number of the tracks");
+    constexpr std::size_t measurement_dimension = state_batch<M>::dimension;
+    detail::for_each_block(size(), workers(threads), [&](std::size_t first) {
+      std::array<const rep*, measurement_dimension> z;
+      for (std::size_t a = 0; a < measurement_dimension; ++a) z[a] = measured.values(a).data() + first;
+      detail::batch_update<dimension, measurement_dimension>(state_pointers(first), covariance_pointers(first), z,
+                                                             observation.numerical_values(),
+                                                             measurement_covariance.numerical_values());
+    });
+  }
+};
+
+}  // namespace kalman
@@ -0,0 +1,172 @@
+// The MIT License (MIT)
+//
+// Copyright (c) 2018 Mateusz Pusz
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+
+#include "kalman.h"
+#include "kalman_batch.h"
+#include <mp-units/ext/format.h>
+#ifdef MP_UNITS_IMPORT_STD
+import std;
+#else
+#include <algorithm>
+#include <chrono>
+#include <cmath>
+#include <cstddef>
+#include <iostream>
+#include <random>
+#include <thread>
+#include <vector>
+#endif
+#ifdef MP_UNITS_MODULES
+import mp_units;
+#else
+#include <mp-units/framework/quantity_point.h>
+#include <mp-units/math.h>
+#include <mp-units/systems/isq/space_and_time.h>
+#include <mp-units/systems/si.h>
+#endif
+
+// Many vehicles moving with nearly constant velocities, each tracked by its own filter from the
+// positions reported in every radar scan: a loop of scalar matrix-form filters compared with
+// `kalman::track_batch` running the same model on all the tracks at once.
+
+using namespace mp_units;
+using namespace mp_units::si::unit_symbols;
+
+using position = quantity_point<isq::length[m]>;
+using velocity = quantity_point<isq::speed[m / s]>;
+using state = kalman::system_state<position, position, velocity, velocity>;
+using measurement = kalman::system_state<position, position>;
+using estimate = kalman::system_state_covariance_estimate<position, position, velocity, velocity>;
+
+inline constexpr std::size_t scans = 10;
+
+// the track updates per second of one run that took `time` for `tracks` tracks over all the scans
+double updates_per_second(std::size_t tracks, std::chrono::steady_clock::duration time)
+{
+  return static_cast<double>(tracks * scans) / std::chrono::duration<double>(time).count();
+}
+
+int main()
+{
+  const quantity interval = isq::duration(1. * s);
+  const quantity acceleration_noise = 0.2 * m / s2;
+  const quantity position_error = isq::length(10. * m);
+
+  auto transition = kalman::state_transition_matrix<state>::identity();
+  transition.set<0, 2>(interval);
+  transition.set<1, 3>(interval);
+
+  kalman::covariance_matrix<state> process_noise;
+  const quantity var_a = pow<2>(acceleration_noise);
+  process_noise.set<0, 0>(pow<4>(interval) / 4 * var_a);
+  process_noise.set<1, 1>(pow<4>(interval) / 4 * var_a);
+  process_noise.set<0, 2>(pow<3>(interval) / 2 * var_a);
+  process_noise.set<2, 0>(pow<3>(interval) / 2 * var_a);
+  process_noise.set<1, 3>(pow<3>(interval) / 2 * var_a);
+  process_noise.set<3, 1>(pow<3>(interval) / 2 * var_a);
+  process_noise.set<2, 2>(pow<2>(interval) * var_a);
+  process_noise.set<3, 3>(pow<2>(interval) * var_a);
+
+  // the radar reports the positions of the vehicles
+  kalman::observation_matrix<measurement, state> observation;
+  observation.set<0, 0>(1. * one);
+  observation.set<1, 1>(1. * one);
+
+  kalman::covariance_matrix<measurement> measurement_noise;
+  measurement_noise.set<0, 0>(pow<2>(position_error));
+  measurement_noise.set<1, 1>(pow<2>(position_error));
+
+  kalman::covariance_matrix<state> initial_covariance;
+  initial_covariance.set<0, 0>(pow<2>(100. * m));
+  initial_covariance.set<1, 1>(pow<2>(100. * m));
+  initial_covariance.set<2, 2>(pow<2>(20. * m / s));
+  initial_covariance.set<3, 3>(pow<2>(20. * m / s));
+
+  const std::size_t threads = std::max(1u, std::thread::hardware_concurrency());
+  std::cout << MP_UNITS_STD_FMT::format("{:>8} | {:>20} | {:>20} | {:>20} | {:>9}\n", "tracks",
+                                        "scalar [updates/s]", "batch [updates/s]",
+                                        MP_UNITS_STD_FMT::format("{} threads [updates/s]", threads), "max diff");
+  for (const std::size_t tracks : {std::size_t{10'000}, std::size_t{100'000}}) {
+    // the vehicles start around the radar and move in random directions
+    std::mt19937_64 gen(42);
+    std::uniform_real_distribution<double> start(-5'000., 5'000.);
+    std::uniform_real_distribution<double> speed(-30., 30.);
+    std::normal_distribution<double> noise(0., position_error.numerical_value_in(m));
+    std::vector<estimate> initial;
+    std::vector<std::vector<measurement>> measured(scans);
+    initial.reserve(tracks);
+    for (auto& scan : measured) scan.reserve(tracks);
+    for (std::size_t i = 0; i < tracks; ++i) {
+      const double x = start(gen), y = start(gen), vx = speed(gen), vy = speed(gen);
+      initial.emplace_back(state{position{(x + noise(gen)) * m}, position{(y + noise(gen)) * m},
+                                 velocity{0. * m / s}, velocity{0. * m / s}},
+                           initial_covariance);
+      for (std::size_t k = 0; k < scans; ++k) {
+        const double time = static_cast<double>(k + 1);
+        measured[k].emplace_back(position{(x + vx * time + noise(gen)) * m},
+                                 position{(y + vy * time + noise(gen)) * m});
+      }
+    }
+
+    // a loop of scalar filters
+    std::vector<estimate> scalar = initial;
+    auto begin = std::chrono::steady_clock::now();
+    for (std::size_t k = 0; k < scans; ++k)
+      for (std::size_t i = 0; i < tracks; ++i)
+        scalar[i] = kalman::state_estimate_update(kalman::state_estimate_extrapolation(scalar[i], transition,
+                                                                                       process_noise),
+                                                  measured[k][i], observation, measurement_noise);
+    const auto scalar_time = std::chrono::steady_clock::now() - begin;
+
+    // the same filters as one batch, on one and on all the hardware threads
+    std::vector<kalman::state_batch<measurement>> measured_batch(scans, kalman::state_batch<measurement>(tracks));
+    for (std::size_t k = 0; k < scans; ++k)
+      for (std::size_t i = 0; i < tracks; ++i) measured_batch[k].set(i, measured[k][i]);
+    const auto run_batch = [&](std::size_t batch_threads, kalman::track_batch<state>& batch) {
+      for (std::size_t i = 0; i < tracks; ++i) batch.set(i, initial[i]);
+      const auto batch_begin = std::chrono::steady_clock::now();
+      for (std::size_t k = 0; k < scans; ++k) {
+        batch.extrapolate(transition, process_noise, batch_threads);
+        batch.update(measured_batch[k], observation, measurement_noise, batch_threads);
+      }
+      return std::chrono::steady_clock::now() - batch_begin;
+    };
+    kalman::track_batch<state> batch(tracks);
+    const auto batch_time = run_batch(1, batch);
+    kalman::track_batch<state> parallel_batch(tracks);
+    const auto parallel_time = run_batch(threads, parallel_batch);
+
+    // both have to give the same estimates up to rounding
+    quantity max_diff = isq::length(0. * m);
+    for (std::size_t i = 0; i < tracks; ++i) {
+      const state expected = scalar[i].state();
+      for (const auto& b : {batch.get(i).state(), parallel_batch.get(i).state()})
+        max_diff = std::max({max_diff, abs(get<0>(b) - get<0>(expected)), abs(get<1>(b) - get<1>(expected))});
+    }
+    if (max_diff > 1e-6 * m) return 1;
+
+    std::cout << MP_UNITS_STD_FMT::format("{:>8} | {:>20.3e} | {:>20.3e} | {:>20.3e} | {::N[.1e]}\n", tracks,
+                                          updates_per_second(tracks, scalar_time),
+                                          updates_per_second(tracks, batch_time),
+                                          updates_per_second(tracks, parallel_time), max_diff);
+  }
+}
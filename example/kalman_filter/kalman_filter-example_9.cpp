@@ -0,0 +1,129 @@
+// The MIT License (MIT)
+//
+// Copyright (c) 2018 Mateusz Pusz
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+
+#include "kalman.h"
+#include <mp-units/ext/format.h>
+#ifdef MP_UNITS_IMPORT_STD
+import std;
+#else
+#include <array>
+#include <iostream>
+#include <utility>
+#endif
+#ifdef MP_UNITS_MODULES
+import mp_units;
+#else
+#include <mp-units/framework/quantity_point.h>
+#include <mp-units/math.h>
+#include <mp-units/systems/isq/space_and_time.h>
+#include <mp-units/systems/si.h>
+#endif
+
+// A vehicle moving with a nearly constant velocity, tracked by a radar that measures its range
+// and bearing: a matrix-form filter with a linear state extrapolation and an extended (EKF)
+// measurement update.
+
+using namespace mp_units;
+
+int main()
+{
+  using namespace mp_units::si::unit_symbols;
+  using position = quantity_point<isq::length[m]>;
+  using velocity = quantity_point<isq::speed[m / s]>;
+  using range = quantity_point<isq::distance[m]>;
+  using bearing = quantity_point<isq::angular_measure[rad]>;
+  using state = kalman::system_state<position, position, velocity, velocity>;
+  using measurement = kalman::system_state<range, bearing>;
+  using estimate = kalman::system_state_covariance_estimate<position, position, velocity, velocity>;
+
+  const quantity interval = isq::duration(1. * s);
+  const quantity acceleration_noise = 0.2 * m / s2;
+  const quantity range_error = isq::distance(5. * m);
+  const quantity bearing_error = isq::angular_measure(0.005 * rad);
+  const std::array measurements = {
+    std::pair{2226.0, 0.4691}, std::pair{2224.0, 0.4799}, std::pair{2211.5, 0.4860}, std::pair{2203.6, 0.4948},
+    std::pair{2188.0, 0.4974}, std::pair{2186.1, 0.5039}, std::pair{2171.4, 0.5232}, std::pair{2163.0, 0.5185},
+    std::pair{2161.0, 0.5311}, std::pair{2147.1, 0.5437}, std::pair{2143.6, 0.5379}, std::pair{2123.2, 0.5517},
+    std::pair{2127.8, 0.5610}, std::pair{2120.8, 0.5741}, std::pair{2110.1, 0.5711}};
+
+  // constant velocity model: x = x + vx·Δt, y = y + vy·Δt
+  auto transition = kalman::state_transition_matrix<state>::identity();
+  transition.set<0, 2>(interval);
+  transition.set<1, 3>(interval);
+
+  // a random acceleration with the standard deviation σa in both axes
+  kalman::covariance_matrix<state> process_noise;
+  const quantity var_a = pow<2>(acceleration_noise);
+  process_noise.set<0, 0>(pow<4>(interval) / 4 * var_a);
+  process_noise.set<1, 1>(pow<4>(interval) / 4 * var_a);
+  process_noise.set<0, 2>(pow<3>(interval) / 2 * var_a);
+  process_noise.set<2, 0>(pow<3>(interval) / 2 * var_a);
+  process_noise.set<1, 3>(pow<3>(interval) / 2 * var_a);
+  process_noise.set<3, 1>(pow<3>(interval) / 2 * var_a);
+  process_noise.set<2, 2>(pow<2>(interval) * var_a);
+  process_noise.set<3, 3>(pow<2>(interval) * var_a);
+
+  kalman::covariance_matrix<measurement> measurement_noise;
+  measurement_noise.set<0, 0>(pow<2>(range_error));
+  measurement_noise.set<1, 1>(pow<2>(bearing_error));
+
+  // the radar at the origin measures the range and the bearing of the vehicle
+  const auto observe = [](const state& s) {
+    const quantity x = get<0>(s).quantity_from_zero();
+    const quantity y = get<1>(s).quantity_from_zero();
+    return measurement{range{isq::distance(hypot(x, y))}, bearing{isq::angular_measure(si::atan2(y, x))}};
+  };
+  const auto observe_jacobian = [](const state& s) {
+    const quantity x = get<0>(s).quantity_from_zero();
+    const quantity y = get<1>(s).quantity_from_zero();
+    const quantity r2 = x * x + y * y;
+    const quantity r = sqrt(r2);
+    kalman::observation_matrix<measurement, state> jacobian;
+    jacobian.set<0, 0>(isq::distance(x) / r);
+    jacobian.set<0, 1>(isq::distance(y) / r);
+    jacobian.set<1, 0>(-y / r2 * rad);
+    jacobian.set<1, 1>(x / r2 * rad);
+    return jacobian;
+  };
+
+  kalman::covariance_matrix<state> initial_covariance;
+  initial_covariance.set<0, 0>(pow<2>(100. * m));
+  initial_covariance.set<1, 1>(pow<2>(100. * m));
+  initial_covariance.set<2, 2>(pow<2>(20. * m / s));
+  initial_covariance.set<3, 3>(pow<2>(20. * m / s));
+  const estimate initial{state{position{2000. * m}, position{1000. * m}, velocity{0. * m / s}, velocity{0. * m / s}},
+                         initial_covariance};
+
+  std::cout << MP_UNITS_STD_FMT::format("Initial: {}\n", initial.state());
+  std::cout << MP_UNITS_STD_FMT::format("{:>2} | {:>20} | {:>58} | {:>8}\n", "N", "Measured", "Curr. Estimate",
+                                        "σ(x)");
+  estimate next = kalman::state_estimate_extrapolation(initial, transition, process_noise);
+  for (int index = 1; const auto& [r, theta] : measurements) {
+    const measurement measured{range{isq::distance(r * m)}, bearing{isq::angular_measure(theta * rad)}};
+    const estimate current = kalman::state_estimate_update(next, measured, observe, observe_jacobian(next.state()),
+                                                           measurement_noise);
+    next = kalman::state_estimate_extrapolation(current, transition, process_noise);
+    std::cout << MP_UNITS_STD_FMT::format(
+      "{:2} | {:20:0[:N[.1f]]1[:N[.4f]]} | {:58:0[:N[.1f]]1[:N[.1f]]2[:N[.2f]]3[:N[.2f]]} | {::N[.2f]}\n", index++,
+      measured, current.state(), current.standard_deviation<0>());
+  }
+}
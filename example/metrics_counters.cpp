@@ -0,0 +1,104 @@
+// The MIT License (MIT)
+//
+// Copyright (c) 2018 Mateusz Pusz
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+
+
+// !!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!
+// !!! Before you commit any changes to this file please make sure to check if it !!!
+// !!! renders correctly in the documentation "Examples" section.                 !!!
+// !!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!
+
+#include <mp-units/compat_macros.h>
+#include <mp-units/ext/format.h>
+#ifdef MP_UNITS_IMPORT_STD
+import std;
+#else
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <cstdint>
+#include <iostream>
+#include <thread>
+#include <vector>
+#endif
+#ifdef MP_UNITS_MODULES
+import mp_units;
+#else
+#include <mp-units/systems/iec.h>
+#include <mp-units/systems/si.h>
+#include <mp-units/utility/sharded_counter.h>
+#endif
+
+using namespace mp_units;
+using namespace mp_units::iec::unit_symbols;
+
+using bytes = quantity<iec::byte, std::uint64_t>;
+using duration = quantity<si::nano<si::second>, std::int64_t>;
+
+inline constexpr int ops_per_thread = 2'000'000;
+
+// Runs `threads` workers that each record `ops_per_thread` transfers into `bytes_sent` and
+// `busy_time`, and returns the wall-clock time the whole batch took.
+template<typename BytesCounter, typename DurationCounter>
+quantity<si::milli<si::second>> run(int threads, BytesCounter& bytes_sent, DurationCounter& busy_time)
+{
+  const auto start = std::chrono::steady_clock::now();
+  std::vector<std::thread> workers;
+  workers.reserve(static_cast<std::size_t>(threads));
+  for (int t = 0; t < threads; ++t)
+    workers.emplace_back([&] {
+      for (int i = 0; i < ops_per_thread; ++i) {
+        bytes_sent += std::uint64_t{1500} * B;
+        busy_time += std::int64_t{250} * si::unit_symbols::ns;
+      }
+    });
+  for (auto& w : workers) w.join();
+  return quantity{std::chrono::duration<double, std::milli>(std::chrono::steady_clock::now() - start)};
+}
+
+int main()
+{
+  const int max_threads = std::max(4, static_cast<int>(std::thread::hardware_concurrency()));
+
+  std::cout << MP_UNITS_STD_FMT::format("{:>8} {:>17} {:>17} {:>8}\n", "threads", "std::atomic [ms]",
+                                        "sharded [ms]", "speedup");
+  for (int threads = 1; threads <= max_threads; threads *= 2) {
+    std::atomic<bytes> atomic_bytes{};
+    std::atomic<duration> atomic_busy{};
+    const quantity atomic_time = run(threads, atomic_bytes, atomic_busy);
+
+    utility::sharded_counter<bytes> sharded_bytes;
+    utility::sharded_counter<duration> sharded_busy;
+    const quantity sharded_time = run(threads, sharded_bytes, sharded_busy);
+
+    // both variants must agree on the totals
+    if (atomic_bytes.load() != sharded_bytes.read() || atomic_busy.load() != sharded_busy.read()) return 1;
+
+    std::cout << MP_UNITS_STD_FMT::format("{:>8} {:>17.1f} {:>17.1f} {:>7.1f}x\n", threads,
+                                          atomic_time.numerical_value_in(si::milli<si::second>),
+                                          sharded_time.numerical_value_in(si::milli<si::second>),
+                                          (atomic_time / sharded_time).numerical_value_in(one));
+    if (threads == max_threads)
+      std::cout << MP_UNITS_STD_FMT::format("\nrecorded at {} threads: {::N[.2f]} in {::N[.3f]}\n", threads,
+                                            value_cast<double>(sharded_bytes.read()).in(GiB),
+                                            value_cast<double>(sharded_busy.read()).in(si::second));
+  }
+}
@@ -0,0 +1,171 @@
+// The MIT License (MIT)
+//
+// Copyright (c) 2018 Mateusz Pusz
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+#include "geodesy.h"
+#include "geographic.h"
+#include "glide_computer_lib.h"
+#include "position_index.h"
+#include <mp-units/ext/format.h>
+#ifdef MP_UNITS_IMPORT_STD
+import std;
+#else
+#include <algorithm>
+#include <chrono>
+#include <cmath>
+#include <cstddef>
+#include <iostream>
+#include <numbers>
+#include <random>
+#include <span>
+#include <string>
+#include <vector>
+#endif
+#ifdef MP_UNITS_MODULES
+import mp_units;
+#else
+#include <mp-units/systems/isq/space_and_time.h>
+#include <mp-units/systems/si.h>
+#endif
+
+// The nearest of a million waypoints to many positions: the linear scan computing the distances to
+// all the waypoints compared with the queries of `geographic::position_index`.
+
+using namespace mp_units;
+using namespace mp_units::si::unit_symbols;
+using namespace geographic;
+
+namespace {
+
+inline constexpr std::size_t waypoints = 1'000'000;
+inline constexpr std::size_t scanned_queries = 10;
+inline constexpr std::size_t indexed_queries = 100'000;
+inline constexpr std::size_t k = 10;
+inline constexpr quantity radius = isq::distance(50. * km);
+
+// positions spread uniformly over the sphere
+class random_positions {
+public:
+  explicit random_positions(std::uint64_t seed) : gen_(seed) {}
+  position<double> operator()()
+  {
+    return {std::asin(sin_lat_(gen_)) * std::numbers::inv_pi * 180. * geo_latitude[deg] + equator,
+            lon_(gen_) * geo_longitude[deg] + prime_meridian};
+  }
+
+private:
+  std::mt19937_64 gen_;
+  std::uniform_real_distribution<double> sin_lat_{-1., 1.};
+  std::uniform_real_distribution<double> lon_{-180., 180.};
+};
+
+template<typename F>
+double queries_per_second(std::size_t queries, F f)
+{
+  const auto begin = std::chrono::steady_clock::now();
+  f();
+  return static_cast<double>(queries) /
+         std::chrono::duration<double>(std::chrono::steady_clock::now() - begin).count();
+}
+
+}  // namespace
+
+int main()
+{
+  random_positions random(42);
+  std::vector<glide_computer::waypoint> database;
+  database.reserve(waypoints);
+  for (std::size_t i = 0; i < waypoints; ++i)
+    database.push_back({"WP" + std::to_string(i), random(), mean_sea_level + 0. * m});
+
+  position_soa<double> positions;
+  positions.reserve(waypoints);
+  for (const auto& w : database) positions.push_back(w.pos);
+  const auto build_begin = std::chrono::steady_clock::now();
+  const position_index<double> index(positions.view());
+  const auto build_time = std::chrono::steady_clock::now() - build_begin;
+  std::cout << MP_UNITS_STD_FMT::format("{} waypoints indexed in {::N[.3f]}\n\n", index.size(),
+                                        quantity{std::chrono::duration<double>(build_time)}.in(ms));
+
+  std::vector<position<double>> queries;
+  queries.reserve(indexed_queries);
+  for (std::size_t i = 0; i < indexed_queries; ++i) queries.push_back(random());
+
+  // the linear scan: all the distances and their minimum, the k smallest, or the ones within the radius
+  std::vector<geodesic_distance<>> distances(waypoints);
+  std::vector<std::size_t> scan_nearest(scanned_queries), scan_within(scanned_queries);
+  std::vector<std::vector<geodesic_distance<>>> scan_k(scanned_queries);
+  const double scan_nearest_rate = queries_per_second(scanned_queries, [&] {
+    for (std::size_t q = 0; q < scanned_queries; ++q) {
+      haversine_distance(queries[q], positions.view(), std::span{distances});
+      scan_nearest[q] = static_cast<std::size_t>(std::ranges::min_element(distances) - distances.begin());
+    }
+  });
+  const double scan_k_rate = queries_per_second(scanned_queries, [&] {
+    for (std::size_t q = 0; q < scanned_queries; ++q) {
+      haversine_distance(queries[q], positions.view(), std::span{distances});
+      std::ranges::partial_sort(distances, distances.begin() + k);
+      scan_k[q].assign(distances.begin(), distances.begin() + k);
+    }
+  });
+  const double scan_within_rate = queries_per_second(scanned_queries, [&] {
+    for (std::size_t q = 0; q < scanned_queries; ++q) {
+      haversine_distance(queries[q], positions.view(), std::span{distances});
+      scan_within[q] = static_cast<std::size_t>(std::ranges::count_if(distances, [](auto d) { return d <= radius; }));
+    }
+  });
+
+  // the index
+  std::vector<neighbour<>> index_nearest(indexed_queries);
+  std::vector<neighbour<>> index_k(indexed_queries * k);
+  std::vector<std::size_t> index_within(indexed_queries);
+  const double index_nearest_rate = queries_per_second(indexed_queries, [&] {
+    for (std::size_t q = 0; q < indexed_queries; ++q) index_nearest[q] = index.nearest(queries[q]);
+  });
+  const double index_k_rate = queries_per_second(indexed_queries, [&] {
+    for (std::size_t q = 0; q < indexed_queries; ++q) index.nearest(queries[q], std::span{index_k}.subspan(q * k, k));
+  });
+  const double index_within_rate = queries_per_second(indexed_queries, [&] {
+    for (std::size_t q = 0; q < indexed_queries; ++q) index_within[q] = index.within(queries[q], radius).size();
+  });
+
+  std::cout << MP_UNITS_STD_FMT::format("{:<24} | {:>18} | {:>18} | {:>8}\n", "query", "scan [queries/s]",
+                                        "index [queries/s]", "speedup");
+  const auto report = [](std::string_view query, double scan, double indexed) {
+    std::cout << MP_UNITS_STD_FMT::format("{:<24} | {:>18.3e} | {:>18.3e} | {:>7.0f}x\n", query, scan, indexed,
+                                          indexed / scan);
+  };
+  report("nearest", scan_nearest_rate, index_nearest_rate);
+  report(MP_UNITS_STD_FMT::format("{} nearest", k), scan_k_rate, index_k_rate);
+  report(MP_UNITS_STD_FMT::format("within {}", radius), scan_within_rate, index_within_rate);
+
+  // both find the same waypoints; the scan uses the fast haversine kernel, which may be off by
+  // hundreds of metres for nearly antipodal positions, but the nearest waypoints among a million
+  // are only kilometres away, where it stays well within the tolerance of 1 m
+  for (std::size_t q = 0; q < scanned_queries; ++q) {
+    if (abs(index_nearest[q].distance - haversine_distance(queries[q], database[scan_nearest[q]].pos)) > 1. * m)
+      return 1;
+    for (std::size_t i = 0; i < k; ++i)
+      if (abs(index_k[q * k + i].distance - scan_k[q][i]) > 1. * m) return 1;
+    if (index_within[q] != scan_within[q]) return 1;
+  }
+  std::cout << MP_UNITS_STD_FMT::format("\nthe nearest waypoint to the first query: {} at {::N[.3f]}\n",
+                                        database[index_nearest[0].index].name, index_nearest[0].distance);
+}
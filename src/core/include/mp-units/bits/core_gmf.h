@@ -30,6 +30,7 @@
 
 #ifndef MP_UNITS_IMPORT_STD
 #include <array>
+#include <atomic>
 #include <bit>
 #include <cassert>
 #include <compare>
@@ -46,6 +47,7 @@
 #include <numeric>
 #include <optional>
 #include <ranges>
+#include <span>
 #include <string_view>
 #include <tuple>
 #include <type_traits>
@@ -106,6 +106,15 @@
 // workarounds for https://cplusplus.github.io/CWG/issues/2387.html
 #define MP_UNITS_INLINE inline
 
+// forces inlining of small numerical kernels so that loops calling them can be vectorized
+#if MP_UNITS_COMP_GCC || MP_UNITS_COMP_CLANG
+#define MP_UNITS_ALWAYS_INLINE [[gnu::always_inline]]
+#elif MP_UNITS_COMP_MSVC
+#define MP_UNITS_ALWAYS_INLINE [[msvc::forceinline]]
+#else
+#define MP_UNITS_ALWAYS_INLINE
+#endif
+
 #if __cpp_auto_cast >= 202110L && MP_UNITS_COMP_GCC > 13
 #define MP_UNITS_NONCONST_TYPE(expr) decltype(auto(expr))
 #else
@@ -170,6 +179,12 @@ MP_UNITS_DIAGNOSTIC_POP
 
 #endif
 
+#if !defined MP_UNITS_API_BOUNDS_AUDIT
+
+#define MP_UNITS_API_BOUNDS_AUDIT 0
+
+#endif
+
 #if defined(__clang__) && defined(__apple_build_version__) && __apple_build_version__ < 16000026
 #define MP_UNITS_XCODE15_HACKS
 #endif
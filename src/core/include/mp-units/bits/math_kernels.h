@@ -0,0 +1,448 @@
+// The MIT License (MIT)
+//
+// Copyright (c) 2018 Mateusz Pusz
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+
+#pragma once
+
+#include <mp-units/bits/requires_hosted.h>
+//
+// IWYU pragma: private, include <mp-units/math.h>
+#include <mp-units/bits/hacks.h>
+#include <mp-units/bits/module_macros.h>
+#include <mp-units/ext/type_traits.h>
+#include <mp-units/framework/unit_magnitude.h>
+
+#ifndef MP_UNITS_IN_MODULE_INTERFACE
+#ifdef MP_UNITS_IMPORT_STD
+import std;
+#else
+#include <bit>
+#include <cmath>
+#include <concepts>
+#include <cstdint>
+#include <type_traits>
+#endif  // MP_UNITS_IMPORT_STD
+#endif  // MP_UNITS_IN_MODULE_INTERFACE
+
+namespace mp_units {
+
+MP_UNITS_EXPORT_BEGIN
+
+/**
+ * @brief Accuracy tiers of the math functions with a selectable implementation
+ *
+ * The trigonometric functions of angular quantities (`sin`, `cos`, `sincos`, `atan2`) and
+ * `hypot` take an accuracy tier as an optional last argument:
+ *
+ * @code{.cpp}
+ * quantity s1 = sin(30. * deg);                  // the standard library
+ * quantity s2 = sin(30. * deg, ulp_accuracy);    // library kernels, about 1 ULP
+ * quantity s3 = sin(30. * deg, fast_accuracy);   // short polynomials, about 1e-7
+ * @endcode
+ *
+ * - `libm_accuracy` - calls the standard library functions (the same as calling the function
+ *                     without a tier),
+ * - `ulp_accuracy`  - inlined library kernels within 1 ULP of the exact result for `sin`, `cos`,
+ *                     and `hypot` (2 ULP for `atan2`); arguments outside of the supported range,
+ *                     infinities, and NaNs fall back to the standard library,
+ * - `fast_accuracy` - branch-free short polynomials with an absolute error of about `1e-7`
+ *                     that vectorize well; valid only for finite arguments (the trigonometric
+ *                     ones of a magnitude up to about `1e5` rad, or `1e5` revolutions in units
+ *                     being a rational part of a revolution).
+ *
+ * The library kernels reduce the argument in the unit it is expressed in when the unit is
+ * a rational part of a revolution (e.g. degrees, gradians, or revolutions). Such a reduction
+ * is exact, and the conversion to radians is applied only to the reduced angle.
+ * Representation types other than `float` and `double` always use the standard library.
+ */
+struct libm_accuracy_t {
+  explicit libm_accuracy_t() = default;
+};
+
+struct ulp_accuracy_t {
+  explicit ulp_accuracy_t() = default;
+};
+
+struct fast_accuracy_t {
+  explicit fast_accuracy_t() = default;
+};
+
+inline constexpr libm_accuracy_t libm_accuracy{};
+inline constexpr ulp_accuracy_t ulp_accuracy{};
+inline constexpr fast_accuracy_t fast_accuracy{};
+
+/**
+ * @brief A concept matching all math accuracy tiers
+ *
+ * Satisfied only by the types of `libm_accuracy`, `ulp_accuracy`, and `fast_accuracy`.
+ */
+template<typename T>
+concept MathAccuracy = contains<T, libm_accuracy_t, ulp_accuracy_t, fast_accuracy_t>();
+
+MP_UNITS_EXPORT_END
+
+namespace detail {
+
+// Representation types for which the library provides its own kernels
+template<typename T>
+concept KernelFloatingPoint = std::same_as<T, float> || std::same_as<T, double>;
+
+// The type a library kernel computes a function of `Reps...` in (integral arguments are promoted
+// to `double` as in the standard library), or `void` when the standard library should be used
+template<MathAccuracy Accuracy, typename... Reps>
+struct kernel_rep {
+  using type = void;
+};
+
+template<MathAccuracy Accuracy, typename... Reps>
+  requires(!std::is_same_v<Accuracy, libm_accuracy_t>) && (std::is_arithmetic_v<Reps> && ...)
+struct kernel_rep<Accuracy, Reps...> {
+  using promoted = std::conditional_t<(std::is_integral_v<Reps> || ...), double, std::common_type_t<Reps...>>;
+  using type = std::conditional_t<KernelFloatingPoint<promoted>, promoted, void>;
+};
+
+template<MathAccuracy Accuracy, typename... Reps>
+using kernel_rep_t = kernel_rep<Accuracy, Reps...>::type;
+
+template<KernelFloatingPoint T>
+using kernel_bits_t = std::conditional_t<std::is_same_v<T, float>, std::uint32_t, std::uint64_t>;
+
+// `cond ? a : b` as bit operations, which compilers turn into vector blends more reliably than
+// a select of floating-point values
+template<KernelFloatingPoint T>
+MP_UNITS_ALWAYS_INLINE [[nodiscard]] inline T blend(bool cond, T a, T b)
+{
+  using bits = kernel_bits_t<T>;
+  const bits mask = bits{0} - static_cast<bits>(cond);
+  return std::bit_cast<T>(static_cast<bits>((std::bit_cast<bits>(a) & mask) | (std::bit_cast<bits>(b) & ~mask)));
+}
+
+template<typename T>
+struct trig_constants;
+
+// Cody-Waite split of pi/2: the leading parts have trailing zero bits, so `k * pio2_N` is exact
+// for the quadrant numbers supported by the kernels.
+template<>
+struct trig_constants<double> {
+  static constexpr double two_over_pi = 6.36619772367581382433e-01;
+  static constexpr double pio2_1 = 1.57079632673412561417e+00;
+  static constexpr double pio2_2 = 6.07710050630396597660e-11;
+  static constexpr double pio2_3 = 2.02226624871116645580e-21;
+  static constexpr double max_quadrant = 0x1p20;
+};
+
+template<>
+struct trig_constants<float> {
+  static constexpr float two_over_pi = 6.36619772e-01F;
+  static constexpr float pio2_1 = 1.5703125F;
+  static constexpr float pio2_2 = 4.837512969970703125e-4F;
+  static constexpr float pio2_3 = 7.54978995489188216e-8F;
+  static constexpr float max_quadrant = 0x1p16F;
+};
+
+// The rounding error of `a * b` (Dekker's product with Veltkamp's splitting)
+template<typename T>
+MP_UNITS_ALWAYS_INLINE [[nodiscard]] inline T product_error(T a, T b, T product)
+{
+  constexpr T split = std::is_same_v<T, float> ? T(4097) : T(134217729);  // 2^(digits / 2 + 1) + 1
+  const T ca = split * a;
+  const T a_hi = ca - (ca - a);
+  const T a_lo = a - a_hi;
+  const T cb = split * b;
+  const T b_hi = cb - (cb - b);
+  const T b_lo = b - b_hi;
+  return ((a_hi * b_hi - product) + a_hi * b_lo + a_lo * b_hi) + a_lo * b_lo;
+}
+
+// An angle reduced to `quadrant * pi/2 + r + tail` with |r| <= ~pi/4 and |tail| <= ULP(r)/2,
+// where only the quadrant modulo 4 is kept (as an integral value in [-2, 2])
+template<typename T>
+struct reduced_angle {
+  T r;
+  T tail;
+  T quadrant;
+};
+
+/**
+ * @brief Reduces an angle expressed in a unit of the magnitude `ToRadian` (relative to a radian)
+ *
+ * When a quarter of a revolution is a rational number of such units, the reduction is exact in
+ * the original unit and only the reduced angle is scaled to radians (with a two-part constant).
+ * Otherwise, the angle is scaled to radians and reduced with a three-part Cody-Waite split.
+ * The `tail` keeps the rounding error of the result for the kernels of `ulp_accuracy`.
+ */
+template<UnitMagnitude auto ToRadian, typename T>
+MP_UNITS_ALWAYS_INLINE [[nodiscard]] inline reduced_angle<T> reduce_angle(T x)
+{
+  constexpr UnitMagnitude auto quarter_mag = mag_ratio<1, 2> * mag<pi_c> / ToRadian;
+  T r;
+  T tail;
+  T k;
+  if constexpr (is_rational(quarter_mag)) {
+    constexpr T quarter = get_value<T>(quarter_mag);
+    constexpr T inv_quarter = get_value<T>(mag<1> / quarter_mag);
+    constexpr long double to_rad = get_value<long double>(ToRadian);
+    constexpr T to_rad_hi = static_cast<T>(to_rad);
+    constexpr T to_rad_lo = static_cast<T>(to_rad - static_cast<long double>(to_rad_hi));
+    k = std::rint(x * inv_quarter);
+    const T angle = x - k * quarter;
+    r = angle * to_rad_hi;
+    tail = product_error(angle, to_rad_hi, r) + angle * to_rad_lo;
+  } else {
+    using c = trig_constants<T>;
+    if constexpr (ToRadian != mag<1>) x *= get_value<T>(ToRadian);
+    k = std::rint(x * c::two_over_pi);
+    const T t = x - k * c::pio2_1;
+    const T w = k * c::pio2_2;
+    r = t - w;
+    tail = ((t - r) - w) - k * c::pio2_3;
+  }
+  const T hi = r + tail;
+  // `k mod 4` is computed exactly in floating point, which keeps the loops over `reduce_angle` free of
+  // integer conversions (`rint` rather than `floor`, which compilers vectorize only without trapping math)
+  return {hi, (r - hi) + tail, k - T{4} * std::rint(k * T(0.25))};
+}
+
+// The largest magnitude of an argument in the original unit that `reduce_angle` handles
+// within the accuracy of `ulp_accuracy`
+template<UnitMagnitude auto ToRadian, typename T>
+[[nodiscard]] consteval T max_reducible_angle()
+{
+  constexpr UnitMagnitude auto quarter_mag = mag_ratio<1, 2> * mag<pi_c> / ToRadian;
+  if constexpr (is_rational(quarter_mag))
+    return get_value<T>(quarter_mag) * T{0x1p40};
+  else
+    return get_value<T>(mag_ratio<1, 2> * mag<pi_c>) * trig_constants<T>::max_quadrant /
+           get_value<T>(ToRadian);
+}
+
+// sin and cos of |x + y| <= ~pi/4 within 1 ULP (fdlibm `__kernel_sin` and `__kernel_cos`)
+MP_UNITS_ALWAYS_INLINE [[nodiscard]] inline double sin_kernel_ulp(double x, double y)
+{
+  constexpr double s1 = -1.66666666666666324348e-01;
+  constexpr double s2 = 8.33333333332248946124e-03;
+  constexpr double s3 = -1.98412698298579493134e-04;
+  constexpr double s4 = 2.75573137070700676789e-06;
+  constexpr double s5 = -2.50507602534068634195e-08;
+  constexpr double s6 = 1.58969099521155010221e-10;
+  const double z = x * x;
+  const double v = z * x;
+  const double r = s2 + z * (s3 + z * (s4 + z * (s5 + z * s6)));
+  return x - ((z * (0.5 * y - v * r) - y) - v * s1);
+}
+
+MP_UNITS_ALWAYS_INLINE [[nodiscard]] inline double cos_kernel_ulp(double x, double y)
+{
+  constexpr double c1 = 4.16666666666666019037e-02;
+  constexpr double c2 = -1.38888888888741095749e-03;
+  constexpr double c3 = 2.48015872894767294178e-05;
+  constexpr double c4 = -2.75573143513906633035e-07;
+  constexpr double c5 = 2.08757232129817482790e-09;
+  constexpr double c6 = -1.13596475577881948265e-11;
+  const double z = x * x;
+  const double r = z * (c1 + z * (c2 + z * (c3 + z * (c4 + z * (c5 + z * c6)))));
+  const double hz = 0.5 * z;
+  const double w = 1.0 - hz;
+  return w + (((1.0 - w) - hz) + (z * r - x * y));
+}
+
+// sin and cos of |x| <= ~pi/4 with an error of about 1e-7 (Cephes `sinf` and `cosf`)
+template<typename T>
+MP_UNITS_ALWAYS_INLINE [[nodiscard]] inline T sin_kernel_fast(T x)
+{
+  const T z = x * x;
+  return x + z * x * (T(-1.6666654611e-1) + z * (T(8.3321608736e-3) + z * T(-1.9515295891e-4)));
+}
+
+template<typename T>
+MP_UNITS_ALWAYS_INLINE [[nodiscard]] inline T cos_kernel_fast(T x)
+{
+  const T z = x * x;
+  return T{1} - T(0.5) * z +
+         z * z * (T(4.166664568298827e-2) + z * (T(-1.388731625493765e-3) + z * T(2.443315711809948e-5)));
+}
+
+template<typename T>
+struct sin_cos_result {
+  T sin;
+  T cos;
+};
+
+/**
+ * @brief sin and cos of an angle expressed in a unit of the magnitude `ToRadian`
+ *
+ * Both values are computed from one reduction. The quadrant selects between the two kernels
+ * and their signs without branching. The sign is flipped with a subtraction from zero, so that
+ * the exact zeros (e.g. `sin(180 deg)`) are positive as in the standard library.
+ */
+template<UnitMagnitude auto ToRadian, MathAccuracy Accuracy, KernelFloatingPoint T>
+MP_UNITS_ALWAYS_INLINE [[nodiscard]] inline sin_cos_result<T> sin_cos(T x)
+{
+  if constexpr (std::is_same_v<Accuracy, fast_accuracy_t>) {
+    const reduced_angle<T> a = reduce_angle<ToRadian>(x);
+    const T s = sin_kernel_fast(a.r);
+    const T c = cos_kernel_fast(a.r);
+    // quadrants 1 and 3 swap the kernels, 2 and 3 negate sin, 1 and 2 negate cos (`|` avoids branches)
+    const bool swap = (std::abs(a.quadrant) > T(0.5)) & (std::abs(a.quadrant) < T(1.5));
+    const T sin = blend(swap, c, s);
+    const T cos = blend(swap, s, c);
+    return {blend((a.quadrant > T{1}) | (a.quadrant < T(-0.5)), -sin, sin),
+            blend((a.quadrant > T(0.5)) | (a.quadrant < T(-1.5)), -cos, cos)};
+  } else {
+    // `float` is reduced and evaluated in `double` to stay within 1 ULP after the final rounding
+    if (!(std::abs(x) <= max_reducible_angle<ToRadian, T>())) {
+      const T rad = x * get_value<T>(ToRadian);
+      return {std::sin(rad), std::cos(rad)};
+    }
+    const reduced_angle<double> a = reduce_angle<ToRadian>(static_cast<double>(x));
+    const double s = sin_kernel_ulp(a.r, a.tail);
+    const double c = cos_kernel_ulp(a.r, a.tail);
+    const auto quadrant = static_cast<std::int32_t>(a.quadrant);
+    const bool swap = (quadrant & 1) != 0;
+    const double sin = swap ? c : s;
+    const double cos = swap ? s : c;
+    return {static_cast<T>((quadrant & 2) != 0 ? 0. - sin : sin),
+            static_cast<T>(((quadrant + 1) & 2) != 0 ? 0. - cos : cos)};
+  }
+}
+
+// atan of 0 <= x <= 1 within 1 ULP (fdlibm `atan` reduced to the first two intervals)
+MP_UNITS_ALWAYS_INLINE [[nodiscard]] inline double atan_unit_ulp(double x)
+{
+  constexpr double at[] = {3.33333333333329318027e-01,  -1.99999999998764832476e-01, 1.42857142725034663711e-01,
+                           -1.11111104054623557880e-01, 9.09088713343650656196e-02,  -7.69187620504482999495e-02,
+                           6.66107313738753120669e-02,  -5.83357013379057348645e-02, 4.97687799461593236017e-02,
+                           -3.65315727442169155270e-02, 1.62858201153657823623e-02};
+  constexpr double atan_half_hi = 4.63647609000806093515e-01;
+  constexpr double atan_half_lo = 2.26987774529616870924e-17;
+  constexpr double atan_one_hi = 7.85398163397448278999e-01;
+  constexpr double atan_one_lo = 3.06161699786838301793e-17;
+
+  // atan(x) = atan(c) + atan((x - c) / (1 + x * c)) for c = 0, 1/2, or 1
+  const int id = x < 0.4375 ? -1 : (x < 0.6875 ? 0 : 1);
+  if (id == 0)
+    x = (2.0 * x - 1.0) / (2.0 + x);
+  else if (id == 1)
+    x = (x - 1.0) / (x + 1.0);
+  const double z = x * x;
+  const double w = z * z;
+  const double s1 = z * (at[0] + w * (at[2] + w * (at[4] + w * (at[6] + w * (at[8] + w * at[10])))));
+  const double s2 = w * (at[1] + w * (at[3] + w * (at[5] + w * (at[7] + w * at[9]))));
+  if (id < 0) return x - x * (s1 + s2);
+  if (id == 0) return atan_half_hi - ((x * (s1 + s2) - atan_half_lo) - x);
+  return atan_one_hi - ((x * (s1 + s2) - atan_one_lo) - x);
+}
+
+// atan of 0 <= x <= 1 with an error of about 1e-7 (Cephes `atanf`)
+template<KernelFloatingPoint T>
+MP_UNITS_ALWAYS_INLINE [[nodiscard]] inline T atan_unit_fast(T x)
+{
+  constexpr T tan_pi_8 = T(0.4142135623730950488);
+  const bool shift = x > tan_pi_8;
+  const T t = blend(shift, (x - T{1}) / (x + T{1}), x);
+  const T z = t * t;
+  const T p =
+    (((T(8.05374449538e-2) * z - T(1.38776856032e-1)) * z + T(1.99777106478e-1)) * z - T(3.33329491539e-1)) * z * t +
+    t;
+  return blend(shift, T(0.78539816339744830962) + p, p);
+}
+
+/**
+ * @brief atan2 in radians
+ *
+ * The angle of the ratio of the smaller and the larger magnitude is computed in the first octant
+ * and moved to the right one with selects on the signs and the order of the arguments.
+ */
+template<MathAccuracy Accuracy, KernelFloatingPoint T>
+MP_UNITS_ALWAYS_INLINE [[nodiscard]] inline T atan2(T y, T x)
+{
+  const T ax = std::abs(x);
+  const T ay = std::abs(y);
+  const bool swap = ay > ax;
+  const T num = swap ? ax : ay;
+  const T den = swap ? ay : ax;
+  if constexpr (std::is_same_v<Accuracy, fast_accuracy_t>) {
+    constexpr T pi_2 = T(1.57079632679489661923);
+    constexpr T pi = T(3.14159265358979323846);
+    // `num` is zero whenever `den` is
+    const T a = atan_unit_fast(num / blend(den == T{0}, T{1}, den));
+    const T a_first = blend(swap, pi_2 - a, a);
+    return std::copysign(blend(x < T{0}, pi - a_first, a_first), y);
+  } else {
+    if (!(std::isfinite(x) && std::isfinite(y)) || den == T{0}) return std::atan2(y, x);
+    constexpr double pi_2_hi = 1.57079632679489655800e+00;
+    constexpr double pi_2_lo = 6.12323399573676603587e-17;
+    constexpr double pi_hi = 3.14159265358979311600e+00;
+    constexpr double pi_lo = 1.22464679914735317720e-16;
+    // atan(t + t_lo) = atan(t) + t_lo / (1 + t^2), where t_lo is the rounding error of the division
+    const auto n = static_cast<double>(num);
+    const auto d = static_cast<double>(den);
+    const double t = n / d;
+    const double p = t * d;
+    const double c = ((n - p) - product_error(t, d, p)) / d / (1.0 + t * t);
+    const double at = atan_unit_ulp(t);
+    double a;
+    if (x < T{0})
+      a = swap ? (pi_2_hi + at) + (pi_2_lo + c) : (pi_hi - at) + (pi_lo - c);
+    else
+      a = swap ? (pi_2_hi - at) + (pi_2_lo - c) : at + c;
+    return static_cast<T>(std::copysign(a, static_cast<double>(y)));
+  }
+}
+
+/**
+ * @brief hypot without the intermediate overflow and underflow protection of `std::hypot`
+ *
+ * `ulp_accuracy` squares `float` arguments in `double`. For `double` arguments, it keeps the
+ * rounding errors of the squares and of their sum (Dekker), and corrects the square root with
+ * one Newton step. It falls back to `std::hypot` when the squares could overflow or underflow,
+ * both arguments are zero, or an argument is not finite.
+ */
+template<MathAccuracy Accuracy, KernelFloatingPoint T>
+MP_UNITS_ALWAYS_INLINE [[nodiscard]] inline T hypot(T x, T y)
+{
+  if constexpr (std::is_same_v<Accuracy, fast_accuracy_t>)
+    return std::sqrt(x * x + y * y);
+  else if constexpr (std::is_same_v<T, float>) {
+    const auto dx = static_cast<double>(x);
+    const auto dy = static_cast<double>(y);
+    return static_cast<float>(std::sqrt(dx * dx + dy * dy));
+  } else {
+    const double ax = std::abs(x);
+    const double ay = std::abs(y);
+    const double big = ax > ay ? ax : ay;
+    const double small = ax > ay ? ay : ax;
+    if (!(big >= 0x1p-500 && big <= 0x1p500)) return std::hypot(x, y);
+    // big^2 + small^2 as an unevaluated sum `sum + err`, and one Newton step of its square root
+    const double big_sq = big * big;
+    const double small_sq = small * small;
+    const double sum = big_sq + small_sq;
+    const double err =
+      ((big_sq - sum) + small_sq) + product_error(big, big, big_sq) + product_error(small, small, small_sq);
+    const double root = std::sqrt(sum);
+    const double root_sq = root * root;
+    return root + (((sum - root_sq) - product_error(root, root, root_sq)) + err) / (2. * root);
+  }
+}
+
+}  // namespace detail
+
+}  // namespace mp_units
@@ -22,6 +22,7 @@
 
 #pragma once
 
+#include <mp-units/bits/int_power.h>
 #include <mp-units/ext/type_traits.h>
 #include <mp-units/framework/quantity_concepts.h>
 #include <mp-units/framework/reference_concepts.h>
@@ -34,7 +35,14 @@
 #ifdef MP_UNITS_IMPORT_STD
 import std;
 #else
+#include <cstdint>
+#include <limits>
+#include <numeric>
+#include <optional>
 #include <type_traits>
+#if MP_UNITS_HOSTED
+#include <cmath>
+#endif
 #endif
 #endif
 
@@ -110,6 +118,191 @@ template<Quantity To, rounding_mode Mode = rounding_mode::truncated, typename Fw
 }
 
 
+/**
+ * @brief `x * a + b` rounded once where the hardware has a fast fused multiply-add
+ *
+ * `std::fma` is only used when `FP_FAST_FMA*` reports it as at least as fast as a multiplication
+ * followed by an addition; otherwise (and in constant evaluation) it would be a slow library call.
+ *
+ * @note On such targets the constant-evaluated result (`x * a + b`, rounded twice) may differ in
+ *       the last bit from the runtime one (rounded once).
+ */
+template<std::floating_point T>
+[[nodiscard]] constexpr T fused_multiply_add(T x, T a, T b)
+{
+#if MP_UNITS_HOSTED
+  if (!std::is_constant_evaluated()) {
+#if defined FP_FAST_FMAF
+    if constexpr (std::is_same_v<T, float>) return std::fma(x, a, b);
+#endif
+#if defined FP_FAST_FMA
+    if constexpr (std::is_same_v<T, double>) return std::fma(x, a, b);
+#endif
+#if defined FP_FAST_FMAL
+    if constexpr (std::is_same_v<T, long double>) return std::fma(x, a, b);
+#endif
+  }
+#endif
+  return x * a + b;
+}
+
+/**
+ * @brief The conversion of a quantity point to another origin and unit as one affine map
+ *
+ * A point measured from `FromQP::point_origin` in `FromQP::unit` is measured from
+ * `ToQP::point_origin` in `ToQP::unit` as `a * x + b`, where `a` is the magnitude between the
+ * units and `b` is the difference between the origins. Both are folded at compile time, including
+ * any chain of `relative_point_origin` offsets, so the conversion costs a single multiply-add.
+ *
+ * Whenever the magnitudes are rational and the offset is integral, the map is used in its exact
+ * form `(x * mul + add) / div`, where `x * mul + add` is the result expressed in `ToQP::unit / div`
+ * (e.g. `(x * 20 - 5463) / 20` from `K` to `℃`). Integral representations evaluate it in the wider
+ * integer type and round once, instead of once for the scaling and once more for the offset.
+ * Floating-point ones evaluate it as `fused_multiply_add(x, mul, add)` followed by the division
+ * only when `div != 1`, which keeps offsets such as `273.15 K` exact; otherwise as
+ * `fused_multiply_add(x, a, b)`. Where the target has a fast FMA, a floating-point conversion
+ * evaluated at compile time (e.g. in a `static_assert`) may therefore differ in the last bit from
+ * the same conversion evaluated at runtime; integral ones are exact in both.
+ *
+ * `fusable` is `false` for representation types other than the arithmetic ones, and for integral
+ * representations when no exact form exists (irrational magnitudes, offsets with a floating-point
+ * representation, or coefficients too large for the wider integer type).
+ */
+template<QuantityPoint FromQP, QuantityPoint ToQP>
+struct affine_point_conversion {
+  using from_rep = FromQP::rep;
+  using to_rep = ToQP::rep;
+  using c_type = conversion_type_traits<get_canonical_unit(FromQP::unit).mag / get_canonical_unit(ToQP::unit).mag,
+                                        from_rep, to_rep>::c_type;
+
+  static constexpr UnitMagnitude auto scale =
+    get_canonical_unit(FromQP::unit).mag / get_canonical_unit(ToQP::unit).mag;
+  static constexpr Quantity auto offset = FromQP::point_origin - ToQP::point_origin;
+  static constexpr auto offset_value = offset.numerical_value_is_an_implementation_detail_;
+  static constexpr UnitMagnitude auto offset_scale =
+    get_canonical_unit(decltype(offset)::unit).mag / get_canonical_unit(ToQP::unit).mag;
+
+  struct integral_coefficients {
+    std::int64_t mul = 1;
+    std::int64_t add = 0;
+    std::int64_t div = 1;
+    bool valid = false;
+  };
+
+  // The largest coefficient that is used; leaves a bit of headroom in the wider integer type
+  static constexpr auto coefficient_max = static_cast<std::uint64_t>(std::numeric_limits<std::int64_t>::max() / 2);
+
+  [[nodiscard]] static consteval integral_coefficients get_integral_coefficients()
+  {
+    if constexpr (!std::integral<MP_UNITS_NONCONST_TYPE(offset_value)> || !is_rational(scale) ||
+                  !is_rational(offset_scale))
+      return {};
+    else {
+      // scale = num / den, offset = offset_value * offset_num / offset_den (in ToQP::unit)
+      constexpr std::optional<std::uint64_t> values[] = {
+        try_get_value<std::uint64_t>(numerator(scale)), try_get_value<std::uint64_t>(denominator(scale)),
+        try_get_value<std::uint64_t>(numerator(offset_scale)), try_get_value<std::uint64_t>(denominator(offset_scale))};
+      for (const auto& value : values)
+        if (!value || *value > coefficient_max) return {};
+      const auto fits = [](long double x) {
+        return -static_cast<long double>(coefficient_max) <= x && x <= static_cast<long double>(coefficient_max);
+      };
+      const auto num = static_cast<std::int64_t>(*values[0]);
+      const auto den = static_cast<std::int64_t>(*values[1]);
+      if (!fits(static_cast<long double>(offset_value) * static_cast<long double>(*values[2]))) return {};
+      std::int64_t add_num = static_cast<std::int64_t>(offset_value) * static_cast<std::int64_t>(*values[2]);
+      std::int64_t add_den = static_cast<std::int64_t>(*values[3]);
+      const std::int64_t g = std::gcd(add_num, add_den);
+      if (g != 0) {
+        add_num /= g;
+        add_den /= g;
+      }
+      if (!fits(static_cast<long double>(den) / static_cast<long double>(std::gcd(den, add_den)) *
+                static_cast<long double>(add_den)))
+        return {};
+      const std::int64_t div = std::lcm(den, add_den);
+      if (!fits(static_cast<long double>(num) * static_cast<long double>(div / den)) ||
+          !fits(static_cast<long double>(add_num) * static_cast<long double>(div / add_den)))
+        return {};
+      return {num * (div / den), add_num * (div / add_den), div, true};
+    }
+  }
+
+  static constexpr integral_coefficients integral = get_integral_coefficients();
+
+  // `x * mul + add` has to fit in the wider integer type for every `x`
+  using integral_rep = std::common_type_t<std::conditional_t<std::integral<from_rep>, from_rep, int>,
+                                          std::conditional_t<std::integral<to_rep>, to_rep, int>>;
+  using wide_type = wider_int_for<std::make_signed_t<integral_rep>>;
+  static constexpr bool integral_in_range = [] {
+    if constexpr (!std::integral<from_rep>)
+      return false;
+    else {
+      constexpr long double wide_max = int_power<long double>(2, sizeof(wide_type) * 8 - 2);
+      constexpr long double x_max = std::numeric_limits<from_rep>::max();
+      constexpr long double add_max = static_cast<long double>(integral.add < 0 ? -integral.add : integral.add);
+      return x_max * static_cast<long double>(integral.mul) + add_max < wide_max;
+    }
+  }();
+
+  static constexpr bool floating = std::floating_point<c_type>;
+  // whether the integral coefficients are also exact in the floating-point type
+  static constexpr bool exact_in_floating = [] {
+    if constexpr (!floating)
+      return false;
+    else {
+      constexpr int digits = std::numeric_limits<c_type>::digits < 62 ? std::numeric_limits<c_type>::digits : 62;
+      constexpr auto exact_max = static_cast<std::int64_t>(1) << digits;
+      const auto abs = [](std::int64_t x) { return x < 0 ? -x : x; };
+      return integral.valid && abs(integral.mul) <= exact_max && abs(integral.add) <= exact_max &&
+             integral.div <= exact_max;
+    }
+  }();
+  static constexpr bool fusable =
+    std::is_arithmetic_v<from_rep> && std::is_arithmetic_v<to_rep> &&
+    (floating || (std::integral<from_rep> && std::integral<to_rep> && integral.valid && integral_in_range));
+
+  template<rounding_mode Mode>
+  [[nodiscard]] static constexpr to_rep apply(from_rep x)
+  {
+    static_assert(fusable);
+    if constexpr (floating) {
+      const c_type y = [&] {
+        if constexpr (exact_in_floating) {
+          // integral coefficients are exact, so only the final division (if any) rounds again
+          constexpr auto mul = static_cast<c_type>(integral.mul);
+          constexpr auto add = static_cast<c_type>(integral.add);
+          const c_type r = fused_multiply_add(static_cast<c_type>(x), mul, add);
+          if constexpr (integral.div == 1)
+            return r;
+          else
+            return r / static_cast<c_type>(integral.div);
+        } else {
+          constexpr c_type a = silent_cast<c_type>(get_value<long double>(scale));
+          constexpr c_type b =
+            silent_cast<c_type>(static_cast<long double>(offset_value) * get_value<long double>(offset_scale));
+          return fused_multiply_add(static_cast<c_type>(x), a, b);
+        }
+      }();
+      if constexpr (Mode == rounding_mode::truncated || !treat_as_integral<to_rep>)
+        return silent_cast<to_rep>(y);
+      else
+        return silent_cast<to_rep>(round_fp<Mode>(y));
+    } else {
+      const wide_type y = static_cast<wide_type>(x) * wide_type{integral.mul} + wide_type{integral.add};
+      if constexpr (integral.div == 1)
+        return silent_cast<to_rep>(y);
+      else
+        return silent_cast<to_rep>(div_round<Mode>(y, wide_type{integral.div}));
+    }
+  }
+};
+
+template<typename FromQP, typename ToQP>
+concept FusableAffinePointConversion =
+  (!std::is_same_v<MP_UNITS_NONCONST_TYPE(FromQP::point_origin), MP_UNITS_NONCONST_TYPE(ToQP::point_origin)>) &&
+  requires { FromQP::point_origin - ToQP::point_origin; } && affine_point_conversion<FromQP, ToQP>::fusable;
+
 /**
  * @brief Explicit cast between different quantity_point types
  *
@@ -127,8 +320,14 @@ template<QuantityPoint ToQP, rounding_mode Mode = rounding_mode::truncated, type
            (!equivalent(FromQP::unit, ToQP::unit)))
 [[nodiscard]] constexpr QuantityPoint auto sudo_cast(FwdFromQP&& qp)
 {
-  if constexpr (std::is_same_v<MP_UNITS_NONCONST_TYPE(ToQP::point_origin),
-                               MP_UNITS_NONCONST_TYPE(FromQP::point_origin)>) {
+  if constexpr (FusableAffinePointConversion<FromQP, ToQP>) {
+    // Arithmetic representations: the offset and the scaling folded into a single multiply-add
+    const auto x =
+      std::forward<FwdFromQP>(qp).quantity_from(FromQP::point_origin).numerical_value_is_an_implementation_detail_;
+    return quantity_point{quantity{affine_point_conversion<FromQP, ToQP>::template apply<Mode>(x), ToQP::reference},
+                          ToQP::point_origin};
+  } else if constexpr (std::is_same_v<MP_UNITS_NONCONST_TYPE(ToQP::point_origin),
+                                      MP_UNITS_NONCONST_TYPE(FromQP::point_origin)>) {
     // Same origin: delegate entirely to the quantity sudo_cast — no offset arithmetic needed.
     return quantity_point{
       sudo_cast<typename ToQP::quantity_type, Mode>(std::forward<FwdFromQP>(qp).quantity_from(FromQP::point_origin)),
@@ -206,8 +405,8 @@ template<QuantityPoint ToQP, rounding_mode Mode = rounding_mode::truncated, type
       constexpr long double offset_in_output_ld =
         offset_as(std::type_identity<quantity<output_unit_ref, long double>>{}).numerical_value_in(ToQP::unit);
       constexpr bool offset_fits_in_output =
-        offset_in_output_ld >= static_cast<long double>(std::numeric_limits<c_rep_type>::min()) &&
-        offset_in_output_ld <= static_cast<long double>(std::numeric_limits<c_rep_type>::max());
+        offset_in_output_ld >= static_cast<long double>(std::numeric_limits<value_type_t<c_rep_type>>::min()) &&
+        offset_in_output_ld <= static_cast<long double>(std::numeric_limits<value_type_t<c_rep_type>>::max());
       if constexpr (offset_fits_in_output) {
         using intermediate_type = quantity<output_unit_ref, c_rep_type>;
         constexpr auto offset = offset_as(std::type_identity<intermediate_type>{});
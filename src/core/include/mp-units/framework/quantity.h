@@ -49,6 +49,7 @@
 #ifdef MP_UNITS_IMPORT_STD
 import std;
 #else
+#include <atomic>
 #include <compare>  // IWYU pragma: export
 #include <concepts>
 #include <functional>
@@ -1124,6 +1125,264 @@ public:
   }
 };
 
+namespace mp_units::detail {
+
+// Representations for which `std::atomic<Rep>` provides arithmetic (`fetch_add`/`fetch_sub`).
+template<typename Rep>
+concept AtomicArithmeticRep = std::is_arithmetic_v<Rep> && !std::is_same_v<Rep, bool>;
+
+// `Atomic` is either `std::atomic<Rep>` or `std::atomic_ref<Rep>`. Integers always map to the native
+// atomic add; floating-point types use the C++20 floating-point `fetch_add` when the library provides
+// it and fall back to a CAS loop otherwise.
+template<typename Atomic, typename Rep>
+Rep atomic_fetch_add(Atomic& a, Rep arg, std::memory_order order) noexcept
+{
+#if __cpp_lib_atomic_float
+  return a.fetch_add(arg, order);
+#else
+  if constexpr (std::is_integral_v<Rep>)
+    return a.fetch_add(arg, order);
+  else {
+    Rep expected = a.load(std::memory_order_relaxed);
+    while (!a.compare_exchange_weak(expected, static_cast<Rep>(expected + arg), order, std::memory_order_relaxed)) {
+    }
+    return expected;
+  }
+#endif
+}
+
+template<typename Atomic, typename Rep>
+Rep atomic_fetch_sub(Atomic& a, Rep arg, std::memory_order order) noexcept
+{
+#if __cpp_lib_atomic_float
+  return a.fetch_sub(arg, order);
+#else
+  if constexpr (std::is_integral_v<Rep>)
+    return a.fetch_sub(arg, order);
+  else {
+    Rep expected = a.load(std::memory_order_relaxed);
+    while (!a.compare_exchange_weak(expected, static_cast<Rep>(expected - arg), order, std::memory_order_relaxed)) {
+    }
+    return expected;
+  }
+#endif
+}
+
+}  // namespace mp_units::detail
+
+// Atomic quantity with unit-checked arithmetic. It wraps `std::atomic<Rep>`, so it is lock-free
+// whenever the representation's atomic is. Operands of `fetch_add`/`fetch_sub` are taken as
+// `value_type`, so only quantities implicitly convertible to this one (same kind and a
+// non-truncating unit) are accepted, and the conversion happens before the atomic operation.
+template<auto R, mp_units::detail::AtomicArithmeticRep Rep>
+struct std::atomic<mp_units::quantity<R, Rep>> {
+  using value_type = mp_units::quantity<R, Rep>;
+  using difference_type = value_type;
+
+  static constexpr bool is_always_lock_free = std::atomic<Rep>::is_always_lock_free;
+
+  constexpr atomic() noexcept = default;
+  constexpr atomic(value_type desired) noexcept : value_(desired.numerical_value_is_an_implementation_detail_) {}
+  atomic(const atomic&) = delete;
+  atomic& operator=(const atomic&) = delete;
+
+  value_type operator=(value_type desired) noexcept
+  {
+    store(desired);
+    return desired;
+  }
+
+  [[nodiscard]] bool is_lock_free() const noexcept { return value_.is_lock_free(); }
+
+  void store(value_type desired, std::memory_order order = std::memory_order_seq_cst) noexcept
+  {
+    value_.store(desired.numerical_value_is_an_implementation_detail_, order);
+  }
+
+  [[nodiscard]] value_type load(std::memory_order order = std::memory_order_seq_cst) const noexcept
+  {
+    return {value_.load(order), R};
+  }
+
+  operator value_type() const noexcept { return load(); }
+
+  value_type exchange(value_type desired, std::memory_order order = std::memory_order_seq_cst) noexcept
+  {
+    return {value_.exchange(desired.numerical_value_is_an_implementation_detail_, order), R};
+  }
+
+  bool compare_exchange_weak(value_type& expected, value_type desired, std::memory_order success,
+                             std::memory_order failure) noexcept
+  {
+    return value_.compare_exchange_weak(expected.numerical_value_is_an_implementation_detail_,
+                                        desired.numerical_value_is_an_implementation_detail_, success, failure);
+  }
+
+  bool compare_exchange_weak(value_type& expected, value_type desired,
+                             std::memory_order order = std::memory_order_seq_cst) noexcept
+  {
+    return value_.compare_exchange_weak(expected.numerical_value_is_an_implementation_detail_,
+                                        desired.numerical_value_is_an_implementation_detail_, order);
+  }
+
+  bool compare_exchange_strong(value_type& expected, value_type desired, std::memory_order success,
+                               std::memory_order failure) noexcept
+  {
+    return value_.compare_exchange_strong(expected.numerical_value_is_an_implementation_detail_,
+                                          desired.numerical_value_is_an_implementation_detail_, success, failure);
+  }
+
+  bool compare_exchange_strong(value_type& expected, value_type desired,
+                               std::memory_order order = std::memory_order_seq_cst) noexcept
+  {
+    return value_.compare_exchange_strong(expected.numerical_value_is_an_implementation_detail_,
+                                          desired.numerical_value_is_an_implementation_detail_, order);
+  }
+
+#if __cpp_lib_atomic_wait
+  void wait(value_type old, std::memory_order order = std::memory_order_seq_cst) const noexcept
+  {
+    value_.wait(old.numerical_value_is_an_implementation_detail_, order);
+  }
+
+  void notify_one() noexcept { value_.notify_one(); }
+  void notify_all() noexcept { value_.notify_all(); }
+#endif
+
+  value_type fetch_add(value_type arg, std::memory_order order = std::memory_order_seq_cst) noexcept
+  {
+    return {mp_units::detail::atomic_fetch_add(value_, arg.numerical_value_is_an_implementation_detail_, order), R};
+  }
+
+  value_type fetch_sub(value_type arg, std::memory_order order = std::memory_order_seq_cst) noexcept
+  {
+    return {mp_units::detail::atomic_fetch_sub(value_, arg.numerical_value_is_an_implementation_detail_, order), R};
+  }
+
+  value_type operator+=(value_type arg) noexcept
+  {
+    const Rep val = arg.numerical_value_is_an_implementation_detail_;
+    return {static_cast<Rep>(mp_units::detail::atomic_fetch_add(value_, val, std::memory_order_seq_cst) + val), R};
+  }
+
+  value_type operator-=(value_type arg) noexcept
+  {
+    const Rep val = arg.numerical_value_is_an_implementation_detail_;
+    return {static_cast<Rep>(mp_units::detail::atomic_fetch_sub(value_, val, std::memory_order_seq_cst) - val), R};
+  }
+
+private:
+  std::atomic<Rep> value_;
+};
+
+#if __cpp_lib_atomic_ref
+
+// Atomic view of an existing quantity object (e.g. an element of a `std::vector<quantity<...>>`).
+// A `quantity` has the size and alignment of its representation, so the view is applied directly
+// to the stored numerical value.
+template<auto R, mp_units::detail::AtomicArithmeticRep Rep>
+struct std::atomic_ref<mp_units::quantity<R, Rep>> {
+  using value_type = mp_units::quantity<R, Rep>;
+  using difference_type = value_type;
+
+  static constexpr bool is_always_lock_free = std::atomic_ref<Rep>::is_always_lock_free;
+  static constexpr std::size_t required_alignment = std::atomic_ref<Rep>::required_alignment;
+
+  explicit atomic_ref(value_type& q) : ref_(q.numerical_value_is_an_implementation_detail_) {}
+  atomic_ref(const atomic_ref&) noexcept = default;
+  atomic_ref& operator=(const atomic_ref&) = delete;
+
+  value_type operator=(value_type desired) const noexcept
+  {
+    store(desired);
+    return desired;
+  }
+
+  [[nodiscard]] bool is_lock_free() const noexcept { return ref_.is_lock_free(); }
+
+  void store(value_type desired, std::memory_order order = std::memory_order_seq_cst) const noexcept
+  {
+    ref_.store(desired.numerical_value_is_an_implementation_detail_, order);
+  }
+
+  [[nodiscard]] value_type load(std::memory_order order = std::memory_order_seq_cst) const noexcept
+  {
+    return {ref_.load(order), R};
+  }
+
+  operator value_type() const noexcept { return load(); }
+
+  value_type exchange(value_type desired, std::memory_order order = std::memory_order_seq_cst) const noexcept
+  {
+    return {ref_.exchange(desired.numerical_value_is_an_implementation_detail_, order), R};
+  }
+
+  bool compare_exchange_weak(value_type& expected, value_type desired, std::memory_order success,
+                             std::memory_order failure) const noexcept
+  {
+    return ref_.compare_exchange_weak(expected.numerical_value_is_an_implementation_detail_,
+                                      desired.numerical_value_is_an_implementation_detail_, success, failure);
+  }
+
+  bool compare_exchange_weak(value_type& expected, value_type desired,
+                             std::memory_order order = std::memory_order_seq_cst) const noexcept
+  {
+    return ref_.compare_exchange_weak(expected.numerical_value_is_an_implementation_detail_,
+                                      desired.numerical_value_is_an_implementation_detail_, order);
+  }
+
+  bool compare_exchange_strong(value_type& expected, value_type desired, std::memory_order success,
+                               std::memory_order failure) const noexcept
+  {
+    return ref_.compare_exchange_strong(expected.numerical_value_is_an_implementation_detail_,
+                                        desired.numerical_value_is_an_implementation_detail_, success, failure);
+  }
+
+  bool compare_exchange_strong(value_type& expected, value_type desired,
+                               std::memory_order order = std::memory_order_seq_cst) const noexcept
+  {
+    return ref_.compare_exchange_strong(expected.numerical_value_is_an_implementation_detail_,
+                                        desired.numerical_value_is_an_implementation_detail_, order);
+  }
+
+#if __cpp_lib_atomic_wait
+  void wait(value_type old, std::memory_order order = std::memory_order_seq_cst) const noexcept
+  {
+    ref_.wait(old.numerical_value_is_an_implementation_detail_, order);
+  }
+
+  void notify_one() const noexcept { ref_.notify_one(); }
+  void notify_all() const noexcept { ref_.notify_all(); }
+#endif
+
+  value_type fetch_add(value_type arg, std::memory_order order = std::memory_order_seq_cst) const noexcept
+  {
+    return {mp_units::detail::atomic_fetch_add(ref_, arg.numerical_value_is_an_implementation_detail_, order), R};
+  }
+
+  value_type fetch_sub(value_type arg, std::memory_order order = std::memory_order_seq_cst) const noexcept
+  {
+    return {mp_units::detail::atomic_fetch_sub(ref_, arg.numerical_value_is_an_implementation_detail_, order), R};
+  }
+
+  value_type operator+=(value_type arg) const noexcept
+  {
+    const Rep val = arg.numerical_value_is_an_implementation_detail_;
+    return {static_cast<Rep>(mp_units::detail::atomic_fetch_add(ref_, val, std::memory_order_seq_cst) + val), R};
+  }
+
+  value_type operator-=(value_type arg) const noexcept
+  {
+    const Rep val = arg.numerical_value_is_an_implementation_detail_;
+    return {static_cast<Rep>(mp_units::detail::atomic_fetch_sub(ref_, val, std::memory_order_seq_cst) - val), R};
+  }
+
+private:
+  std::atomic_ref<Rep> ref_;
+};
+
+#endif  // __cpp_lib_atomic_ref
+
 #if MP_UNITS_HOSTED
 
 //
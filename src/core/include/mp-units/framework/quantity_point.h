@@ -39,8 +39,12 @@
 #ifdef MP_UNITS_IMPORT_STD
 import std;
 #else
+#include <array>
+#include <atomic>
 #include <compare>  // IWYU pragma: export
+#include <cstddef>
 #include <limits>
+#include <span>
 #include <type_traits>
 #endif
 #endif
@@ -379,15 +383,87 @@ template<PointOrigin PO>
     return off + bounds_offset(parent_po);
 }
 
+// True if the bounds that apply to PO (its own or those of its nearest bounded ancestor) are
+// wrapped in `deferred_bounds`.
+template<PointOrigin PO>
+[[nodiscard]] consteval bool has_deferred_bounds(PO)
+{
+  if constexpr (any_ancestor_has_bounds(PO{}))
+    return is_specialization_of<std::remove_cvref_t<decltype(bounds_po_for(PO{})._bounds_)>, deferred_bounds>;
+  else
+    return false;
+}
+
+// Per bounds-owning origin counters behind `deferred_bounds_stats`.
+template<PointOrigin auto BPO>
+struct deferred_bounds_counters {
+  static inline std::atomic<std::size_t> violations{0};
+  static inline std::atomic<std::size_t> elided_checks{0};
+};
+
+template<Quantity Q, typename B>
+[[nodiscard]] constexpr bool below_bound(const Q& q, const B& min)
+{
+  if constexpr (std::is_same_v<B, zero_quantity_t>)
+    return q < Q::zero();
+  else
+    return q < bound_as<rounded_up_t, Q>(min);
+}
+
+template<Quantity Q, typename B>
+[[nodiscard]] constexpr bool above_bound(const Q& q, const B& max)
+{
+  return q > bound_as<rounded_down_t, Q>(max);
+}
+
+// True if q (expressed in the frame of the bounds owner BPO) is outside the declared range of
+// its policy.
+template<PointOrigin auto BPO, Quantity Q>
+[[nodiscard]] constexpr bool outside_origin_bounds(const Q& q)
+{
+  bool out = false;
+  if constexpr (requires { BPO._bounds_.min; }) out = below_bound(q, BPO._bounds_.min);
+  if constexpr (requires { BPO._bounds_.max; }) out = out || above_bound(q, BPO._bounds_.max);
+  return out;
+}
+
+template<PointOrigin auto BPO>
+void count_deferred_violations(std::size_t n) noexcept
+{
+  if (n != 0) deferred_bounds_counters<BPO>::violations.fetch_add(n, std::memory_order_relaxed);
+}
+
+// Applies the bounds policy of the bounds owner BPO to q (expressed in BPO's frame). With
+// `CountViolations`, deferred policies also count the violation, if any: a value outside the
+// declared range, or one the policy had to change (e.g. `max` itself for the half-open range of
+// `wrap_to_range`). The count is taken before the policy runs, so that a throwing handler does
+// not lose it. Only the explicit materialization by `enforce_bounds()` counts, as plain reads do
+// not store the enforced value back and would count the same value again on every read.
+template<PointOrigin auto BPO, bool CountViolations = false, Quantity Q>
+constexpr Q apply_origin_bounds(const Q& q)
+{
+  if constexpr (CountViolations &&
+                is_specialization_of<std::remove_cvref_t<decltype(BPO._bounds_)>, deferred_bounds>) {
+    if (!std::is_constant_evaluated()) {
+      const bool out = outside_origin_bounds<BPO>(q);
+      count_deferred_violations<BPO>(out ? 1 : 0);
+      Q res = BPO._bounds_(q);
+      count_deferred_violations<BPO>(!out && !(res == q) ? 1 : 0);
+      return res;
+    }
+  }
+  return BPO._bounds_(q);
+}
+
 // Apply bounds to q (expressed relative to PO's origin frame).
 // Uses compile-time lookup to find the bounds owner and its offset from PO — at most a
 // single runtime translate/apply/un-translate with no recursive function calls.
-template<PointOrigin auto PO, auto R, typename Rep>
+template<PointOrigin auto PO, bool CountViolations = false, auto R, typename Rep>
 constexpr quantity<R, Rep> enforce_bounds(quantity<R, Rep> q)
 {
   if constexpr (HasQuantityBounds<std::remove_cvref_t<decltype(PO)>>) {
     // Direct bounds on PO — apply without any translation.
-    return PO._bounds_(q);
+    return apply_origin_bounds<PO, CountViolations>(q);
   } else if constexpr (any_ancestor_has_bounds(PO)) {
     // No direct bounds — locate the bounds-owning ancestor and its cumulative offset,
     // both resolved entirely at compile time.
@@ -398,7 +474,7 @@ constexpr quantity<R, Rep> enforce_bounds(quantity<R, Rep> q)
     // correct violation handler instead of falling back to MP_UNITS_PRECONDITION.
     const auto typed_off = value_cast<Rep>(off);
     // Single flat: translate to owner's frame, apply policy, translate back.
-    return bpo._bounds_(q + typed_off) - typed_off;
+    return apply_origin_bounds<bpo, CountViolations>(q + typed_off) - typed_off;
   } else {
     // No bounds anywhere in the chain — return q unchanged.  The explicit `else` is
     // important: MSVC Debug doesn't dead-code-eliminate after the always-returning
@@ -409,6 +485,113 @@ constexpr quantity<R, Rep> enforce_bounds(quantity<R, Rep> q)
   }
 }
 
+// Bounds enforcement after construction from a quantity and after mutating arithmetic. Skipped
+// for deferred bounds, which are enforced when the value is materialized instead; audit builds
+// count the checks skipped this way.
+template<PointOrigin auto PO, auto R, typename Rep>
+constexpr quantity<R, Rep> enforce_bounds_on_update(quantity<R, Rep> q)
+{
+  if constexpr (has_deferred_bounds(PO)) {
+#if MP_UNITS_API_BOUNDS_AUDIT
+    if (!std::is_constant_evaluated())
+      deferred_bounds_counters<bounds_po_for(PO)>::elided_checks.fetch_add(1, std::memory_order_relaxed);
+#endif
+    return q;
+  } else {
+    return enforce_bounds<PO>(q);
+  }
+}
+
+// The value of qp as seen by readers: the stored quantity, or a copy with deferred bounds
+// enforced.
+template<auto R, auto PO, typename Rep>
+[[nodiscard]] constexpr decltype(auto) materialized_quantity(const quantity_point<R, PO, Rep>& qp)
+{
+  if constexpr (has_deferred_bounds(PO))
+    return enforce_bounds<PO>(qp.quantity_ref_from(PO));
+  else
+    return qp.quantity_ref_from(PO);
+}
+
+// Applies `bounds` to a batch of quantities (or raw numerical values of V) through the policy's
+// batch form, or element by element for user-defined policies that do not provide one.
+template<Quantity V, typename Policy, typename T, std::size_t N>
+constexpr auto apply_bounds_batch(const Policy& bounds, std::span<T, N> vs)
+{
+  if constexpr (Quantity<T>) {
+    if constexpr (requires { bounds(vs); })
+      return bounds(vs);
+    else
+      for (T& v : vs) v = bounds(v);
+  } else {
+    if constexpr (requires { bounds(vs, V::reference); })
+      return bounds(vs, V::reference);
+    else
+      for (T& v : vs) v = bounds(V{v, V::reference}).numerical_value_is_an_implementation_detail_;
+  }
+}
+
+// Batch counterpart of `apply_origin_bounds` above, which always counts the violations of
+// deferred policies. The batch is processed in blocks that are copied before the policy runs, so
+// that the same violations as in the scalar case are counted while the policy keeps its batch form.
+template<PointOrigin auto BPO, Quantity V, typename T, std::size_t N>
+constexpr auto apply_origin_bounds_batch(std::span<T, N> vs)
+{
+  using result = decltype(apply_bounds_batch<V>(BPO._bounds_, vs));
+  if constexpr (is_specialization_of<std::remove_cvref_t<decltype(BPO._bounds_)>, deferred_bounds>) {
+    if (std::is_constant_evaluated()) return apply_bounds_batch<V>(BPO._bounds_, vs);
+    constexpr std::size_t block = 64;
+    std::array<std::remove_const_t<T>, block> before{};
+    std::array<bool, block> outside{};
+    std::size_t first_violation = vs.size();
+    for (std::size_t first = 0; first < vs.size(); first += block) {
+      const auto chunk = vs.subspan(first, vs.size() - first < block ? vs.size() - first : block);
+      std::size_t out = 0;
+      for (std::size_t i = 0; i < chunk.size(); ++i) {
+        before[i] = chunk[i];
+        outside[i] = outside_origin_bounds<BPO>(V{batch_value(before[i]), V::reference});
+        out += static_cast<std::size_t>(outside[i]);
+      }
+      count_deferred_violations<BPO>(out);
+      if constexpr (std::is_void_v<result>) {
+        apply_bounds_batch<V>(BPO._bounds_, chunk);
+      } else {
+        const std::size_t i = apply_bounds_batch<V>(BPO._bounds_, chunk);
+        if (i != chunk.size() && first_violation == vs.size()) first_violation = first + i;
+      }
+      std::size_t changed = 0;
+      for (std::size_t i = 0; i < chunk.size(); ++i)
+        changed += static_cast<std::size_t>(!outside[i] && !(batch_value(before[i]) == batch_value(chunk[i])));
+      count_deferred_violations<BPO>(changed);
+    }
+    if constexpr (!std::is_void_v<result>) return first_violation;
+  } else {
+    return apply_bounds_batch<V>(BPO._bounds_, vs);
+  }
+}
+
+// Batch counterpart of `enforce_bounds` above: the translation to the bounds owner's frame is
+// done for the whole batch before and after applying its policy.
+template<PointOrigin auto PO, Quantity V, typename T, std::size_t N>
+constexpr auto enforce_bounds_batch(std::span<T, N> vs)
+{
+  if constexpr (HasQuantityBounds<std::remove_cvref_t<decltype(PO)>>) {
+    return apply_origin_bounds_batch<PO, V>(vs);
+  } else if constexpr (any_ancestor_has_bounds(PO)) {
+    constexpr auto bpo = bounds_po_for(PO);
+    const auto off = batch_bound<V>(value_cast<typename V::rep>(bounds_offset(PO)));
+    for (T& v : vs) batch_value(v) += off;
+    if constexpr (std::is_void_v<decltype(apply_origin_bounds_batch<bpo, V>(vs))>) {
+      apply_origin_bounds_batch<bpo, V>(vs);
+      for (T& v : vs) batch_value(v) -= off;
+    } else {
+      const auto res = apply_origin_bounds_batch<bpo, V>(vs);
+      for (T& v : vs) batch_value(v) -= off;
+      return res;
+    }
+  }
+}
+
 // Hidden-friend interface for `quantity_point`. Provides heterogeneous binary and comparison
 // operators between any two `quantity_point<R1, PO1, Rep1>` and `quantity_point<R2, PO2, Rep2>`
 // specializations (and between a `quantity_point` and a `quantity` or a `PointOrigin`). Made
@@ -451,9 +634,9 @@ struct quantity_point_iface {
     requires requires { lhs.quantity_ref_from(PO1) - rhs.quantity_ref_from(QP2::point_origin); }
   {
     if constexpr (PO1 == QP2::point_origin)
-      return lhs.quantity_ref_from(PO1) - rhs.quantity_ref_from(QP2::point_origin);
+      return materialized_quantity(lhs) - materialized_quantity(rhs);
     else
-      return lhs.quantity_ref_from(PO1) - rhs.quantity_ref_from(QP2::point_origin) + (PO1 - QP2::point_origin);
+      return materialized_quantity(lhs) - materialized_quantity(rhs) + (PO1 - QP2::point_origin);
   }
 
   // operator- (qp - po)
@@ -463,17 +646,17 @@ struct quantity_point_iface {
   [[nodiscard]] friend constexpr Quantity auto operator-(const quantity_point<R1, PO1, Rep1>& qp, PO2 po)
   {
     if constexpr (PO1 == po)
-      return qp.quantity_ref_from(PO1);
+      return materialized_quantity(qp);
     else if constexpr (is_derived_from_specialization_of_v<PO2, ::mp_units::absolute_point_origin>) {
       if constexpr (PO1 == quantity_point<R1, PO1, Rep1>::absolute_point_origin)
-        return qp.quantity_ref_from(PO1);
+        return materialized_quantity(qp);
       else
-        return qp.quantity_ref_from(PO1) + (PO1 - quantity_point<R1, PO1, Rep1>::absolute_point_origin);
+        return materialized_quantity(qp) + (PO1 - quantity_point<R1, PO1, Rep1>::absolute_point_origin);
     } else {
       if constexpr (PO1 == po._quantity_point_.point_origin)
-        return qp.quantity_ref_from(PO1) - po._quantity_point_.quantity_ref_from(po._quantity_point_.point_origin);
+        return materialized_quantity(qp) - po._quantity_point_.quantity_ref_from(po._quantity_point_.point_origin);
       else
-        return qp.quantity_ref_from(PO1) - po._quantity_point_.quantity_ref_from(po._quantity_point_.point_origin) +
+        return materialized_quantity(qp) - po._quantity_point_.quantity_ref_from(po._quantity_point_.point_origin) +
                (PO1 - po._quantity_point_.point_origin);
     }
   }
@@ -493,7 +676,7 @@ struct quantity_point_iface {
   [[nodiscard]] friend constexpr bool operator==(const quantity_point<R1, PO1, Rep1>& lhs, const QP2& rhs)
   {
     if constexpr (PO1 == QP2::point_origin)
-      return lhs.quantity_ref_from(PO1) == rhs.quantity_ref_from(QP2::point_origin);
+      return materialized_quantity(lhs) == materialized_quantity(rhs);
     else
       return lhs - lhs.absolute_point_origin == rhs - rhs.absolute_point_origin;
   }
@@ -504,7 +687,7 @@ struct quantity_point_iface {
   [[nodiscard]] friend constexpr auto operator<=>(const quantity_point<R1, PO1, Rep1>& lhs, const QP2& rhs)
   {
     if constexpr (PO1 == QP2::point_origin)
-      return lhs.quantity_ref_from(PO1) <=> rhs.quantity_ref_from(QP2::point_origin);
+      return materialized_quantity(lhs) <=> materialized_quantity(rhs);
     else
       return lhs - lhs.absolute_point_origin <=> rhs - rhs.absolute_point_origin;
   }
@@ -607,7 +790,7 @@ public:
     requires std::constructible_from<quantity_type, FwdQ> && (point_origin == default_point_origin(R))
   [[nodiscard]] constexpr explicit quantity_point(FwdQ&& q) :
       quantity_from_origin_is_an_implementation_detail_(
-        detail::enforce_bounds<point_origin>(quantity_type{std::forward<FwdQ>(q)}))
+        detail::enforce_bounds_on_update<point_origin>(quantity_type{std::forward<FwdQ>(q)}))
   {
   }
 
@@ -615,7 +798,7 @@ public:
     requires std::constructible_from<quantity_type, FwdQ>
   [[nodiscard]] constexpr quantity_point(FwdQ&& q, decltype(PO)) :
       quantity_from_origin_is_an_implementation_detail_(
-        detail::enforce_bounds<point_origin>(quantity_type{std::forward<FwdQ>(q)}))
+        detail::enforce_bounds_on_update<point_origin>(quantity_type{std::forward<FwdQ>(q)}))
   {
   }
 
@@ -636,7 +819,7 @@ public:
     quantity_point(const QP& qp) :
       quantity_from_origin_is_an_implementation_detail_(detail::enforce_bounds<point_origin>([&] {
         if constexpr (point_origin == QP::point_origin)
-          return quantity_type{qp.quantity_ref_from(point_origin)};
+          return quantity_type{detail::materialized_quantity(qp)};
         else
           return quantity_type{qp - point_origin};
       }()))
@@ -674,9 +857,12 @@ public:
   template<detail::SameAbsolutePointOriginAs<absolute_point_origin> NewPO>
   [[nodiscard]] constexpr QuantityPointOf<(NewPO{})> auto point_for(NewPO new_origin) const
   {
-    if constexpr (std::is_same_v<NewPO, MP_UNITS_NONCONST_TYPE(point_origin)>)
-      return *this;
-    else
+    if constexpr (std::is_same_v<NewPO, MP_UNITS_NONCONST_TYPE(point_origin)>) {
+      if constexpr (detail::has_deferred_bounds(point_origin))
+        return quantity_point{detail::materialized_quantity(*this), PO};
+      else
+        return *this;
+    } else
       return ::mp_units::quantity_point{*this - new_origin, new_origin};
   }
 
@@ -735,10 +921,10 @@ public:
     return *this - qp;
   }
 
-  [[nodiscard]] constexpr const quantity_type& quantity_from_zero() const noexcept
+  [[nodiscard]] constexpr decltype(auto) quantity_from_zero() const noexcept(!detail::has_deferred_bounds(PO))
     requires(PO == default_point_origin(R))
   {
-    return quantity_ref_from(PO);
+    return detail::materialized_quantity(*this);
   }
 
   // Extracts the numerical value of the point on the scale of `U` (measured from the default
@@ -772,14 +958,20 @@ public:
   }
 
 private:
-  template<UnitOf<quantity_spec> ToU, std::invocable<quantity_type> ConvertFn>
+  template<detail::rounding_mode Mode, UnitOf<quantity_spec> ToU, std::invocable<quantity_type> ConvertFn>
   [[nodiscard]] constexpr QuantityPointOf<quantity_spec> auto in_impl(ToU, ConvertFn convert) const
   {
     if constexpr (requires { ToU{}._point_origin_; } && (PO == default_point_origin(R))) {
       constexpr auto new_po = ToU{}._point_origin_;
-      return ::mp_units::quantity_point{convert(quantity_from(new_po)), new_po};
+      using to_quantity = decltype(convert(quantity_from(new_po)));
+      using to_point = quantity_point<to_quantity::reference, new_po, typename to_quantity::rep>;
+      // the origin offset and the unit scaling as a single multiply-add instead of two rounding steps
+      if constexpr (detail::FusableAffinePointConversion<quantity_point, to_point>)
+        return detail::sudo_cast<to_point, Mode>(*this);
+      else
+        return ::mp_units::quantity_point{convert(quantity_from(new_po)), new_po};
     } else {
-      return ::mp_units::quantity_point{convert(quantity_ref_from(point_origin)), point_origin};
+      return ::mp_units::quantity_point{convert(detail::materialized_quantity(*this)), point_origin};
     }
   }
 
@@ -789,35 +981,36 @@ public:
     requires detail::ImplicitScaling<unit, ToU{}, rep>
   [[nodiscard]] constexpr QuantityPointOf<quantity_spec> auto in(ToU) const
   {
-    return in_impl(ToU{}, [](const auto& q) { return q.in(ToU{}); });
+    return in_impl<detail::rounding_mode::truncated>(ToU{}, [](const auto& q) { return q.in(ToU{}); });
   }
 
   template<RepresentationOf<quantity_spec> ToRep>
     requires detail::RepConstructibleFrom<ToRep, rep>
   [[nodiscard]] constexpr QuantityPointOf<quantity_spec> auto in() const
   {
-    return ::mp_units::quantity_point{quantity_ref_from(point_origin).template in<ToRep>(), point_origin};
+    return ::mp_units::quantity_point{detail::materialized_quantity(*this).template in<ToRep>(), point_origin};
   }
 
   template<RepresentationOf<quantity_spec> ToRep, UnitOf<quantity_spec> ToU>
     requires detail::RepConstructibleFrom<ToRep, rep> && detail::ImplicitConversion<unit, rep, ToU{}, ToRep>
   [[nodiscard]] constexpr QuantityPointOf<quantity_spec> auto in(ToU) const
   {
-    return in_impl(ToU{}, [](const auto& q) { return q.template in<ToRep>(ToU{}); });
+    return in_impl<detail::rounding_mode::truncated>(ToU{},
+                                                     [](const auto& q) { return q.template in<ToRep>(ToU{}); });
   }
 
   template<UnitOf<quantity_spec> ToU, RoundingPolicy Policy>
     requires detail::ExplicitlyCastable<unit, ToU{}, rep> && detail::ValidRoundingPolicyFor<Policy, rep, rep>
   [[nodiscard]] constexpr QuantityPointOf<quantity_spec> auto in(ToU, Policy policy) const
   {
-    return in_impl(ToU{}, [policy](const auto& q) { return q.in(ToU{}, policy); });
+    return in_impl<detail::rounding_mode_of<Policy>>(ToU{}, [policy](const auto& q) { return q.in(ToU{}, policy); });
   }
 
   template<RepresentationOf<quantity_spec> ToRep, RoundingPolicy Policy>
     requires std::constructible_from<ToRep, rep> && detail::ValidRoundingPolicyFor<Policy, rep, ToRep>
   [[nodiscard]] constexpr QuantityPointOf<quantity_spec> auto in(Policy policy) const
   {
-    return ::mp_units::quantity_point{quantity_ref_from(point_origin).template in<ToRep>(policy), point_origin};
+    return ::mp_units::quantity_point{detail::materialized_quantity(*this).template in<ToRep>(policy), point_origin};
   }
 
   template<RepresentationOf<quantity_spec> ToRep, UnitOf<quantity_spec> ToU, RoundingPolicy Policy>
@@ -825,7 +1018,8 @@ public:
              detail::ValidRoundingPolicyFor<Policy, rep, ToRep>
   [[nodiscard]] constexpr QuantityPointOf<quantity_spec> auto in(ToU, Policy policy) const
   {
-    return in_impl(ToU{}, [policy](const auto& q) { return q.template in<ToRep>(ToU{}, policy); });
+    return in_impl<detail::rounding_mode_of<Policy>>(
+      ToU{}, [policy](const auto& q) { return q.template in<ToRep>(ToU{}, policy); });
   }
 
   template<UnitOf<quantity_spec> ToU>
@@ -867,10 +1061,10 @@ public:
   operator QP_() const& noexcept(
     noexcept(quantity_point_like_traits<QP>::from_numerical_value(
       quantity_from_origin_is_an_implementation_detail_.numerical_value_is_an_implementation_detail_)) &&
-    std::is_nothrow_copy_constructible_v<rep>)
+    std::is_nothrow_copy_constructible_v<rep> && !detail::has_deferred_bounds(PO))
   {
     return quantity_point_like_traits<QP>::from_numerical_value(
-      quantity_from_origin_is_an_implementation_detail_.numerical_value_is_an_implementation_detail_);
+      detail::materialized_quantity(*this).numerical_value_is_an_implementation_detail_);
   }
 
   template<typename QP_, QuantityPointLike QP = std::remove_cvref_t<QP_>>
@@ -885,8 +1079,11 @@ public:
   operator QP_() && noexcept(
     noexcept(quantity_point_like_traits<QP>::from_numerical_value(
       quantity_from_origin_is_an_implementation_detail_.numerical_value_is_an_implementation_detail_)) &&
-    std::is_nothrow_move_constructible_v<rep>)
+    std::is_nothrow_move_constructible_v<rep> && !detail::has_deferred_bounds(PO))
   {
+    if constexpr (detail::has_deferred_bounds(PO))
+      quantity_from_origin_is_an_implementation_detail_ =
+        detail::enforce_bounds<point_origin>(quantity_from_origin_is_an_implementation_detail_);
     return quantity_point_like_traits<QP>::from_numerical_value(
       std::move(quantity_from_origin_is_an_implementation_detail_).numerical_value_is_an_implementation_detail_);
   }
@@ -897,7 +1094,7 @@ public:
   {
     ++quantity_from_origin_is_an_implementation_detail_;
     quantity_from_origin_is_an_implementation_detail_ =
-      detail::enforce_bounds<point_origin>(quantity_from_origin_is_an_implementation_detail_);
+      detail::enforce_bounds_on_update<point_origin>(quantity_from_origin_is_an_implementation_detail_);
     return *this;
   }
 
@@ -907,7 +1104,7 @@ public:
     auto old_quantity = quantity_from_origin_is_an_implementation_detail_;
     [[maybe_unused]] auto _ = quantity_from_origin_is_an_implementation_detail_++;
     quantity_from_origin_is_an_implementation_detail_ =
-      detail::enforce_bounds<point_origin>(quantity_from_origin_is_an_implementation_detail_);
+      detail::enforce_bounds_on_update<point_origin>(quantity_from_origin_is_an_implementation_detail_);
     return {old_quantity, PO};
   }
 
@@ -916,7 +1113,7 @@ public:
   {
     --quantity_from_origin_is_an_implementation_detail_;
     quantity_from_origin_is_an_implementation_detail_ =
-      detail::enforce_bounds<point_origin>(quantity_from_origin_is_an_implementation_detail_);
+      detail::enforce_bounds_on_update<point_origin>(quantity_from_origin_is_an_implementation_detail_);
     return *this;
   }
 
@@ -926,7 +1123,7 @@ public:
     auto old_quantity = quantity_from_origin_is_an_implementation_detail_;
     [[maybe_unused]] auto _ = quantity_from_origin_is_an_implementation_detail_--;
     quantity_from_origin_is_an_implementation_detail_ =
-      detail::enforce_bounds<point_origin>(quantity_from_origin_is_an_implementation_detail_);
+      detail::enforce_bounds_on_update<point_origin>(quantity_from_origin_is_an_implementation_detail_);
     return {old_quantity, PO};
   }
 
@@ -939,7 +1136,7 @@ public:
   {
     quantity_from_origin_is_an_implementation_detail_ += q;
     quantity_from_origin_is_an_implementation_detail_ =
-      detail::enforce_bounds<point_origin>(quantity_from_origin_is_an_implementation_detail_);
+      detail::enforce_bounds_on_update<point_origin>(quantity_from_origin_is_an_implementation_detail_);
     return *this;
   }
 
@@ -951,7 +1148,7 @@ public:
   {
     quantity_from_origin_is_an_implementation_detail_ -= q;
     quantity_from_origin_is_an_implementation_detail_ =
-      detail::enforce_bounds<point_origin>(quantity_from_origin_is_an_implementation_detail_);
+      detail::enforce_bounds_on_update<point_origin>(quantity_from_origin_is_an_implementation_detail_);
     return *this;
   }
 };
@@ -973,6 +1170,79 @@ quantity_point(QP)
   -> quantity_point<quantity_point_like_traits<QP>::reference, quantity_point_like_traits<QP>::point_origin,
                     typename quantity_point_like_traits<QP>::rep>;
 
+/**
+ * @brief Enforces the bounds of the point origin `PO` on a contiguous range in a single pass.
+ *
+ * Batch counterpart of the check done by every `quantity_point` operation. The elements are
+ * quantities measured from `PO` (the values that `quantity_point`s of `PO` store) and are
+ * updated in place by the bounds policy of `PO` or of its nearest bounded ancestor. Built-in
+ * policies process the whole range with a branch-free kernel; user-defined ones without a
+ * batch form are applied element by element.
+ *
+ * @return for checking policies, the index of the first element out of bounds (or `qs.size()`)
+ */
+template<PointOrigin auto PO, Quantity Q, std::size_t N>
+constexpr auto enforce_bounds(std::span<Q, N> qs)
+{
+  return detail::enforce_bounds_batch<PO, Q>(qs);
+}
+
+/**
+ * @brief Enforces the bounds of the point origin `PO` on raw numerical values in a single pass.
+ *
+ * Same as above for values that are the numbers of `quantity<R, Rep>` measured from `PO`.
+ */
+template<PointOrigin auto PO, Reference auto R, typename Rep, std::size_t N>
+  requires RepresentationOf<Rep, get_quantity_spec(R)>
+constexpr auto enforce_bounds(std::span<Rep, N> values)
+{
+  return detail::enforce_bounds_batch<PO, quantity<R, Rep>>(values);
+}
+
+/**
+ * @brief Enforces the bounds of the origin of `qp` on its current value, in place.
+ *
+ * Needed for points of an origin with `deferred_bounds`, whose arithmetic leaves the value
+ * unchecked until it is read. For other origins the value is always within bounds already.
+ */
+template<auto R, auto PO, typename Rep>
+constexpr quantity_point<R, PO, Rep>& enforce_bounds(quantity_point<R, PO, Rep>& qp)
+{
+  qp.quantity_from_origin_is_an_implementation_detail_ =
+    detail::enforce_bounds<PO, true>(qp.quantity_from_origin_is_an_implementation_detail_);
+  return qp;
+}
+
+/**
+ * @brief Process-wide counters of the bounds enforcement deferred on the origin `PO`
+ *
+ * `violations()` is the number of values found out of bounds when `enforce_bounds()` materialized
+ * them, for single points and for batches. Reads that enforce the bounds on a copy do not count.
+ * `elided_checks()` is the number of checks skipped by construction and mutating arithmetic;
+ * it is only tracked in builds with `MP_UNITS_API_BOUNDS_AUDIT` enabled and stays 0 otherwise.
+ * Relative origins share the counters of the origin that owns their bounds.
+ */
+template<PointOrigin auto PO>
+  requires(detail::has_deferred_bounds(PO))
+struct deferred_bounds_stats {
+  [[nodiscard]] static std::size_t violations() noexcept
+  {
+    return counters::violations.load(std::memory_order_relaxed);
+  }
+  [[nodiscard]] static std::size_t elided_checks() noexcept
+  {
+    return counters::elided_checks.load(std::memory_order_relaxed);
+  }
+  static void reset() noexcept
+  {
+    counters::violations.store(0, std::memory_order_relaxed);
+    counters::elided_checks.store(0, std::memory_order_relaxed);
+  }
+
+private:
+  using counters = detail::deferred_bounds_counters<detail::bounds_po_for(PO)>;
+};
+
 MP_UNITS_EXPORT_END
 
 }  // namespace mp_units
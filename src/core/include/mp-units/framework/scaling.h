@@ -130,6 +130,53 @@ template<rounding_mode Mode, typename T, typename D>
   }
 }
 
+/**
+ * @brief The divisor `d` for which scaling by @c M is a plain division by `d` representable in @c T,
+ *        or `0` when there is no such divisor
+ */
+template<auto M, std::signed_integral T>
+constexpr T integral_divisor = [] {
+  if constexpr (!is_integral(pow<-1>(M)))
+    return T{0};
+  else {
+    constexpr auto divisor = try_get_value<std::make_unsigned_t<T>>(pow<-1>(M));
+    if constexpr (!divisor || *divisor > static_cast<std::make_unsigned_t<T>>(std::numeric_limits<T>::max()))
+      return T{0};
+    else
+      return static_cast<T>(*divisor);
+  }
+}();
+
+/**
+ * @brief `div_round<Mode>` by a positive compile-time divisor for the batch algorithms
+ *
+ * The quotient of a division never needs a wider type, and the rounding correction is derived
+ * from the remainder arithmetically instead of with branches, which lets compilers vectorize
+ * loops over it.
+ */
+template<rounding_mode Mode, auto Divisor, std::signed_integral T>
+  requires(Divisor > 0)
+[[nodiscard]] constexpr T div_round_by(T dividend)
+{
+  constexpr T divisor = Divisor;
+  const T quot = static_cast<T>(dividend / divisor);
+  const T rem = static_cast<T>(dividend - quot * divisor);
+  if constexpr (Mode == rounding_mode::truncated)
+    return quot;
+  else if constexpr (Mode == rounding_mode::rounded_down)
+    return static_cast<T>(quot - static_cast<T>(rem < 0));
+  else if constexpr (Mode == rounding_mode::rounded_up)
+    return static_cast<T>(quot + static_cast<T>(rem > 0));
+  else {  // rounding_mode::rounded (to nearest, ties to even)
+    const T abs_rem = rem < 0 ? static_cast<T>(-rem) : rem;
+    const T complement = static_cast<T>(divisor - abs_rem);
+    const T is_odd = quot & 1;
+    const T away = (abs_rem > complement) | ((abs_rem == complement) & is_odd);
+    const T sign = rem < 0 ? T{-1} : T{1};
+    return static_cast<T>(quot + away * sign);
+  }
+}
+
 /**
  * @brief Rounds a floating-point value to an integral value according to @c Mode
  *
@@ -38,6 +38,8 @@
 #ifdef MP_UNITS_IMPORT_STD
 import std;
 #else
+#include <cstddef>
+#include <span>
 #include <type_traits>
 #endif
 #endif
@@ -426,6 +428,32 @@ template<QuantityPoint ToQP, typename FwdQP, RoundingPolicy Policy = truncated_t
   return detail::sudo_cast<ToQP, detail::rounding_mode_of<Policy>>(std::forward<FwdQP>(qp));
 }
 
+/**
+ * @brief Batch form of `value_cast<ToQP>(qp)` for contiguous ranges of quantity points
+ *
+ * Converts every point of `from` and stores it in the corresponding element of `to`. The
+ * offset between the origins and the scaling between the units are folded once for the whole
+ * batch, so for arithmetic representation types each element costs a single multiply-add.
+ *
+ * @tparam ToQP a target quantity point type to which to cast the representation of the points
+ * @param from the points to convert
+ * @param to the destination; has to have at least as many elements as `from`
+ * @param policy an optional rounding policy (`truncated` when not provided)
+ */
+template<QuantityPoint ToQP, typename FromQP, std::size_t N, std::size_t M, RoundingPolicy Policy = truncated_t,
+         QuantityPoint QP = std::remove_const_t<FromQP>>
+  requires(ToQP::quantity_spec == QP::quantity_spec) && UnitOf<MP_UNITS_NONCONST_TYPE(ToQP::unit), QP::quantity_spec> &&
+          (detail::same_absolute_point_origins(ToQP::point_origin, QP::point_origin)) &&
+          std::constructible_from<typename ToQP::rep, typename QP::rep> &&
+          detail::ExplicitlyCastable<QP::unit, ToQP::unit, typename ToQP::rep> &&
+          detail::ValidRoundingPolicyFor<Policy, typename QP::rep, typename ToQP::rep>
+constexpr void value_cast(std::span<FromQP, N> from, std::span<ToQP, M> to, Policy = Policy{})
+{
+  MP_UNITS_PRECONDITION(from.size() <= to.size());
+  for (std::size_t i = 0; i < from.size(); ++i)
+    to[i] = ToQP(detail::sudo_cast<ToQP, detail::rounding_mode_of<Policy>>(from[i]));
+}
+
 MP_UNITS_EXPORT_END
 
 }  // namespace mp_units
@@ -30,14 +30,19 @@
 #include <mp-units/framework/rounding.h>
 #include <mp-units/framework/unit.h>
 #include <mp-units/framework/value_cast.h>
+#if MP_UNITS_HOSTED
+#include <mp-units/bits/math_kernels.h>
+#endif
 
 #ifndef MP_UNITS_IN_MODULE_INTERFACE
 #ifdef MP_UNITS_IMPORT_STD
 import std;
 #else
+#include <cstddef>
 #include <cstdint>
 #include <cstdlib>
 #include <limits>
+#include <span>
 #include <version>
 #if MP_UNITS_HOSTED
 #include <cmath>
@@ -114,6 +119,22 @@ template<std::intmax_t Num, std::intmax_t Den = 1, auto R, typename Rep>
   }
 }
 
+/**
+ * @brief Computes `pow<Num, Den>(in[i])` for all elements of the spans
+ *
+ * Every element goes through the scalar `pow<Num, Den>()`, and its result is assigned to `out`,
+ * which converts it to the unit of `out` when the two differ.
+ *
+ * @pre `in.size() <= out.size()`
+ */
+template<std::intmax_t Num, std::intmax_t Den = 1, typename From, std::size_t N, typename To, std::size_t M>
+  requires requires(From& in, To& out) { out = pow<Num, Den>(in); }
+constexpr void pow(std::span<From, N> in, std::span<To, M> out)
+{
+  MP_UNITS_PRECONDITION(in.size() <= out.size());
+  for (std::size_t i = 0; i < in.size(); ++i) out[i] = pow<Num, Den>(in[i]);
+}
+
 /**
  * @brief Computes the square root of a quantity
  *
@@ -135,6 +156,19 @@ template<auto R, typename Rep>
   return {static_cast<Rep>(sqrt(q.numerical_value_ref_in(q.unit))), sqrt(R)};
 }
 
+/**
+ * @brief Computes `sqrt(in[i])` for all elements of the spans
+ *
+ * @pre `in.size() <= out.size()`
+ */
+template<typename From, std::size_t N, typename To, std::size_t M>
+  requires requires(From& in, To& out) { out = sqrt(in); }
+constexpr void sqrt(std::span<From, N> in, std::span<To, M> out)
+{
+  MP_UNITS_PRECONDITION(in.size() <= out.size());
+  for (std::size_t i = 0; i < in.size(); ++i) out[i] = sqrt(in[i]);
+}
+
 /**
  * @brief Computes the cubic root of a quantity
  *
@@ -156,6 +190,19 @@ template<auto R, typename Rep>
   return {static_cast<Rep>(cbrt(q.numerical_value_ref_in(q.unit))), cbrt(R)};
 }
 
+/**
+ * @brief Computes `cbrt(in[i])` for all elements of the spans
+ *
+ * @pre `in.size() <= out.size()`
+ */
+template<typename From, std::size_t N, typename To, std::size_t M>
+  requires requires(From& in, To& out) { out = cbrt(in); }
+constexpr void cbrt(std::span<From, N> in, std::span<To, M> out)
+{
+  MP_UNITS_PRECONDITION(in.size() <= out.size());
+  for (std::size_t i = 0; i < in.size(); ++i) out[i] = cbrt(in[i]);
+}
+
 /**
  * @brief Computes Euler's raised to the given power
  *
@@ -178,6 +225,19 @@ template<ReferenceOf<dimensionless> auto R, typename Rep>
     quantity{static_cast<Rep>(exp(q.numerical_value_in(q.unit))), detail::clone_reference_with<one>(R)});
 }
 
+/**
+ * @brief Computes `exp(in[i])` for all elements of the spans
+ *
+ * @pre `in.size() <= out.size()`
+ */
+template<typename From, std::size_t N, typename To, std::size_t M>
+  requires requires(From& in, To& out) { out = exp(in); }
+constexpr void exp(std::span<From, N> in, std::span<To, M> out)
+{
+  MP_UNITS_PRECONDITION(in.size() <= out.size());
+  for (std::size_t i = 0; i < in.size(); ++i) out[i] = exp(in[i]);
+}
+
 /**
  * @brief Determines if a quantity is finite.
  *
@@ -357,6 +417,22 @@ template<auto R1, typename Rep1, auto R2, typename Rep2>
   return quantity{fmod(x.numerical_value_in(unit), y.numerical_value_in(unit)), ref};
 }
 
+/**
+ * @brief Computes `fmod(x[i], y[i])` for all elements of the spans
+ *
+ * Every pair of elements goes through the scalar `fmod()`, which converts both of them to their
+ * common unit.
+ *
+ * @pre `x.size() == y.size() && x.size() <= out.size()`
+ */
+template<typename Q1, std::size_t N1, typename Q2, std::size_t N2, typename To, std::size_t M>
+  requires requires(Q1& x, Q2& y, To& out) { out = fmod(x, y); }
+constexpr void fmod(std::span<Q1, N1> x, std::span<Q2, N2> y, std::span<To, M> out)
+{
+  MP_UNITS_PRECONDITION(x.size() == y.size() && x.size() <= out.size());
+  for (std::size_t i = 0; i < x.size(); ++i) out[i] = fmod(x[i], y[i]);
+}
+
 /**
  * @brief Computes the IEEE remainder of the floating point division operation x / y.
  */
@@ -458,6 +534,56 @@ template<Unit auto To, auto R, auto PO, typename Rep>
   }
 }
 
+namespace detail {
+
+/**
+ * @brief Rounds the quantities or quantity points of `in` to the unit `To` with a fused conversion
+ *
+ * Every element is converted with `in(To, Policy)`, which divides its numerical value only once.
+ * When the conversion of a quantity with a signed integral representation is a plain division
+ * that fits in that type, it is performed in that type without widening and without branches.
+ */
+template<RoundingPolicy Policy, Unit auto To, typename From, std::size_t N, typename ToQ, std::size_t M>
+constexpr void round_integral_batch(std::span<From, N> in, std::span<ToQ, M> out)
+{
+  using rep = From::rep;
+  constexpr auto divisor = [] {
+    if constexpr (Quantity<std::remove_const_t<From>> && std::signed_integral<rep>)
+      return integral_divisor<get_canonical_unit(From::unit).mag / get_canonical_unit(To).mag, rep>;
+    else
+      return 0;
+  }();
+  if constexpr (divisor != 0) {
+    constexpr auto ref = clone_reference_with<To>(From::reference);
+    for (std::size_t i = 0; i < in.size(); ++i)
+      out[i] = quantity{div_round_by<rounding_mode_of<Policy>, divisor>(in[i].numerical_value_in(From::unit)), ref};
+  } else {
+    for (std::size_t i = 0; i < in.size(); ++i) out[i] = in[i].in(To, Policy{});
+  }
+}
+
+}  // namespace detail
+
+/**
+ * @brief Computes `floor<To>(in[i])` for all elements of the spans of quantities or quantity points
+ *
+ * For integral representation types, the unit conversion and the rounding are fused into a
+ * single `in(To, rounded_down)` conversion, which divides every value only once (a pure division
+ * of a signed integer is also done without widening and branches, so it can be vectorized).
+ *
+ * @pre `in.size() <= out.size()`
+ */
+template<Unit auto To, typename From, std::size_t N, typename ToQ, std::size_t M>
+  requires requires(From& in, ToQ& out) { out = mp_units::floor<To>(in); }
+constexpr void floor(std::span<From, N> in, std::span<ToQ, M> out)
+{
+  MP_UNITS_PRECONDITION(in.size() <= out.size());
+  if constexpr (std::integral<typename From::rep> && requires(From& q) { q.in(To, rounded_down); })
+    detail::round_integral_batch<rounded_down_t, To>(in, out);
+  else
+    for (std::size_t i = 0; i < in.size(); ++i) out[i] = mp_units::floor<To>(in[i]);
+}
+
 /**
  * @brief Computes the smallest quantity with integer representation and unit type To with its number not less than q
  *
@@ -518,6 +644,25 @@ template<Unit auto To, auto R, auto PO, typename Rep>
   }
 }
 
+/**
+ * @brief Computes `ceil<To>(in[i])` for all elements of the spans of quantities or quantity points
+ *
+ * For integral representation types, the unit conversion and the rounding are fused into a
+ * single `in(To, rounded_up)` conversion.
+ *
+ * @pre `in.size() <= out.size()`
+ */
+template<Unit auto To, typename From, std::size_t N, typename ToQ, std::size_t M>
+  requires requires(From& in, ToQ& out) { out = mp_units::ceil<To>(in); }
+constexpr void ceil(std::span<From, N> in, std::span<ToQ, M> out)
+{
+  MP_UNITS_PRECONDITION(in.size() <= out.size());
+  if constexpr (std::integral<typename From::rep> && requires(From& q) { q.in(To, rounded_up); })
+    detail::round_integral_batch<rounded_up_t, To>(in, out);
+  else
+    for (std::size_t i = 0; i < in.size(); ++i) out[i] = mp_units::ceil<To>(in[i]);
+}
+
 /**
  * @brief Computes the nearest quantity with integer representation and unit type `To` to `q`
  *
@@ -579,6 +724,26 @@ template<Unit auto To, auto R, auto PO, typename Rep>
   return res_high;
 }
 
+/**
+ * @brief Computes `round<To>(in[i])` for all elements of the spans of quantities or quantity points
+ *
+ * For integral representation types, the unit conversion and the rounding are fused into a
+ * single `in(To, rounded)` conversion, which replaces the two comparisons of the scalar
+ * `round<To>()` with the remainder of one division.
+ *
+ * @pre `in.size() <= out.size()`
+ */
+template<Unit auto To, typename From, std::size_t N, typename ToQ, std::size_t M>
+  requires requires(From& in, ToQ& out) { out = mp_units::round<To>(in); }
+constexpr void round(std::span<From, N> in, std::span<ToQ, M> out)
+{
+  MP_UNITS_PRECONDITION(in.size() <= out.size());
+  if constexpr (std::integral<typename From::rep> && requires(From& q) { q.in(To, rounded); })
+    detail::round_integral_batch<rounded_t, To>(in, out);
+  else
+    for (std::size_t i = 0; i < in.size(); ++i) out[i] = mp_units::round<To>(in[i]);
+}
+
 /**
  * @brief Computes the inverse of a quantity in a provided unit
  */
@@ -618,6 +783,50 @@ template<auto R1, typename Rep1, auto R2, typename Rep2>
   return quantity{hypot(x.numerical_value_in(unit), y.numerical_value_in(unit)), ref};
 }
 
+#if MP_UNITS_HOSTED
+
+/**
+ * @brief Computes the square root of the sum of the squares of x and y with a selected accuracy
+ *
+ * `libm_accuracy` is the same as `hypot(x, y)`. The other tiers (see `MathAccuracy`) use the
+ * library kernels for `float` and `double` representation types.
+ */
+template<auto R1, typename Rep1, auto R2, typename Rep2, MathAccuracy Accuracy>
+  requires requires(const quantity<R1, Rep1>& x, const quantity<R2, Rep2>& y) { hypot(x, y); }
+[[nodiscard]] inline QuantityOf<get_quantity_spec(get_common_reference(R1, R2))> auto hypot(
+  const quantity<R1, Rep1>& x, const quantity<R2, Rep2>& y, Accuracy) noexcept
+{
+  using rep = detail::kernel_rep_t<Accuracy, Rep1, Rep2>;
+  if constexpr (std::is_void_v<rep>)
+    return hypot(x, y);
+  else {
+    constexpr auto ref = get_common_reference(R1, R2);
+    constexpr auto unit = get_unit(ref);
+    return quantity{detail::hypot<Accuracy>(value_cast<rep>(x).numerical_value_in(unit),
+                                            value_cast<rep>(y).numerical_value_in(unit)),
+                    ref};
+  }
+}
+
+/**
+ * @brief Computes `hypot(x[i], y[i], accuracy)` for all elements of the spans
+ *
+ * The common unit is resolved at compile time, and the loop over the numerical values is free
+ * of branches for `fast_accuracy`, which lets the compiler vectorize it.
+ *
+ * @pre `x.size() == y.size() && x.size() <= out.size()`
+ */
+template<typename Q1, std::size_t N1, typename Q2, std::size_t N2, typename To, std::size_t M,
+         MathAccuracy Accuracy = libm_accuracy_t>
+  requires requires(Q1& x, Q2& y, To& out) { out = hypot(x, y, Accuracy{}); }
+inline void hypot(std::span<Q1, N1> x, std::span<Q2, N2> y, std::span<To, M> out, Accuracy acc = Accuracy{})
+{
+  MP_UNITS_PRECONDITION(x.size() == y.size() && x.size() <= out.size());
+  for (std::size_t i = 0; i < x.size(); ++i) out[i] = hypot(x[i], y[i], acc);
+}
+
+#endif  // MP_UNITS_HOSTED
+
 /**
  * @brief Computes the square root of the sum of the squares of x, y, and z,
  *        without undue overflow or underflow at intermediate stages of the computation
@@ -671,6 +880,19 @@ template<auto R1, auto Origin, typename Rep1, auto R2, typename Rep2, typename F
                            ref};
 }
 
+/**
+ * @brief Computes `lerp(a[i], b[i], t)` for all elements of the spans
+ *
+ * @pre `a.size() == b.size() && a.size() <= out.size()`
+ */
+template<typename QP1, std::size_t N1, typename QP2, std::size_t N2, typename Factor, typename To, std::size_t M>
+  requires requires(QP1& a, QP2& b, const Factor& t, To& out) { out = lerp(a, b, t); }
+constexpr void lerp(std::span<QP1, N1> a, std::span<QP2, N2> b, const Factor& t, std::span<To, M> out)
+{
+  MP_UNITS_PRECONDITION(a.size() == b.size() && a.size() <= out.size());
+  for (std::size_t i = 0; i < a.size(); ++i) out[i] = lerp(a[i], b[i], t);
+}
+
 /**
  * @brief Computes the midpoint of two points
  */
@@ -696,4 +918,17 @@ template<auto R1, auto Origin, typename Rep1, auto R2, typename Rep2>
                            ref};
 }
 
+/**
+ * @brief Computes `midpoint(a[i], b[i])` for all elements of the spans
+ *
+ * @pre `a.size() == b.size() && a.size() <= out.size()`
+ */
+template<typename QP1, std::size_t N1, typename QP2, std::size_t N2, typename To, std::size_t M>
+  requires requires(QP1& a, QP2& b, To& out) { out = midpoint(a, b); }
+constexpr void midpoint(std::span<QP1, N1> a, std::span<QP2, N2> b, std::span<To, M> out)
+{
+  MP_UNITS_PRECONDITION(a.size() == b.size() && a.size() <= out.size());
+  for (std::size_t i = 0; i < a.size(); ++i) out[i] = midpoint(a[i], b[i]);
+}
+
 }  // namespace mp_units
@@ -32,6 +32,12 @@
 import std;
 #else
 #include <concepts>
+#include <cstddef>
+#include <span>
+#include <type_traits>
+#if MP_UNITS_HOSTED
+#include <cmath>
+#endif
 #endif
 #endif
 
@@ -64,6 +70,183 @@ namespace mp_units {
 //   Note: reflect_non_negative and wrap_non_negative are not provided — [0, ∞) has no
 //   upper bound, so neither reflection nor wrapping is physically well-defined.
 // ============================================================================
+//
+// Batch forms:
+//   Every policy also accepts a `std::span` of quantities (the range policies also a `std::span`
+//   of raw numerical values together with their reference) and enforces the bounds on all elements in place in
+//   a single pass. The bounds are converted to the elements' unit once, and the per-element
+//   work is branch-free for arithmetic representation types so that the compiler can
+//   vectorize it. The checking policies return the index of the first violating element
+//   (or the size of the span when there is none).
+// ============================================================================
+
+namespace detail {
+
+// The numerical value of a batch element, which is either a quantity or already a raw value.
+template<typename T>
+[[nodiscard]] constexpr auto& batch_value(T& v) noexcept
+{
+  if constexpr (Quantity<std::remove_const_t<T>>)
+    return v.numerical_value_is_an_implementation_detail_;
+  else
+    return v;
+}
+
+// A policy bound converted to the unit and representation of the batch quantity type V.
+template<Quantity V, typename B>
+[[nodiscard]] constexpr typename V::rep batch_bound(const B& b)
+{
+  return V{b}.numerical_value_is_an_implementation_detail_;
+}
+
+// Applies a scalar policy to a single batch element (the fallback for representation types
+// without a dedicated branch-free kernel).
+template<Quantity V, typename T, typename Policy>
+constexpr void apply_to_batch_element(T& v, const Policy& policy)
+{
+  if constexpr (Quantity<T>)
+    v = policy(v);
+  else
+    v = policy(V{v, V::reference}).numerical_value_is_an_implementation_detail_;
+}
+
+// Index of the first element outside [lo, hi] or `vs.size()`. Written as a min-reduction
+// rather than an early exit so that the loop vectorizes.
+template<typename T, typename Rep, std::size_t N>
+[[nodiscard]] constexpr std::size_t first_out_of_range(std::span<T, N> vs, const Rep& lo, const Rep& hi)
+{
+  std::size_t first = vs.size();
+  for (std::size_t i = 0; i < vs.size(); ++i) {
+    const auto& v = batch_value(vs[i]);
+    const std::size_t candidate = (v < lo) | (v > hi) ? i : vs.size();
+    first = candidate < first ? candidate : first;
+  }
+  return first;
+}
+
+template<Quantity V, typename T, std::size_t N>
+constexpr std::size_t check_batch(std::span<T, N> vs, const typename V::rep& lo, const typename V::rep& hi)
+{
+  const std::size_t first = first_out_of_range(vs, lo, hi);
+  if constexpr (HasConstraintViolationHandler<typename V::rep>) {
+    if (first != vs.size()) constraint_violation_handler<typename V::rep>::on_violation("value out of bounds");
+  } else {
+    MP_UNITS_PRECONDITION(first == vs.size());
+  }
+  return first;
+}
+
+template<typename T, typename Rep, std::size_t N>
+constexpr void clamp_batch(std::span<T, N> vs, const Rep& lo, const Rep& hi)
+{
+  for (auto& e : vs) {
+    auto& v = batch_value(e);
+    v = v < lo ? lo : (v > hi ? hi : v);
+  }
+}
+
+// The distance |a - b| of two signed integers, which always fits in the unsigned type.
+template<std::signed_integral T>
+[[nodiscard]] constexpr std::make_unsigned_t<T> unsigned_distance(T a, T b) noexcept
+{
+  using U = std::make_unsigned_t<T>;
+  return a >= b ? static_cast<U>(static_cast<U>(a) - static_cast<U>(b))
+                : static_cast<U>(static_cast<U>(b) - static_cast<U>(a));
+}
+
+// (v - lo) modulo `period` in [0, period), computed without the signed overflow of `v - lo`
+// for values near the limits of the type.
+template<std::signed_integral T, std::unsigned_integral U>
+[[nodiscard]] constexpr U unsigned_remainder_from(T v, T lo, U period) noexcept
+{
+  const auto r = static_cast<U>(unsigned_distance(v, lo) % period);
+  return v >= lo || r == 0 ? r : static_cast<U>(period - r);
+}
+
+// Integral representations use the remainder and floating-point ones `floor` (hosted only),
+// each followed by selects instead of the data-dependent loops of the scalar policies.
+// The result for values many periods away from the range may differ from the scalar
+// policy in the last bits, as it does not accumulate the error of repeated subtraction.
+// Note: GCC vectorizes `floor` only with `-fno-trapping-math`; Clang does by default.
+template<Quantity V, typename T, typename Policy, std::size_t N>
+constexpr void wrap_batch(std::span<T, N> vs, const Policy& policy)
+{
+  using rep = typename V::rep;
+  const rep lo = batch_bound<V>(policy.min);
+  const rep hi = batch_bound<V>(policy.max);
+  if constexpr (std::is_integral_v<rep> && std::is_signed_v<rep>) {
+    using urep = std::make_unsigned_t<rep>;
+    const urep range = unsigned_distance(hi, lo);
+    for (auto& e : vs) {
+      auto& v = batch_value(e);
+      const urep r = unsigned_remainder_from(v, lo, range);
+      v = static_cast<rep>(static_cast<urep>(lo) + r);
+    }
+  }
+#if MP_UNITS_HOSTED
+  else if constexpr (std::is_floating_point_v<rep>) {
+    const rep range = hi - lo;
+    if (std::is_constant_evaluated()) {
+      for (auto& e : vs) apply_to_batch_element<V>(e, policy);
+    } else {
+      for (auto& e : vs) {
+        auto& v = batch_value(e);
+        rep w = v - range * std::floor((v - lo) / range);
+        w = w >= hi ? w - range : w;
+        v = w < lo ? w + range : w;
+      }
+    }
+  }
+#endif
+  else {
+    for (auto& e : vs) apply_to_batch_element<V>(e, policy);
+  }
+}
+
+template<Quantity V, typename T, typename Policy, std::size_t N>
+constexpr void reflect_batch(std::span<T, N> vs, const Policy& policy)
+{
+  using rep = typename V::rep;
+  const rep lo = batch_bound<V>(policy.min);
+  const rep hi = batch_bound<V>(policy.max);
+  if constexpr (std::is_integral_v<rep> && std::is_signed_v<rep>) {
+    using urep = std::make_unsigned_t<rep>;
+    const urep range = unsigned_distance(hi, lo);
+    // a period of twice the range has to be representable in the unsigned type
+    if (range > static_cast<urep>(-1) / 2) {
+      for (auto& e : vs) apply_to_batch_element<V>(e, policy);
+      return;
+    }
+    const auto period = static_cast<urep>(2 * range);
+    for (auto& e : vs) {
+      auto& v = batch_value(e);
+      const urep y = unsigned_remainder_from(v, lo, period);
+      v = static_cast<rep>(static_cast<urep>(lo) + (y > range ? static_cast<urep>(period - y) : y));
+    }
+  }
+#if MP_UNITS_HOSTED
+  else if constexpr (std::is_floating_point_v<rep>) {
+    const rep range = hi - lo;
+    const rep period = 2 * range;
+    if (std::is_constant_evaluated()) {
+      for (auto& e : vs) apply_to_batch_element<V>(e, policy);
+    } else {
+      for (auto& e : vs) {
+        auto& v = batch_value(e);
+        rep y = (v - lo) - period * std::floor((v - lo) / period);
+        y = y >= period ? y - period : y;
+        y = y < 0 ? y + period : y;
+        v = lo + (y > range ? period - y : y);
+      }
+    }
+  }
+#endif
+  else {
+    for (auto& e : vs) apply_to_batch_element<V>(e, policy);
+  }
+}
+
+}  // namespace detail
 
 /**
  * @brief Policy that checks the value is within [min, max] and reports violations.
@@ -98,6 +281,21 @@ struct check_in_range {
     }
     return v;
   }
+
+  template<typename T, std::size_t N>
+    requires Quantity<std::remove_const_t<T>>
+  constexpr std::size_t operator()(std::span<T, N> vs) const
+  {
+    using V = std::remove_const_t<T>;
+    return detail::check_batch<V>(vs, detail::batch_bound<V>(min), detail::batch_bound<V>(max));
+  }
+
+  template<typename Rep, Reference R, std::size_t N>
+  constexpr std::size_t operator()(std::span<Rep, N> vs, R) const
+  {
+    using V = quantity<R{}, std::remove_const_t<Rep>>;
+    return detail::check_batch<V>(vs, detail::batch_bound<V>(min), detail::batch_bound<V>(max));
+  }
 };
 
 #if MP_UNITS_COMP_CLANG && MP_UNITS_COMP_CLANG < 17
@@ -127,6 +325,19 @@ struct clamp_to_range {
     if (v > vmax) return vmax;
     return v;
   }
+
+  template<Quantity V, std::size_t N>
+  constexpr void operator()(std::span<V, N> vs) const
+  {
+    detail::clamp_batch(vs, detail::batch_bound<V>(min), detail::batch_bound<V>(max));
+  }
+
+  template<typename Rep, Reference R, std::size_t N>
+  constexpr void operator()(std::span<Rep, N> vs, R) const
+  {
+    using V = quantity<R{}, Rep>;
+    detail::clamp_batch(vs, detail::batch_bound<V>(min), detail::batch_bound<V>(max));
+  }
 };
 
 #if MP_UNITS_COMP_CLANG && MP_UNITS_COMP_CLANG < 17
@@ -158,6 +369,18 @@ struct wrap_to_range {
     while (v < vmin) v += range;
     return v;
   }
+
+  template<Quantity V, std::size_t N>
+  constexpr void operator()(std::span<V, N> vs) const
+  {
+    detail::wrap_batch<V>(vs, *this);
+  }
+
+  template<typename Rep, Reference R, std::size_t N>
+  constexpr void operator()(std::span<Rep, N> vs, R) const
+  {
+    detail::wrap_batch<quantity<R{}, Rep>>(vs, *this);
+  }
 };
 
 #if MP_UNITS_COMP_CLANG && MP_UNITS_COMP_CLANG < 17
@@ -190,6 +413,18 @@ struct reflect_in_range {
     if (v > vmax) v = V{2 * vmax} - v;
     return v;
   }
+
+  template<Quantity V, std::size_t N>
+  constexpr void operator()(std::span<V, N> vs) const
+  {
+    detail::reflect_batch<V>(vs, *this);
+  }
+
+  template<typename Rep, Reference R, std::size_t N>
+  constexpr void operator()(std::span<Rep, N> vs, R) const
+  {
+    detail::reflect_batch<quantity<R{}, Rep>>(vs, *this);
+  }
 };
 
 #if MP_UNITS_COMP_CLANG && MP_UNITS_COMP_CLANG < 17
@@ -285,6 +520,25 @@ MP_UNITS_EXPORT struct check_non_negative {
     }
     return v;
   }
+
+  template<typename T, std::size_t N>
+    requires Quantity<std::remove_const_t<T>>
+  constexpr std::size_t operator()(std::span<T, N> vs) const
+  {
+    using V = std::remove_const_t<T>;
+    std::size_t first = vs.size();
+    for (std::size_t i = 0; i < vs.size(); ++i) {
+      const std::size_t candidate = vs[i] < V::zero() ? i : vs.size();
+      first = candidate < first ? candidate : first;
+    }
+    if constexpr (detail::HasConstraintViolationHandler<typename V::rep>) {
+      if (first != vs.size())
+        constraint_violation_handler<typename V::rep>::on_violation("value must be non-negative");
+    } else {
+      MP_UNITS_PRECONDITION(first == vs.size());
+    }
+    return first;
+  }
 };
 
 /**
@@ -304,6 +558,35 @@ MP_UNITS_EXPORT struct clamp_non_negative {
     const V vzero{V::zero()};
     return v < vzero ? vzero : v;
   }
+
+  template<Quantity V, std::size_t N>
+  constexpr void operator()(std::span<V, N> vs) const
+  {
+    for (V& v : vs) v = v < V::zero() ? V::zero() : v;
+  }
 };
 
+/**
+ * @brief Adapter that defers the enforcement of a bounds policy to the API boundary.
+ *
+ * A point origin defined with `deferred_bounds{policy}` does not apply `policy` to every
+ * arithmetic result. Constructing a point from a quantity measured from that origin and the
+ * mutating operators (`++`, `--`, `+=`, `-=`) keep the value as is, so numerical kernels run
+ * without a check per step. The policy is enforced when the value is materialized: when it is
+ * read (`quantity_from()`, `quantity_from_zero()`, comparisons, subtraction of points),
+ * converted (`in()`, `point_for()`, conversions to other point types), or explicitly with
+ * `enforce_bounds(qp)`. Violations found by `enforce_bounds()` are counted by `deferred_bounds_stats`.
+ *
+ * Example:
+ * @code{cpp}
+ * inline constexpr struct prime_meridian :
+ *     absolute_point_origin<geo_longitude, deferred_bounds{wrap_to_range{-180 * deg, 180 * deg}}> {} prime_meridian;
+ * @endcode
+ */
+MP_UNITS_EXPORT template<typename Policy>
+struct deferred_bounds : Policy {};
+
+template<typename Policy>
+deferred_bounds(Policy) -> deferred_bounds<Policy>;
+
 }  // namespace mp_units
@@ -0,0 +1,592 @@
+// The MIT License (MIT)
+//
+// Copyright (c) 2018 Mateusz Pusz
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+
+#pragma once
+
+#include <mp-units/bits/fixed_point.h>
+#include <mp-units/bits/hacks.h>
+#include <mp-units/bits/module_macros.h>
+#include <mp-units/utility/safe_int.h>
+#if MP_UNITS_HOSTED
+#include <mp-units/ext/format.h>
+#endif
+#include <mp-units/framework/customization_points.h>
+#include <mp-units/framework/representation_concepts.h>
+#include <mp-units/framework/scaling.h>
+
+#ifndef MP_UNITS_IN_MODULE_INTERFACE
+#ifdef MP_UNITS_IMPORT_STD
+import std;
+#else
+#include <compare>
+#include <concepts>
+#include <cstddef>
+#include <cstdint>
+#include <limits>
+#include <string_view>
+#include <tuple>
+#include <type_traits>
+#endif
+#endif
+
+namespace mp_units::utility {
+
+// ============================================================================
+// ranged_int<T, Min, Max, ErrorPolicy>
+//
+// An integer whose value range [Min, Max] is part of its type. Arithmetic computes the range of
+// the result at compile time, so the result type is exactly as wide as the operands require and
+// needs no overflow check. A runtime check is emitted only where the range cannot be proven:
+// when the result range does not fit in 64 bits, when a divisor range contains zero, and when a
+// value is narrowed into a type with a smaller range.
+// ============================================================================
+
+MP_UNITS_EXPORT template<std::integral T, T Min, T Max,
+#if MP_UNITS_HOSTED
+                         OverflowPolicy ErrorPolicy = safe_int_throw_policy>
+#else
+                         OverflowPolicy ErrorPolicy = safe_int_terminate_policy>
+#endif
+class ranged_int;
+
+namespace detail {
+
+// Ranges are tracked in a type twice as wide as the widest storage type, so that the range of
+// any operation on two ranged_int values is exact.
+using ranged_wide_t = int128_t;
+
+template<typename T>
+[[nodiscard]] constexpr ranged_wide_t to_wide(T v) noexcept
+{
+  return static_cast<ranged_wide_t>(v);
+}
+
+inline constexpr ranged_wide_t ranged_storage_min = to_wide(std::numeric_limits<std::int64_t>::min());
+inline constexpr ranged_wide_t ranged_storage_max = to_wide(std::numeric_limits<std::int64_t>::max());
+
+// Whether `v` lies within [Min, Max]
+template<auto Min, auto Max, typename T>
+[[nodiscard]] constexpr bool ranged_contains(T v) noexcept
+{
+  return to_wide(Min) <= to_wide(v) && to_wide(v) <= to_wide(Max);
+}
+
+template<typename T>
+inline constexpr bool is_ranged_int_v = false;
+
+template<typename T, T Min, T Max, typename EP>
+inline constexpr bool is_ranged_int_v<ranged_int<T, Min, Max, EP>> = true;
+
+struct ranged_unchecked_t {
+  explicit ranged_unchecked_t() = default;
+};
+
+// Tag of the constructor that stores a value already proven to be within the range.
+inline constexpr ranged_unchecked_t ranged_unchecked{};
+
+struct ranged_bounds {
+  ranged_wide_t lo;
+  ranged_wide_t hi;
+};
+
+[[nodiscard]] consteval ranged_bounds ranged_hull(ranged_bounds b, ranged_wide_t v)
+{
+  return {v < b.lo ? v : b.lo, v > b.hi ? v : b.hi};
+}
+
+template<arith_op Op>
+[[nodiscard]] consteval ranged_bounds ranged_arith_bounds(ranged_bounds l, ranged_bounds r)
+{
+  if constexpr (Op == arith_op::add)
+    return {l.lo + r.lo, l.hi + r.hi};
+  else if constexpr (Op == arith_op::sub)
+    return {l.lo - r.hi, l.hi - r.lo};
+  else if constexpr (Op == arith_op::mul) {
+    ranged_bounds b{l.lo * r.lo, l.lo * r.lo};
+    b = ranged_hull(b, l.lo * r.hi);
+    b = ranged_hull(b, l.hi * r.lo);
+    return ranged_hull(b, l.hi * r.hi);
+  } else {
+    static_assert(Op == arith_op::div);
+    // `n / d` is monotonic in `n`, and in `d` on either side of zero, so the extremes are at the
+    // ends of the dividend range and of the negative and positive parts of the divisor range.
+    const ranged_wide_t divisors[] = {r.lo, r.hi < 0 ? r.hi : ranged_wide_t{-1}, r.hi,
+                                      r.lo > 0 ? r.lo : ranged_wide_t{1}};
+    const bool usable[] = {r.lo < 0, r.lo < 0, r.hi > 0, r.hi > 0};
+    ranged_bounds b{};
+    bool first = true;
+    for (std::size_t i = 0; i < 4; ++i) {
+      if (!usable[i]) continue;
+      for (const ranged_wide_t n : {l.lo, l.hi}) {
+        const ranged_wide_t q = n / divisors[i];
+        b = first ? ranged_bounds{q, q} : ranged_hull(b, q);
+        first = false;
+      }
+    }
+    return b;
+  }
+}
+
+using ranged_storage_types = std::tuple<std::uint8_t, std::uint16_t, std::uint32_t, std::uint64_t, std::int8_t,
+                                        std::int16_t, std::int32_t, std::int64_t>;
+
+// The narrowest standard integer type holding the range: unsigned when it has no negative values.
+[[nodiscard]] consteval std::size_t ranged_storage_index(ranged_bounds b)
+{
+  const std::size_t first = b.lo >= 0 ? 0 : 4;
+  if (b.lo >= 0) {
+    if (b.hi <= to_wide(std::numeric_limits<std::uint8_t>::max())) return first;
+    if (b.hi <= to_wide(std::numeric_limits<std::uint16_t>::max())) return first + 1;
+    if (b.hi <= to_wide(std::numeric_limits<std::uint32_t>::max())) return first + 2;
+    return first + 3;
+  }
+  if (b.lo >= to_wide(std::numeric_limits<std::int8_t>::min()) &&
+      b.hi <= to_wide(std::numeric_limits<std::int8_t>::max()))
+    return first;
+  if (b.lo >= to_wide(std::numeric_limits<std::int16_t>::min()) &&
+      b.hi <= to_wide(std::numeric_limits<std::int16_t>::max()))
+    return first + 1;
+  if (b.lo >= to_wide(std::numeric_limits<std::int32_t>::min()) &&
+      b.hi <= to_wide(std::numeric_limits<std::int32_t>::max()))
+    return first + 2;
+  return first + 3;
+}
+
+// The ranged_int type for values in the exact range `Bounds::value`. A range that does not fit
+// in std::int64_t is not proven: it is clamped to the std::int64_t range, and the operations
+// producing such a type check their result at runtime.
+template<typename Bounds, typename EP>
+struct ranged_result {
+  static constexpr ranged_bounds exact = Bounds::value;
+  static constexpr bool proven = exact.lo >= ranged_storage_min && exact.hi <= ranged_storage_max;
+  static constexpr ranged_bounds bounds{exact.lo < ranged_storage_min ? ranged_storage_min : exact.lo,
+                                        exact.hi > ranged_storage_max ? ranged_storage_max : exact.hi};
+  using value_type = std::tuple_element_t<ranged_storage_index(bounds), ranged_storage_types>;
+  using type = ranged_int<value_type, static_cast<value_type>(bounds.lo), static_cast<value_type>(bounds.hi), EP>;
+};
+
+template<typename R>
+inline constexpr ranged_bounds ranged_bounds_of{to_wide(R::min_value), to_wide(R::max_value)};
+
+template<arith_op Op, typename L, typename R>
+struct ranged_arith_bounds_for {
+  static constexpr ranged_bounds value = ranged_arith_bounds<Op>(ranged_bounds_of<L>, ranged_bounds_of<R>);
+};
+
+template<typename R>
+struct ranged_neg_bounds_for {
+  static constexpr ranged_bounds value{-ranged_bounds_of<R>.hi, -ranged_bounds_of<R>.lo};
+};
+
+template<typename R1, typename R2>
+struct ranged_union_bounds_for {
+  static constexpr ranged_bounds value =
+    ranged_hull(ranged_hull(ranged_bounds_of<R1>, ranged_bounds_of<R2>.lo), ranged_bounds_of<R2>.hi);
+};
+
+// Unit scaling through the library's integer scaling engine, truncating as for plain integers.
+// Scaling is monotonic, so the scaled range is given by the scaled bounds.
+template<auto M, typename T>
+[[nodiscard]] constexpr ranged_wide_t ranged_scale(T v)
+{
+  return static_cast<ranged_wide_t>(::mp_units::detail::scale_int<M, ::mp_units::detail::rounding_mode::truncated>(v));
+}
+
+template<auto M, typename R>
+struct ranged_scaled_bounds_for {
+  static constexpr ranged_bounds value =
+    ranged_hull(ranged_bounds{ranged_scale<M>(static_cast<std::int64_t>(R::min_value)),
+                              ranged_scale<M>(static_cast<std::int64_t>(R::min_value))},
+                ranged_scale<M>(static_cast<std::int64_t>(R::max_value)));
+};
+
+// `int` when every type involved fits in it, `std::int64_t` otherwise. A proven result fits in
+// its storage type, so computing in this type never overflows.
+template<typename... Ts>
+using ranged_calc_t =
+  std::conditional_t<((sizeof(Ts) < sizeof(int) || (sizeof(Ts) == sizeof(int) && is_signed_v<Ts>)) && ...), int,
+                     std::int64_t>;
+
+// A plain integer operand has the range of its type.
+template<std::integral T, typename EP>
+using ranged_int_for = ranged_int<T, std::numeric_limits<T>::min(), std::numeric_limits<T>::max(), EP>;
+
+template<typename T>
+concept RangedIntOperand =
+  std::integral<T> && !std::same_as<T, bool> && sizeof(T) <= sizeof(std::int64_t) &&
+  (is_signed_v<T> || sizeof(T) < sizeof(std::int64_t));
+
+template<typename T, typename EP>
+struct ranged_operand {
+  using type = T;
+};
+
+template<RangedIntOperand T, typename EP>
+struct ranged_operand<T, EP> {
+  using type = ranged_int_for<T, EP>;
+};
+
+template<typename T, typename EP>
+using ranged_operand_t = ranged_operand<T, EP>::type;
+
+template<typename L, typename R>
+using ranged_policy_t = std::conditional_t<is_ranged_int_v<L>, L, R>::error_policy;
+
+// Operands of a binary operation: at least one ranged_int, and all ranged_int operands with the same error policy.
+template<typename L, typename R>
+concept RangedIntOperands =
+  (is_ranged_int_v<L> || is_ranged_int_v<R>) && (is_ranged_int_v<L> || RangedIntOperand<L>) &&
+  (is_ranged_int_v<R> || RangedIntOperand<R>) &&
+  std::same_as<typename ranged_operand_t<L, ranged_policy_t<L, R>>::error_policy,
+               typename ranged_operand_t<R, ranged_policy_t<L, R>>::error_policy>;
+
+template<typename R, typename T>
+[[nodiscard]] constexpr R as_ranged(const T& v) noexcept
+{
+  if constexpr (is_ranged_int_v<T>)
+    return v;
+  else
+    return R{ranged_unchecked, v};
+}
+
+// `lhs op rhs` stored in the ranged_int type of the result range. Checked at runtime only when
+// the result range is not proven, and for division when the divisor range contains zero.
+template<arith_op Op, typename L, typename R>
+[[nodiscard]] constexpr auto ranged_arith(const L& lhs, const R& rhs)
+{
+  using ep = L::error_policy;
+  using res = ranged_result<ranged_arith_bounds_for<Op, L, R>, ep>;
+  using result_type = res::type;
+  using V = result_type::value_type;
+  if constexpr (Op == arith_op::div) {
+    static_assert(ranged_bounds_of<R>.lo != 0 || ranged_bounds_of<R>.hi != 0, "ranged_int: division by zero");
+    if constexpr (ranged_bounds_of<R>.lo <= 0 && ranged_bounds_of<R>.hi >= 0)
+      if (rhs.value_ == 0) ep::on_overflow("ranged_int: division by zero");
+  }
+  if constexpr (res::proven) {
+    using C = ranged_calc_t<typename L::value_type, typename R::value_type, V>;
+    return result_type{ranged_unchecked,
+                       static_cast<V>(apply_arith<Op>(static_cast<C>(lhs.value_), static_cast<C>(rhs.value_)))};
+  } else {
+    const ranged_wide_t r = apply_arith<Op>(to_wide(lhs.value_), to_wide(rhs.value_));
+    if (r < res::bounds.lo || r > res::bounds.hi) ep::on_overflow("ranged_int: result out of the 64-bit range");
+    return result_type{ranged_unchecked, static_cast<V>(r)};
+  }
+}
+
+template<arith_op Op, typename L, typename R>
+[[nodiscard]] constexpr auto ranged_binary(const L& lhs, const R& rhs)
+{
+  using ep = ranged_policy_t<L, R>;
+  return ranged_arith<Op>(as_ranged<ranged_operand_t<L, ep>>(lhs), as_ranged<ranged_operand_t<R, ep>>(rhs));
+}
+
+// Converts `v` to T, checking the range [Min, Max] unless it contains every value of `From`.
+template<typename T, T Min, T Max, typename EP, typename From>
+[[nodiscard]] constexpr T ranged_narrow(From v)
+{
+  if constexpr (to_wide(std::numeric_limits<From>::min()) < to_wide(Min) ||
+                to_wide(std::numeric_limits<From>::max()) > to_wide(Max))
+    if (!ranged_contains<Min, Max>(v)) EP::on_overflow("ranged_int: value out of range");
+  return static_cast<T>(v);
+}
+
+// ============================================================================
+// ranged_int_binary_ops: Hidden Friend Injection base (see safe_int_binary_ops)
+//
+// The operators take any two ranged_int specializations, or a ranged_int and a plain integer,
+// which is treated as a ranged_int with the range of its type.
+// ============================================================================
+
+struct ranged_int_binary_ops {
+  template<typename T, T A1, T B1, typename EP1, typename U, U A2, U B2, typename EP2>
+  [[nodiscard]] friend constexpr bool operator==(ranged_int<T, A1, B1, EP1> lhs,
+                                                 ranged_int<U, A2, B2, EP2> rhs) noexcept
+  {
+    return to_wide(lhs.value_) == to_wide(rhs.value_);
+  }
+
+  template<typename T, T A1, T B1, typename EP1, typename U, U A2, U B2, typename EP2>
+  [[nodiscard]] friend constexpr std::strong_ordering operator<=>(ranged_int<T, A1, B1, EP1> lhs,
+                                                                  ranged_int<U, A2, B2, EP2> rhs) noexcept
+  {
+    const ranged_wide_t l = to_wide(lhs.value_);
+    const ranged_wide_t r = to_wide(rhs.value_);
+    if (l < r) return std::strong_ordering::less;
+    if (l > r) return std::strong_ordering::greater;
+    return std::strong_ordering::equal;
+  }
+
+  template<typename L, typename R>
+    requires RangedIntOperands<L, R>
+  [[nodiscard]] friend constexpr auto operator+(const L& lhs, const R& rhs)
+  {
+    return ranged_binary<arith_op::add>(lhs, rhs);
+  }
+
+  template<typename L, typename R>
+    requires RangedIntOperands<L, R>
+  [[nodiscard]] friend constexpr auto operator-(const L& lhs, const R& rhs)
+  {
+    return ranged_binary<arith_op::sub>(lhs, rhs);
+  }
+
+  template<typename L, typename R>
+    requires RangedIntOperands<L, R>
+  [[nodiscard]] friend constexpr auto operator*(const L& lhs, const R& rhs)
+  {
+    return ranged_binary<arith_op::mul>(lhs, rhs);
+  }
+
+  template<typename L, typename R>
+    requires RangedIntOperands<L, R>
+  [[nodiscard]] friend constexpr auto operator/(const L& lhs, const R& rhs)
+  {
+    return ranged_binary<arith_op::div>(lhs, rhs);
+  }
+};
+
+}  // namespace detail
+
+/**
+ * @brief An integer representation type whose value range is tracked in its type.
+ *
+ * `ranged_int<T, Min, Max>` stores a `T` in `[Min, Max]`. `+`, `-`, `*`, and `/` return a
+ * `ranged_int` whose range is computed at compile time from the ranges of the operands, stored
+ * in the narrowest standard integer type that holds it. Such results cannot overflow, so they
+ * are not checked. A plain integer operand takes part with the range of its type.
+ *
+ * Scaling by a unit magnitude (e.g. `q.in(uV)`) scales the range in the same way through
+ * `operator*(ranged_int, UnitMagnitude)`, so unit conversions of a `quantity` stay unchecked too.
+ *
+ * `ErrorPolicy::on_overflow()` is invoked only where the range cannot be proven: when a result
+ * range does not fit in `std::int64_t`, on division by a range that contains zero, and when a
+ * value is converted into a `ranged_int` whose range does not contain all its possible values.
+ *
+ * @tparam T            the storage type; the bounds have to be representable in `std::int64_t`
+ * @tparam Min          the smallest value
+ * @tparam Max          the largest value
+ * @tparam ErrorPolicy  the error policy of `safe_int` (poisoning policies are not supported)
+ */
+template<std::integral T, T Min, T Max, OverflowPolicy ErrorPolicy>
+class ranged_int : detail::ranged_int_binary_ops {
+  static_assert(!std::same_as<T, bool> && sizeof(T) <= sizeof(std::int64_t),
+                "ranged_int: the storage type has to be an integer type of at most 64 bits");
+  static_assert(Min <= Max, "ranged_int: empty range");
+  static_assert(detail::to_wide(Max) <= detail::ranged_storage_max,
+                "ranged_int: the range has to be representable in std::int64_t");
+  static_assert(!detail::PoisoningOverflowPolicy<ErrorPolicy>,
+                "ranged_int: poisoning policies are not supported; a poisoned value is out of range");
+
+  static constexpr T default_value = Min <= T{} && T{} <= Max ? T{} : Min;
+
+  [[nodiscard]] static constexpr ranged_int<T, T{1}, T{1}, ErrorPolicy> one() noexcept
+  {
+    return {detail::ranged_unchecked, T{1}};
+  }
+
+public:
+  // public members required to satisfy structural type requirements :-(
+  T value_ = default_value;
+  using value_type = T;
+  using error_policy = ErrorPolicy;
+  static constexpr T min_value = Min;
+  static constexpr T max_value = Max;
+
+  [[nodiscard]] ranged_int() = default;
+
+  [[nodiscard]] constexpr ranged_int(detail::ranged_unchecked_t, T v) noexcept : value_(v) {}
+
+  template<detail::RangedIntOperand U>
+  [[nodiscard]] constexpr explicit(detail::to_wide(std::numeric_limits<U>::min()) < detail::to_wide(Min) ||
+                                   detail::to_wide(std::numeric_limits<U>::max()) > detail::to_wide(Max))
+    ranged_int(U v) : value_(detail::ranged_narrow<T, Min, Max, ErrorPolicy>(v))
+  {
+  }
+
+  template<typename U, U A, U B>
+  [[nodiscard]] constexpr explicit(!detail::ranged_contains<Min, Max>(A) || !detail::ranged_contains<Min, Max>(B))
+    ranged_int(ranged_int<U, A, B, ErrorPolicy> other) :
+      value_([&] {
+        if constexpr (!detail::ranged_contains<Min, Max>(A) || !detail::ranged_contains<Min, Max>(B))
+          if (!detail::ranged_contains<Min, Max>(other.value_))
+            ErrorPolicy::on_overflow("ranged_int: value out of range");
+        return static_cast<T>(other.value_);
+      }())
+  {
+  }
+
+  [[nodiscard]] constexpr explicit operator T() const noexcept { return value_; }
+  [[nodiscard]] constexpr T value() const noexcept { return value_; }
+
+  [[nodiscard]] constexpr ranged_int operator+() const noexcept { return *this; }
+
+  [[nodiscard]] constexpr auto operator-() const
+  {
+    using res = detail::ranged_result<detail::ranged_neg_bounds_for<ranged_int>, ErrorPolicy>;
+    using V = res::type::value_type;
+    using C = detail::ranged_calc_t<T, V>;
+    return typename res::type{detail::ranged_unchecked, static_cast<V>(-static_cast<C>(value_))};
+  }
+
+  // The result of an operation on `*this` has to be narrowed back into [Min, Max], so the mutating
+  // operators check the range unless the operation provably stays within it.
+  template<typename U>
+  constexpr ranged_int& operator+=(const U& rhs)
+    requires requires { ranged_int(*this + rhs); }
+  {
+    return *this = ranged_int(*this + rhs);
+  }
+
+  template<typename U>
+  constexpr ranged_int& operator-=(const U& rhs)
+    requires requires { ranged_int(*this - rhs); }
+  {
+    return *this = ranged_int(*this - rhs);
+  }
+
+  template<typename U>
+  constexpr ranged_int& operator*=(const U& rhs)
+    requires requires { ranged_int(*this * rhs); }
+  {
+    return *this = ranged_int(*this * rhs);
+  }
+
+  template<typename U>
+  constexpr ranged_int& operator/=(const U& rhs)
+    requires requires { ranged_int(*this / rhs); }
+  {
+    return *this = ranged_int(*this / rhs);
+  }
+
+  constexpr ranged_int& operator++() { return *this += one(); }
+
+  constexpr ranged_int operator++(int)
+  {
+    auto tmp = *this;
+    ++(*this);
+    return tmp;
+  }
+
+  constexpr ranged_int& operator--() { return *this -= one(); }
+
+  constexpr ranged_int operator--(int)
+  {
+    auto tmp = *this;
+    --(*this);
+    return tmp;
+  }
+
+  // Unit scaling: the range is scaled together with the value.
+  template<UnitMagnitude M>
+  [[nodiscard]] friend constexpr auto operator*(const ranged_int& v, M)
+  {
+    using res = detail::ranged_result<detail::ranged_scaled_bounds_for<M{}, ranged_int>, ErrorPolicy>;
+    using V = res::type::value_type;
+    if constexpr (res::proven) {
+      using C = detail::ranged_calc_t<T, V>;
+      return typename res::type{detail::ranged_unchecked,
+                                static_cast<V>(detail::ranged_scale<M{}>(static_cast<C>(v.value_)))};
+    } else {
+      const detail::ranged_wide_t r = detail::ranged_scale<M{}>(static_cast<std::int64_t>(v.value_));
+      if (r < res::bounds.lo || r > res::bounds.hi) ErrorPolicy::on_overflow("ranged_int: scaling overflow");
+      return typename res::type{detail::ranged_unchecked, static_cast<V>(r)};
+    }
+  }
+
+#if MP_UNITS_HOSTED
+  template<typename CharT, typename Traits>
+  friend std::basic_ostream<CharT, Traits>& operator<<(std::basic_ostream<CharT, Traits>& os, ranged_int v)
+  {
+    if constexpr (sizeof(T) == 1)
+      return os << static_cast<int>(v.value_);  // promote char-width types to int for streaming
+    else
+      return os << v.value_;
+  }
+#endif
+};
+
+/**
+ * @brief A `ranged_int` holding the single value `V`
+ *
+ * Useful for constant factors, whose exact value keeps the result range tight (e.g. `adc * ranged_c<25>`).
+ */
+MP_UNITS_EXPORT template<auto V>
+  requires detail::RangedIntOperand<decltype(V)>
+inline constexpr ranged_int<decltype(V), V, V> ranged_c{detail::ranged_unchecked, V};
+
+}  // namespace mp_units::utility
+
+namespace mp_units {
+
+template<typename T, T Min, T Max, typename ErrorPolicy>
+struct constraint_violation_handler<utility::ranged_int<T, Min, Max, ErrorPolicy>> {
+  static constexpr void on_violation(std::string_view msg) { ErrorPolicy::on_constraint_violation(msg); }
+};
+
+}  // namespace mp_units
+
+namespace std {
+
+// The union of both ranges, so that the operands of a heterogeneous operation share a type.
+template<typename T1, T1 Min1, T1 Max1, typename T2, T2 Min2, T2 Max2, typename ErrorPolicy>
+struct common_type<mp_units::utility::ranged_int<T1, Min1, Max1, ErrorPolicy>,
+                   mp_units::utility::ranged_int<T2, Min2, Max2, ErrorPolicy>> {
+private:
+  using R1 = mp_units::utility::ranged_int<T1, Min1, Max1, ErrorPolicy>;
+  using R2 = mp_units::utility::ranged_int<T2, Min2, Max2, ErrorPolicy>;
+  using res = mp_units::utility::detail::ranged_result<mp_units::utility::detail::ranged_union_bounds_for<R1, R2>,
+                                                       ErrorPolicy>;
+  using common_value_type = common_type_t<T1, T2>;
+  static constexpr bool fits_common = mp_units::utility::detail::to_wide(numeric_limits<common_value_type>::min()) <=
+                                        res::bounds.lo &&
+                                      mp_units::utility::detail::to_wide(numeric_limits<common_value_type>::max()) >=
+                                        res::bounds.hi;
+  using value_type = conditional_t<fits_common, common_value_type, typename res::value_type>;
+public:
+  using type = mp_units::utility::ranged_int<value_type, static_cast<value_type>(res::bounds.lo),
+                                             static_cast<value_type>(res::bounds.hi), ErrorPolicy>;
+};
+
+// std::numeric_limits specialization — the range of the type
+template<typename T, T Min, T Max, typename ErrorPolicy>
+class numeric_limits<mp_units::utility::ranged_int<T, Min, Max, ErrorPolicy>> : public numeric_limits<T> {
+  using R = mp_units::utility::ranged_int<T, Min, Max, ErrorPolicy>;
+public:
+  [[nodiscard]] static constexpr R lowest() noexcept { return {mp_units::utility::detail::ranged_unchecked, Min}; }
+  [[nodiscard]] static constexpr R min() noexcept { return {mp_units::utility::detail::ranged_unchecked, Min}; }
+  [[nodiscard]] static constexpr R max() noexcept { return {mp_units::utility::detail::ranged_unchecked, Max}; }
+};
+
+}  // namespace std
+
+#if MP_UNITS_HOSTED
+template<typename T, T Min, T Max, typename ErrorPolicy, typename Char>
+struct MP_UNITS_STD_FMT::formatter<mp_units::utility::ranged_int<T, Min, Max, ErrorPolicy>, Char> :
+    formatter<T, Char> {
+  template<typename FormatContext>
+  auto format(const mp_units::utility::ranged_int<T, Min, Max, ErrorPolicy>& v, FormatContext& ctx) const
+  {
+    return formatter<T, Char>::format(v.value(), ctx);
+  }
+};
+#endif
@@ -70,6 +70,23 @@ MP_UNITS_EXPORT struct safe_int_terminate_policy : terminate_policy {
   [[noreturn]] static void on_overflow(std::string_view) noexcept { std::abort(); }
 };
 
+/**
+ * @brief Error policy that poisons the result of an overflowing operation (freestanding-safe).
+ *
+ * Nothing is reported at the point of failure. An overflowing operation (or a division by zero)
+ * yields a reserved poison value instead, and every operation with a poisoned operand yields the
+ * poison again, the way NaN propagates through floating-point arithmetic. The checks are
+ * branch-free, so loops over such values stay auto-vectorizable; test `is_poisoned()` once at the
+ * end of a batch instead of handling every step.
+ *
+ * The poison value is the most negative value of a signed type and the largest value of an
+ * unsigned one. It is reserved: a regular result equal to it is reported as poisoned as well.
+ */
+MP_UNITS_EXPORT struct safe_int_poison_policy : terminate_policy {
+  static constexpr bool poisons_on_overflow = true;
+  static constexpr void on_overflow(std::string_view) noexcept {}
+};
+
 #if MP_UNITS_HOSTED
 
 /**
@@ -196,6 +213,132 @@ template<integral T>
     return v != T{0};  // negation of any non-zero unsigned overflows
 }
 
+// ============================================================================
+// Poisoning support (see safe_int_poison_policy)
+//
+// The helpers below compute the result and the overflow flag together without branching:
+// wrapping arithmetic in the unsigned counterpart plus sign-bit tests for add/sub, a
+// double-width product (or the compiler builtin) for mul, and a select of a harmless divisor
+// for div/mod. A loop over poisoning values therefore contains no control flow.
+// ============================================================================
+
+template<typename EP>
+concept PoisoningOverflowPolicy = requires { requires EP::poisons_on_overflow; };
+
+// The most negative value for signed T and the largest one for unsigned T, derived from the
+// binary representation (std::numeric_limits is not specialized for __int128 in GCC strict mode).
+template<integral T>
+[[nodiscard]] constexpr T poison_value() noexcept
+{
+  if constexpr (is_signed_v<T>) {
+    using U = min_width_uint_t<integer_rep_width_v<T>>;
+    const T max = static_cast<T>(static_cast<U>(~U{0}) >> 1);
+    return static_cast<T>(-max - T{1});
+  } else
+    return static_cast<T>(~T{0});
+}
+
+enum class arith_op : std::int8_t { add, sub, mul, div, mod };
+
+template<arith_op Op>
+inline constexpr std::string_view arith_overflow_message = [] {
+  if constexpr (Op == arith_op::add)
+    return "safe_int: addition overflow";
+  else if constexpr (Op == arith_op::sub)
+    return "safe_int: subtraction overflow";
+  else if constexpr (Op == arith_op::mul)
+    return "safe_int: multiplication overflow";
+  else if constexpr (Op == arith_op::div)
+    return "safe_int: division overflow";
+  else
+    return "safe_int: modulo by zero";
+}();
+
+template<arith_op Op, integral T>
+[[nodiscard]] constexpr bool arith_overflows(T lhs, T rhs) noexcept
+{
+  if constexpr (Op == arith_op::add)
+    return add_overflows(lhs, rhs);
+  else if constexpr (Op == arith_op::sub)
+    return sub_overflows(lhs, rhs);
+  else if constexpr (Op == arith_op::mul)
+    return mul_overflows(lhs, rhs);
+  else if constexpr (Op == arith_op::div)
+    return div_overflows(lhs, rhs);
+  else
+    return rhs == T{0};
+}
+
+// Plain `lhs op rhs` in T; the caller guarantees that it does not overflow.
+template<arith_op Op, integral T>
+[[nodiscard]] constexpr T apply_arith(T lhs, T rhs) noexcept
+{
+  if constexpr (Op == arith_op::add)
+    return static_cast<T>(lhs + rhs);
+  else if constexpr (Op == arith_op::sub)
+    return static_cast<T>(lhs - rhs);
+  else if constexpr (Op == arith_op::mul)
+    return static_cast<T>(lhs * rhs);
+  else if constexpr (Op == arith_op::div)
+    return static_cast<T>(lhs / rhs);
+  else
+    return static_cast<T>(lhs % rhs);
+}
+
+// Stores `lhs op rhs` in `res` and returns whether the operation overflowed (or divided by zero),
+// without branching. `res` is unspecified when `true` is returned.
+template<arith_op Op, integral T>
+[[nodiscard]] constexpr bool overflowing_arith(T lhs, T rhs, T& res) noexcept
+{
+  if constexpr (std::is_class_v<T>) {
+    // synthetic 128-bit integer (no native __int128): no wrapping arithmetic to build on
+    const bool overflow = arith_overflows<Op>(lhs, rhs);
+    res = overflow ? T{} : apply_arith<Op>(lhs, rhs);
+    return overflow;
+  } else if constexpr (Op == arith_op::add || Op == arith_op::sub) {
+    using U = min_width_uint_t<integer_rep_width_v<T>>;
+    const auto l = static_cast<U>(lhs);
+    const auto r = static_cast<U>(rhs);
+    res = static_cast<T>(static_cast<U>(Op == arith_op::add ? l + r : l - r));
+    if constexpr (is_signed_v<T>) {
+      // add: the operands share a sign that the result does not have
+      // sub: the operands differ in sign and the result's sign differs from lhs
+      if constexpr (Op == arith_op::add)
+        return ((lhs ^ res) & (rhs ^ res)) < 0;
+      else
+        return ((lhs ^ rhs) & (lhs ^ res)) < 0;
+    } else if constexpr (Op == arith_op::add)
+      return res < lhs;
+    else
+      return lhs < rhs;
+  } else if constexpr (Op == arith_op::mul) {
+    if constexpr (integer_rep_width_v<T> < 64) {
+      using wide = double_width_int_for_t<T>;
+      const wide product = static_cast<wide>(lhs) * static_cast<wide>(rhs);
+      res = static_cast<T>(product);
+      return product != static_cast<wide>(res);
+    } else {
+#if MP_UNITS_HAS_BUILTIN(__builtin_mul_overflow)
+      return __builtin_mul_overflow(lhs, rhs, &res);
+#else
+      const bool overflow = mul_overflows(lhs, rhs);
+      res = overflow ? T{} : static_cast<T>(lhs * rhs);
+      return overflow;
+#endif
+    }
+  } else {
+    // Divide by 1 instead of trapping on a zero divisor (and, for signed T, on min / -1, whose
+    // remainder is 0 but whose quotient overflows).
+    bool trap = rhs == T{0};
+    if constexpr (is_signed_v<T>) trap = trap | ((lhs == poison_value<T>()) & (rhs == T{-1}));
+    res = apply_arith<Op>(lhs, trap ? T{1} : rhs);
+    if constexpr (Op == arith_op::div)
+      return trap;
+    else
+      return rhs == T{0};
+  }
+}
+
 // Extracts the underlying integral type from an arithmetic wrapper:
 //   - plain integral T                              → T
 //   - integral wrapper with value_type (safe_int<T>, constrained<T,...>) → T::value_type
@@ -288,8 +431,12 @@ template<integral To, typename EP, typename From>
   requires std::is_constructible_v<To, const From&>
 [[nodiscard]] constexpr To checked_int_cast(const From& v)
 {
-  if constexpr (integral<std::remove_cvref_t<From>> && !is_value_preserving_int_v<std::remove_cvref_t<From>, To>)
-    if (!int_in_range<To>(v)) EP::on_overflow("safe_int: narrowing conversion overflow");
+  if constexpr (integral<std::remove_cvref_t<From>> && !is_value_preserving_int_v<std::remove_cvref_t<From>, To>) {
+    if constexpr (PoisoningOverflowPolicy<EP>)
+      return int_in_range<To>(v) ? silent_cast<To>(v) : poison_value<To>();
+    else if (!int_in_range<To>(v))
+      EP::on_overflow("safe_int: narrowing conversion overflow");
+  }
   return silent_cast<To>(v);
 }
 
@@ -313,6 +460,43 @@ using integral_op_result_t = decltype(A{} + B{});
 template<integral A, integral B>
 inline constexpr bool same_sign_v = is_signed_v<A> == is_signed_v<B>;
 
+template<typename T>
+[[nodiscard]] constexpr auto operand_value(const T& v) noexcept
+{
+  if constexpr (is_safe_int_v<T>)
+    return v.value_;
+  else
+    return v;
+}
+
+template<typename EP, typename T>
+[[nodiscard]] constexpr bool operand_poisoned(const T& v) noexcept
+{
+  if constexpr (PoisoningOverflowPolicy<EP> && is_safe_int_v<T>)
+    return v.value_ == poison_value<typename T::value_type>();
+  else
+    return false;
+}
+
+// `lhs op rhs` evaluated in R, where each operand is a safe_int or an integral scalar.
+// Overflow is reported through EP; a poisoning EP gets the poison value instead, also when a
+// safe_int operand is already poisoned.
+template<arith_op Op, typename EP, integral R, typename Lhs, typename Rhs>
+[[nodiscard]] constexpr R checked_arith(const Lhs& lhs, const Rhs& rhs,
+                                        std::string_view msg = arith_overflow_message<Op>)
+{
+  const auto l = static_cast<R>(operand_value(lhs));
+  const auto r = static_cast<R>(operand_value(rhs));
+  if constexpr (PoisoningOverflowPolicy<EP>) {
+    R res{};
+    const bool poisoned = overflowing_arith<Op>(l, r, res) | operand_poisoned<EP>(lhs) | operand_poisoned<EP>(rhs);
+    return poisoned ? poison_value<R>() : res;
+  } else {
+    if (arith_overflows<Op>(l, r)) EP::on_overflow(msg);
+    return apply_arith<Op>(l, r);
+  }
+}
+
 // ============================================================================
 // safe_int_binary_ops: Hidden Friend Injection base
 //
@@ -358,9 +542,7 @@ struct safe_int_binary_ops {
     -> safe_int<integral_op_result_t<T, U>, EP>
   {
     using R = integral_op_result_t<T, U>;
-    if (add_overflows<R>(static_cast<R>(lhs.value_), static_cast<R>(rhs.value_)))
-      EP::on_overflow("safe_int: addition overflow");
-    return lhs.value_ + rhs.value_;
+    return checked_arith<arith_op::add, EP, R>(lhs, rhs);
   }
 
   template<integral T, integral U, typename EP>
@@ -369,9 +551,7 @@ struct safe_int_binary_ops {
     -> safe_int<integral_op_result_t<T, U>, EP>
   {
     using R = integral_op_result_t<T, U>;
-    if (sub_overflows<R>(static_cast<R>(lhs.value_), static_cast<R>(rhs.value_)))
-      EP::on_overflow("safe_int: subtraction overflow");
-    return lhs.value_ - rhs.value_;
+    return checked_arith<arith_op::sub, EP, R>(lhs, rhs);
   }
 
   template<integral T, integral U, typename EP>
@@ -380,9 +560,7 @@ struct safe_int_binary_ops {
     -> safe_int<integral_op_result_t<T, U>, EP>
   {
     using R = integral_op_result_t<T, U>;
-    if (mul_overflows<R>(static_cast<R>(lhs.value_), static_cast<R>(rhs.value_)))
-      EP::on_overflow("safe_int: multiplication overflow");
-    return lhs.value_ * rhs.value_;
+    return checked_arith<arith_op::mul, EP, R>(lhs, rhs);
   }
 
   template<integral T, integral U, typename EP>
@@ -391,9 +569,7 @@ struct safe_int_binary_ops {
     -> safe_int<integral_op_result_t<T, U>, EP>
   {
     using R = integral_op_result_t<T, U>;
-    if (div_overflows<R>(static_cast<R>(lhs.value_), static_cast<R>(rhs.value_)))
-      EP::on_overflow("safe_int: division overflow");
-    return lhs.value_ / rhs.value_;
+    return checked_arith<arith_op::div, EP, R>(lhs, rhs);
   }
 
   template<integral T, integral U, typename EP>
@@ -401,8 +577,7 @@ struct safe_int_binary_ops {
   [[nodiscard]] friend constexpr auto operator%(safe_int<T, EP> lhs, safe_int<U, EP> rhs)
     -> safe_int<integral_op_result_t<T, U>, EP>
   {
-    if (rhs.value_ == U{0}) EP::on_overflow("safe_int: modulo by zero");
-    return lhs.value_ % rhs.value_;
+    return checked_arith<arith_op::mod, EP, integral_op_result_t<T, U>>(lhs, rhs);
   }
 };
 
@@ -431,8 +606,6 @@ MP_UNITS_EXPORT template<detail::integral T,
                          OverflowPolicy ErrorPolicy = safe_int_terminate_policy>
 #endif
 class safe_int : detail::safe_int_binary_ops {
-  // Invoke ErrorPolicy and return a safe default (for use from noexcept compound-assign paths).
-  static constexpr void handle_overflow(std::string_view msg) { ErrorPolicy::on_overflow(msg); }
 public:
   // public members required to satisfy structural type requirements :-(
   T value_{};
@@ -451,13 +624,25 @@ public:
 
   template<detail::integral U>
   [[nodiscard]] constexpr explicit(!detail::is_value_preserving_int_v<U, T>) safe_int(safe_int<U, ErrorPolicy> other) :
-      value_(detail::checked_int_cast<T, ErrorPolicy>(other.value()))
+      value_(detail::operand_poisoned<ErrorPolicy>(other) ? detail::poison_value<T>()
+                                                          : detail::checked_int_cast<T, ErrorPolicy>(other.value()))
   {
   }
 
   [[nodiscard]] constexpr explicit operator T() const noexcept { return value_; }
   [[nodiscard]] constexpr T value() const noexcept { return value_; }
 
+  /**
+   * @brief Whether an overflow happened somewhere in the computation of this value.
+   *
+   * Only available with a poisoning error policy (e.g. `safe_int_poison_policy`).
+   */
+  [[nodiscard]] constexpr bool is_poisoned() const noexcept
+    requires detail::PoisoningOverflowPolicy<ErrorPolicy>
+  {
+    return value_ == detail::poison_value<T>();
+  }
+
   // ==========================================================================
   // Unary operators (+, -, ++, --)
   // Models integral promotion: sub-int types (char, short) promote to int.
@@ -472,16 +657,15 @@ public:
   MP_UNITS_DIAGNOSTIC_IGNORE_UNARY_MINUS_UNSIGNED
   [[nodiscard]] constexpr auto operator-() const -> safe_int<decltype(-value_), ErrorPolicy>
   {
-    if (detail::neg_overflows(+value_)) handle_overflow("safe_int: negation overflow");
-    return -value_;
+    using R = decltype(-value_);
+    return detail::checked_arith<detail::arith_op::sub, ErrorPolicy, R>(R{0}, *this, "safe_int: negation overflow");
   }
   MP_UNITS_DIAGNOSTIC_POP
 
   // -- Increment / decrement (use add/sub overflow check when T is integral) --
   constexpr safe_int& operator++()
   {
-    if (detail::add_overflows(value_, T{1})) handle_overflow("safe_int: increment overflow");
-    ++value_;
+    value_ = detail::checked_arith<detail::arith_op::add, ErrorPolicy, T>(*this, T{1}, "safe_int: increment overflow");
     return *this;
   }
 
@@ -494,8 +678,7 @@ public:
 
   constexpr safe_int& operator--()
   {
-    if (detail::sub_overflows(value_, T{1})) handle_overflow("safe_int: decrement overflow");
-    --value_;
+    value_ = detail::checked_arith<detail::arith_op::sub, ErrorPolicy, T>(*this, T{1}, "safe_int: decrement overflow");
     return *this;
   }
 
@@ -515,36 +698,31 @@ public:
   // -- Compound assignment --
   constexpr safe_int& operator+=(safe_int rhs)
   {
-    if (detail::add_overflows(value_, rhs.value_)) handle_overflow("safe_int: addition overflow");
-    value_ += rhs.value_;
+    value_ = detail::checked_arith<detail::arith_op::add, ErrorPolicy, T>(*this, rhs);
     return *this;
   }
 
   constexpr safe_int& operator-=(safe_int rhs)
   {
-    if (detail::sub_overflows(value_, rhs.value_)) handle_overflow("safe_int: subtraction overflow");
-    value_ -= rhs.value_;
+    value_ = detail::checked_arith<detail::arith_op::sub, ErrorPolicy, T>(*this, rhs);
     return *this;
   }
 
   constexpr safe_int& operator*=(safe_int rhs)
   {
-    if (detail::mul_overflows(value_, rhs.value_)) handle_overflow("safe_int: multiplication overflow");
-    value_ *= rhs.value_;
+    value_ = detail::checked_arith<detail::arith_op::mul, ErrorPolicy, T>(*this, rhs);
     return *this;
   }
 
   constexpr safe_int& operator/=(safe_int rhs)
   {
-    if (detail::div_overflows(value_, rhs.value_)) handle_overflow("safe_int: division overflow");
-    value_ /= rhs.value_;
+    value_ = detail::checked_arith<detail::arith_op::div, ErrorPolicy, T>(*this, rhs);
     return *this;
   }
 
   constexpr safe_int& operator%=(safe_int rhs)
   {
-    if (rhs.value_ == T{0}) handle_overflow("safe_int: modulo by zero");
-    value_ %= rhs.value_;
+    value_ = detail::checked_arith<detail::arith_op::mod, ErrorPolicy, T>(*this, rhs);
     return *this;
   }
 
@@ -562,43 +740,34 @@ public:
     -> safe_int<detail::integral_op_result_t<T, T>, ErrorPolicy>
   {
     using R = detail::integral_op_result_t<T, T>;
-    if (detail::add_overflows<R>(static_cast<R>(lhs.value_), static_cast<R>(rhs.value_)))
-      ErrorPolicy::on_overflow("safe_int: addition overflow");
-    return lhs.value_ + rhs.value_;
+    return detail::checked_arith<detail::arith_op::add, ErrorPolicy, R>(lhs, rhs);
   }
 
   [[nodiscard]] friend constexpr auto operator-(safe_int lhs, safe_int rhs)
     -> safe_int<detail::integral_op_result_t<T, T>, ErrorPolicy>
   {
     using R = detail::integral_op_result_t<T, T>;
-    if (detail::sub_overflows<R>(static_cast<R>(lhs.value_), static_cast<R>(rhs.value_)))
-      ErrorPolicy::on_overflow("safe_int: subtraction overflow");
-    return lhs.value_ - rhs.value_;
+    return detail::checked_arith<detail::arith_op::sub, ErrorPolicy, R>(lhs, rhs);
   }
 
   [[nodiscard]] friend constexpr auto operator*(safe_int lhs, safe_int rhs)
     -> safe_int<detail::integral_op_result_t<T, T>, ErrorPolicy>
   {
     using R = detail::integral_op_result_t<T, T>;
-    if (detail::mul_overflows<R>(static_cast<R>(lhs.value_), static_cast<R>(rhs.value_)))
-      ErrorPolicy::on_overflow("safe_int: multiplication overflow");
-    return lhs.value_ * rhs.value_;
+    return detail::checked_arith<detail::arith_op::mul, ErrorPolicy, R>(lhs, rhs);
   }
 
   [[nodiscard]] friend constexpr auto operator/(safe_int lhs, safe_int rhs)
     -> safe_int<detail::integral_op_result_t<T, T>, ErrorPolicy>
   {
     using R = detail::integral_op_result_t<T, T>;
-    if (detail::div_overflows<R>(static_cast<R>(lhs.value_), static_cast<R>(rhs.value_)))
-      ErrorPolicy::on_overflow("safe_int: division overflow");
-    return lhs.value_ / rhs.value_;
+    return detail::checked_arith<detail::arith_op::div, ErrorPolicy, R>(lhs, rhs);
   }
 
   [[nodiscard]] friend constexpr auto operator%(safe_int lhs, safe_int rhs)
     -> safe_int<detail::integral_op_result_t<T, T>, ErrorPolicy>
   {
-    if (rhs.value_ == T{0}) ErrorPolicy::on_overflow("safe_int: modulo by zero");
-    return lhs.value_ % rhs.value_;
+    return detail::checked_arith<detail::arith_op::mod, ErrorPolicy, detail::integral_op_result_t<T, T>>(lhs, rhs);
   }
 
   [[nodiscard]] friend constexpr bool operator==(safe_int lhs, safe_int rhs) noexcept
@@ -627,9 +796,7 @@ public:
     -> safe_int<detail::integral_op_result_t<T, U>, ErrorPolicy>
   {
     using R = decltype(lhs.value_ + rhs);
-    if (detail::add_overflows<R>(static_cast<R>(lhs.value_), static_cast<R>(rhs)))
-      ErrorPolicy::on_overflow("safe_int: addition overflow");
-    return lhs.value_ + rhs;
+    return detail::checked_arith<detail::arith_op::add, ErrorPolicy, R>(lhs, rhs);
   }
 
   template<typename U>
@@ -638,9 +805,7 @@ public:
     -> safe_int<detail::integral_op_result_t<U, T>, ErrorPolicy>
   {
     using R = decltype(lhs + rhs.value_);
-    if (detail::add_overflows<R>(static_cast<R>(lhs), static_cast<R>(rhs.value_)))
-      ErrorPolicy::on_overflow("safe_int: addition overflow");
-    return lhs + rhs.value_;
+    return detail::checked_arith<detail::arith_op::add, ErrorPolicy, R>(lhs, rhs);
   }
 
   template<typename U>
@@ -649,9 +814,7 @@ public:
     -> safe_int<detail::integral_op_result_t<T, U>, ErrorPolicy>
   {
     using R = decltype(lhs.value_ - rhs);
-    if (detail::sub_overflows<R>(static_cast<R>(lhs.value_), static_cast<R>(rhs)))
-      ErrorPolicy::on_overflow("safe_int: subtraction overflow");
-    return lhs.value_ - rhs;
+    return detail::checked_arith<detail::arith_op::sub, ErrorPolicy, R>(lhs, rhs);
   }
 
   template<typename U>
@@ -660,9 +823,7 @@ public:
     -> safe_int<detail::integral_op_result_t<U, T>, ErrorPolicy>
   {
     using R = decltype(lhs - rhs.value_);
-    if (detail::sub_overflows<R>(static_cast<R>(lhs), static_cast<R>(rhs.value_)))
-      ErrorPolicy::on_overflow("safe_int: subtraction overflow");
-    return lhs - rhs.value_;
+    return detail::checked_arith<detail::arith_op::sub, ErrorPolicy, R>(lhs, rhs);
   }
 
   template<typename U>
@@ -671,9 +832,7 @@ public:
     -> safe_int<detail::integral_op_result_t<T, U>, ErrorPolicy>
   {
     using R = decltype(lhs.value_ * rhs);
-    if (detail::mul_overflows<R>(static_cast<R>(lhs.value_), static_cast<R>(rhs)))
-      ErrorPolicy::on_overflow("safe_int: multiplication overflow");
-    return lhs.value_ * rhs;
+    return detail::checked_arith<detail::arith_op::mul, ErrorPolicy, R>(lhs, rhs);
   }
 
   template<typename U>
@@ -682,9 +841,7 @@ public:
     -> safe_int<detail::integral_op_result_t<U, T>, ErrorPolicy>
   {
     using R = decltype(lhs * rhs.value_);
-    if (detail::mul_overflows<R>(static_cast<R>(lhs), static_cast<R>(rhs.value_)))
-      ErrorPolicy::on_overflow("safe_int: multiplication overflow");
-    return lhs * rhs.value_;
+    return detail::checked_arith<detail::arith_op::mul, ErrorPolicy, R>(lhs, rhs);
   }
 
   template<typename U>
@@ -693,9 +850,7 @@ public:
     -> safe_int<detail::integral_op_result_t<T, U>, ErrorPolicy>
   {
     using R = decltype(lhs.value_ / rhs);
-    if (detail::div_overflows<R>(static_cast<R>(lhs.value_), static_cast<R>(rhs)))
-      ErrorPolicy::on_overflow("safe_int: division overflow");
-    return lhs.value_ / rhs;
+    return detail::checked_arith<detail::arith_op::div, ErrorPolicy, R>(lhs, rhs);
   }
 
   template<typename U>
@@ -704,9 +859,7 @@ public:
     -> safe_int<detail::integral_op_result_t<U, T>, ErrorPolicy>
   {
     using R = decltype(lhs / rhs.value_);
-    if (detail::div_overflows<R>(static_cast<R>(lhs), static_cast<R>(rhs.value_)))
-      ErrorPolicy::on_overflow("safe_int: division overflow");
-    return static_cast<R>(lhs) / static_cast<R>(rhs.value_);
+    return detail::checked_arith<detail::arith_op::div, ErrorPolicy, R>(lhs, rhs);
   }
 
   template<typename U>
@@ -714,8 +867,7 @@ public:
   [[nodiscard]] friend constexpr auto operator%(safe_int lhs, U rhs)
     -> safe_int<detail::integral_op_result_t<T, U>, ErrorPolicy>
   {
-    if (rhs == U{0}) ErrorPolicy::on_overflow("safe_int: modulo by zero");
-    return lhs.value_ % rhs;
+    return detail::checked_arith<detail::arith_op::mod, ErrorPolicy, detail::integral_op_result_t<T, U>>(lhs, rhs);
   }
 
   template<typename U>
@@ -723,8 +875,7 @@ public:
   [[nodiscard]] friend constexpr auto operator%(U lhs, safe_int rhs)
     -> safe_int<detail::integral_op_result_t<U, T>, ErrorPolicy>
   {
-    if (rhs.value_ == T{0}) ErrorPolicy::on_overflow("safe_int: modulo by zero");
-    return lhs % rhs.value_;
+    return detail::checked_arith<detail::arith_op::mod, ErrorPolicy, detail::integral_op_result_t<U, T>>(lhs, rhs);
   }
 
   template<typename U>
@@ -33,6 +33,9 @@
 //   - `representation_canonical_type` for every Eigen expression, mapping it to the evaluated
 //     `PlainObject` so a `quantity` never stores a lazy expression template (which would hold
 //     dangling references to its operands).
+//   - `as_eigen_map()` and `as_quantity_span()`, which view contiguous quantities as an
+//     `Eigen::Map` and contiguous Eigen storage as quantities without copying, with the
+//     reference kept in an `eigen_quantity_view`.
 //
 // The whole header is inert unless Eigen is actually available, so it is always safe to include.
 //
@@ -43,14 +46,19 @@
 
 #if __has_include(<Eigen/Core>)
 
+#include <mp-units/bits/module_macros.h>
+
 #ifndef MP_UNITS_IN_MODULE_INTERFACE
 #include <Eigen/Core>
 #include <mp-units/framework/customization_points.h>
+#include <mp-units/framework/quantity.h>
+#include <mp-units/framework/reference_concepts.h>
 #ifdef MP_UNITS_IMPORT_STD
 import std;
 #else
 #include <concepts>
 #include <cstddef>
+#include <span>
 #include <type_traits>
 #include <utility>
 #endif
@@ -92,8 +100,128 @@ concept eigen_fixed_vector = requires { typename T::PlainObject; } && std::deriv
                              (T::SizeAtCompileTime != Eigen::Dynamic) && (T::SizeAtCompileTime >= 1) &&
                              (T::RowsAtCompileTime == 1 || T::ColsAtCompileTime == 1);
 
+// An Eigen vector whose coefficients are contiguous in memory (a `Matrix`, an `Array`, or a `Map`
+// or `Ref` of one with a unit inner stride), i.e. one that can be viewed as a span of quantities.
+template<typename T>
+concept eigen_contiguous_vector =
+  requires(T& v) {
+    typename T::PlainObject;
+    { v.data() } -> std::same_as<std::remove_reference_t<decltype(*v.data())>*>;
+  } && std::derived_from<T, Eigen::EigenBase<T>> && (T::IsVectorAtCompileTime == 1) &&
+  (T::InnerStrideAtCompileTime == 1);
+
+// The zero-copy views reinterpret an array of quantities as an array of their numerical values and
+// back, which is only possible when a quantity is laid out exactly as its representation.
+template<typename Q>
+concept layout_compatible_with_rep = std::is_standard_layout_v<Q> && (sizeof(Q) == sizeof(typename Q::rep)) &&
+                                     (alignof(Q) == alignof(typename Q::rep));
+
+[[nodiscard]] consteval int eigen_extent(std::size_t extent)
+{
+  return extent == std::dynamic_extent ? Eigen::Dynamic : static_cast<int>(extent);
+}
+
 }  // namespace detail
 
+/**
+ * @brief An Eigen object holding the numerical values of quantities in the unit of `R`
+ *
+ * It is the bridge between the quantities and Eigen: `eigen()` exposes the Eigen object for
+ * any Eigen algorithm, and the reference stays in the type so that a result can be reattached
+ * to the quantities it represents. A result is wrapped with the reference computed from the
+ * operands at compile time:
+ *
+ * @code{.cpp}
+ * eigen_quantity_view d = as_eigen_map(std::span{distances});
+ * eigen_quantity_view t = as_eigen_map(std::span{durations});
+ * eigen_quantity_view v{d.eigen().cwiseQuotient(t.eigen()), d.reference / t.reference};
+ * quantity<si::metre / si::second> v0 = v[0];
+ * @endcode
+ *
+ * The wrapped object is stored by value, so an Eigen expression still refers to its operands.
+ *
+ * @tparam R the reference of the quantities
+ * @tparam Expr an Eigen vector type, usually an `Eigen::Map` or an expression
+ */
+MP_UNITS_EXPORT template<Reference auto R, typename Expr>
+  requires std::derived_from<Expr, Eigen::EigenBase<Expr>> && (Expr::IsVectorAtCompileTime == 1)
+class eigen_quantity_view {
+  Expr expr_;
+
+public:
+  static constexpr Reference auto reference = R;
+  using eigen_type = Expr;
+  using rep = std::remove_cv_t<typename Expr::Scalar>;
+  using value_type = quantity<R, rep>;
+
+  [[nodiscard]] constexpr explicit eigen_quantity_view(Expr expr) : expr_(std::move(expr)) {}
+  [[nodiscard]] constexpr eigen_quantity_view(Expr expr, decltype(R)) : expr_(std::move(expr)) {}
+
+  [[nodiscard]] constexpr Expr& eigen() & { return expr_; }
+  [[nodiscard]] constexpr const Expr& eigen() const& { return expr_; }
+
+  [[nodiscard]] constexpr Eigen::Index size() const { return expr_.size(); }
+  [[nodiscard]] constexpr value_type operator[](Eigen::Index i) const { return value_type{expr_.coeff(i), R}; }
+};
+
+template<typename Expr, Reference R>
+eigen_quantity_view(Expr, R) -> eigen_quantity_view<R{}, Expr>;
+
+/**
+ * @brief Views contiguous quantities as an `Eigen::Map` of their numerical values without copying
+ *
+ * The span is mapped as a column vector, of a fixed size for a span of a static extent. The map
+ * writes through to the quantities unless they are `const`.
+ */
+MP_UNITS_EXPORT template<typename Q, std::size_t Extent>
+  requires Quantity<std::remove_const_t<Q>> && detail::layout_compatible_with_rep<std::remove_const_t<Q>>
+[[nodiscard]] auto as_eigen_map(std::span<Q, Extent> s)
+{
+  using q_type = std::remove_const_t<Q>;
+  using vector_type = Eigen::Matrix<typename q_type::rep, detail::eigen_extent(Extent), 1>;
+  using map_type = Eigen::Map<std::conditional_t<std::is_const_v<Q>, const vector_type, vector_type>>;
+  using rep_type = std::conditional_t<std::is_const_v<Q>, const typename q_type::rep, typename q_type::rep>;
+  // a standard-layout quantity is pointer-interconvertible with its only member, the numerical value
+  auto* const data = reinterpret_cast<rep_type*>(s.data());
+  if constexpr (Extent == std::dynamic_extent)
+    return eigen_quantity_view<q_type::reference, map_type>(map_type(data, static_cast<Eigen::Index>(s.size())));
+  else
+    return eigen_quantity_view<q_type::reference, map_type>(map_type(data));
+}
+
+/**
+ * @brief Views the coefficients of a contiguous Eigen vector as quantities of `R` without copying
+ *
+ * This is the inverse of `as_eigen_map()`: it reattaches a reference to an evaluated Eigen result,
+ * e.g. `as_quantity_span<si::metre>(v)`. The span has a static extent for a fixed-size vector.
+ */
+MP_UNITS_EXPORT template<Reference auto R, typename V>
+  requires detail::eigen_contiguous_vector<std::remove_const_t<V>> &&
+           detail::layout_compatible_with_rep<quantity<R, typename std::remove_const_t<V>::Scalar>>
+[[nodiscard]] auto as_quantity_span(V& v)
+{
+  using scalar = std::remove_reference_t<decltype(*v.data())>;
+  using q_type = quantity<R, std::remove_const_t<scalar>>;
+  using element_type = std::conditional_t<std::is_const_v<scalar>, const q_type, q_type>;
+  constexpr int size = std::remove_const_t<V>::SizeAtCompileTime;
+  constexpr std::size_t extent = size == Eigen::Dynamic ? std::dynamic_extent : static_cast<std::size_t>(size);
+  return std::span<element_type, extent>(reinterpret_cast<element_type*>(v.data()),
+                                         static_cast<std::size_t>(v.size()));
+}
+
+/**
+ * @brief Views the Eigen vector of an `eigen_quantity_view` as quantities without copying
+ *
+ * The wrapped object has to be stored contiguously, e.g. the `Eigen::Map` of `as_eigen_map()` or an
+ * evaluated result.
+ */
+MP_UNITS_EXPORT template<auto R, typename Expr>
+  requires detail::eigen_contiguous_vector<Expr>
+[[nodiscard]] auto as_quantity_span(eigen_quantity_view<R, Expr>& view)
+{
+  return as_quantity_span<R>(view.eigen());
+}
+
 }  // namespace mp_units
 
 // Tuple protocol for fixed-size Eigen vectors: makes them structured-bindings friendly
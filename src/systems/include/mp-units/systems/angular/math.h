@@ -24,7 +24,9 @@
 
 #include <mp-units/bits/requires_hosted.h>
 //
+#include <mp-units/bits/math_kernels.h>
 #include <mp-units/bits/module_macros.h>
+#include <mp-units/compat_macros.h>
 #include <mp-units/systems/angular/units.h>
 
 #ifndef MP_UNITS_IN_MODULE_INTERFACE
@@ -37,6 +39,10 @@
 import std;
 #else
 #include <cmath>
+#include <cstddef>
+#include <span>
+#include <type_traits>
+#include <utility>
 #endif
 #endif
 
@@ -148,4 +154,152 @@ template<auto R1, typename Rep1, auto R2, typename Rep2>
     return quantity{atan2(y.numerical_value_in(unit), x.numerical_value_in(unit)), radian};
 }
 
+/**
+ * @brief Computes the sine of an angle with a selected accuracy
+ *
+ * `libm_accuracy` is the same as `sin(q)`. The other tiers (see `MathAccuracy`) reduce the angle
+ * in its own unit when it is a rational part of a revolution (e.g. `deg`), so the conversion to
+ * radians applies only to the reduced value.
+ */
+template<ReferenceOf<angle> auto R, typename Rep, MathAccuracy Accuracy>
+  requires requires(Rep v) { sin(v); } || requires(Rep v) { std::sin(v); }
+[[nodiscard]] inline QuantityOf<dimensionless> auto sin(const quantity<R, Rep>& q, Accuracy) noexcept
+{
+  using rep = detail::kernel_rep_t<Accuracy, Rep>;
+  if constexpr (std::is_void_v<rep>)
+    return sin(q);
+  else {
+    constexpr UnitMagnitude auto to_radian = get_canonical_unit(q.unit).mag / get_canonical_unit(radian).mag;
+    return quantity{detail::sin_cos<to_radian, Accuracy>(static_cast<rep>(q.numerical_value_in(q.unit))).sin, one};
+  }
+}
+
+/**
+ * @brief Computes the cosine of an angle with a selected accuracy
+ *
+ * `libm_accuracy` is the same as `cos(q)`. See `sin(q, accuracy)` for the other tiers.
+ */
+template<ReferenceOf<angle> auto R, typename Rep, MathAccuracy Accuracy>
+  requires requires(Rep v) { cos(v); } || requires(Rep v) { std::cos(v); }
+[[nodiscard]] inline QuantityOf<dimensionless> auto cos(const quantity<R, Rep>& q, Accuracy) noexcept
+{
+  using rep = detail::kernel_rep_t<Accuracy, Rep>;
+  if constexpr (std::is_void_v<rep>)
+    return cos(q);
+  else {
+    constexpr UnitMagnitude auto to_radian = get_canonical_unit(q.unit).mag / get_canonical_unit(radian).mag;
+    return quantity{detail::sin_cos<to_radian, Accuracy>(static_cast<rep>(q.numerical_value_in(q.unit))).cos, one};
+  }
+}
+
+/**
+ * @brief Computes both the sine and the cosine of an angle
+ *
+ * The library kernels (see `MathAccuracy`) share one range reduction between both results.
+ *
+ * @return std::pair of the sine and the cosine
+ */
+template<ReferenceOf<angle> auto R, typename Rep, MathAccuracy Accuracy = libm_accuracy_t>
+  requires requires(const quantity<R, Rep>& q) {
+    sin(q);
+    cos(q);
+  }
+[[nodiscard]] inline auto sincos(const quantity<R, Rep>& q, Accuracy = Accuracy{}) noexcept
+{
+  using rep = detail::kernel_rep_t<Accuracy, Rep>;
+  if constexpr (std::is_void_v<rep>)
+    return std::pair{sin(q), cos(q)};
+  else {
+    constexpr UnitMagnitude auto to_radian = get_canonical_unit(q.unit).mag / get_canonical_unit(radian).mag;
+    const auto [s, c] = detail::sin_cos<to_radian, Accuracy>(static_cast<rep>(q.numerical_value_in(q.unit)));
+    return std::pair{quantity{s, one}, quantity{c, one}};
+  }
+}
+
+/**
+ * @brief Computes the angle of the point (x, y) with a selected accuracy
+ *
+ * `libm_accuracy` is the same as `atan2(y, x)`. See `MathAccuracy` for the other tiers.
+ */
+template<auto R1, typename Rep1, auto R2, typename Rep2, MathAccuracy Accuracy>
+  requires requires(const quantity<R1, Rep1>& y, const quantity<R2, Rep2>& x) { atan2(y, x); }
+[[nodiscard]] inline QuantityOf<angle> auto atan2(const quantity<R1, Rep1>& y, const quantity<R2, Rep2>& x,
+                                               Accuracy) noexcept
+{
+  using rep = detail::kernel_rep_t<Accuracy, Rep1, Rep2>;
+  if constexpr (std::is_void_v<rep>)
+    return atan2(y, x);
+  else {
+    constexpr auto unit = get_unit(get_common_reference(R1, R2));
+    return quantity{
+      detail::atan2<Accuracy>(value_cast<rep>(y).numerical_value_in(unit), value_cast<rep>(x).numerical_value_in(unit)),
+      radian};
+  }
+}
+
+/**
+ * @brief Computes `sin(in[i], accuracy)` for all elements of the spans
+ *
+ * The unit conversion is resolved at compile time, and the loop over the numerical values is
+ * free of branches for `fast_accuracy`, which lets the compiler vectorize it.
+ *
+ * @pre `in.size() <= out.size()`
+ */
+template<typename From, std::size_t N, typename To, std::size_t M, MathAccuracy Accuracy = libm_accuracy_t>
+  requires requires(From& in, To& out) { out = sin(in, Accuracy{}); }
+inline void sin(std::span<From, N> in, std::span<To, M> out, Accuracy acc = Accuracy{})
+{
+  MP_UNITS_PRECONDITION(in.size() <= out.size());
+  for (std::size_t i = 0; i < in.size(); ++i) out[i] = sin(in[i], acc);
+}
+
+/**
+ * @brief Computes `cos(in[i], accuracy)` for all elements of the spans
+ *
+ * @pre `in.size() <= out.size()`
+ */
+template<typename From, std::size_t N, typename To, std::size_t M, MathAccuracy Accuracy = libm_accuracy_t>
+  requires requires(From& in, To& out) { out = cos(in, Accuracy{}); }
+inline void cos(std::span<From, N> in, std::span<To, M> out, Accuracy acc = Accuracy{})
+{
+  MP_UNITS_PRECONDITION(in.size() <= out.size());
+  for (std::size_t i = 0; i < in.size(); ++i) out[i] = cos(in[i], acc);
+}
+
+/**
+ * @brief Computes `sincos(in[i], accuracy)` for all elements of the spans
+ *
+ * @pre `in.size() <= sin_out.size() && in.size() <= cos_out.size()`
+ */
+template<typename From, std::size_t N, typename ToSin, std::size_t M1, typename ToCos, std::size_t M2,
+         MathAccuracy Accuracy = libm_accuracy_t>
+  requires requires(From& in, ToSin& s, ToCos& c) {
+    s = sincos(in, Accuracy{}).first;
+    c = sincos(in, Accuracy{}).second;
+  }
+inline void sincos(std::span<From, N> in, std::span<ToSin, M1> sin_out, std::span<ToCos, M2> cos_out,
+                   Accuracy acc = Accuracy{})
+{
+  MP_UNITS_PRECONDITION(in.size() <= sin_out.size() && in.size() <= cos_out.size());
+  for (std::size_t i = 0; i < in.size(); ++i) {
+    const auto [s, c] = sincos(in[i], acc);
+    sin_out[i] = s;
+    cos_out[i] = c;
+  }
+}
+
+/**
+ * @brief Computes `atan2(y[i], x[i], accuracy)` for all elements of the spans
+ *
+ * @pre `y.size() == x.size() && y.size() <= out.size()`
+ */
+template<typename Q1, std::size_t N1, typename Q2, std::size_t N2, typename To, std::size_t M,
+         MathAccuracy Accuracy = libm_accuracy_t>
+  requires requires(Q1& y, Q2& x, To& out) { out = atan2(y, x, Accuracy{}); }
+inline void atan2(std::span<Q1, N1> y, std::span<Q2, N2> x, std::span<To, M> out, Accuracy acc = Accuracy{})
+{
+  MP_UNITS_PRECONDITION(y.size() == x.size() && y.size() <= out.size());
+  for (std::size_t i = 0; i < y.size(); ++i) out[i] = atan2(y[i], x[i], acc);
+}
+
 }  // namespace mp_units::angular
@@ -37,8 +37,11 @@
 #ifdef MP_UNITS_IMPORT_STD
 import std;
 #else
+#include <bit>
 #include <cmath>
+#include <concepts>
 #include <cstddef>
+#include <limits>
 #include <tuple>
 #include <type_traits>
 #include <utility>
@@ -86,21 +89,53 @@ template<typename F, std::size_t... Is>
   return cartesian_vector{f(Is)...};
 }
 
+// `float` and `double` vectors are stored in a power-of-two number of lanes aligned to their size
+// (a 3D vector gets a fourth padding coordinate that is always `+0`). The element-wise operations,
+// the products, and the norm of such vectors work on all the lanes at once, which compilers map onto
+// whole SIMD registers; vectors of other element types keep the per-coordinate code.
+template<typename T>
+concept SimdScalar = std::same_as<T, float> || std::same_as<T, double>;
+
+template<typename T, std::size_t N>
+inline constexpr std::size_t cartesian_vector_lanes = SimdScalar<T> ? std::bit_ceil(N) : N;
+
+template<typename T, std::size_t N>
+inline constexpr std::size_t cartesian_vector_alignment =
+  SimdScalar<T> ? cartesian_vector_lanes<T, N> * sizeof(T) : alignof(T);
+
+// Build a `float`/`double` vector by evaluating `f(i)` for every lane, including the padding ones,
+// for which `f` has to yield `+0` (as e.g. the sum of two vectors does).
+template<typename T, std::size_t N, typename F>
+[[nodiscard]] constexpr cartesian_vector<T, N> cartesian_vector_from_lanes(F&& f)
+{
+  cartesian_vector<T, N> res;
+  for (std::size_t i = 0; i < cartesian_vector_lanes<T, N>; ++i) res._coordinates_[i] = f(i);
+  return res;
+}
+
 struct cartesian_vector_iface {
   template<typename T, std::size_t N, typename U>
     requires requires(const T& t, const U& u) { t + u; }
   [[nodiscard]] friend constexpr auto operator+(const cartesian_vector<T, N>& lhs, const cartesian_vector<U, N>& rhs)
   {
-    return ::mp_units::utility::detail::cartesian_vector_from(std::make_index_sequence<N>{},
-                                                              [&](std::size_t i) { return lhs[i] + rhs[i]; });
+    if constexpr (SimdScalar<T> && std::same_as<T, U>)
+      return cartesian_vector_from_lanes<T, N>(
+        [&](std::size_t i) { return lhs._coordinates_[i] + rhs._coordinates_[i]; });
+    else
+      return ::mp_units::utility::detail::cartesian_vector_from(std::make_index_sequence<N>{},
+                                                                [&](std::size_t i) { return lhs[i] + rhs[i]; });
   }
 
   template<typename T, std::size_t N, typename U>
     requires requires(const T& t, const U& u) { t - u; }
   [[nodiscard]] friend constexpr auto operator-(const cartesian_vector<T, N>& lhs, const cartesian_vector<U, N>& rhs)
   {
-    return ::mp_units::utility::detail::cartesian_vector_from(std::make_index_sequence<N>{},
-                                                              [&](std::size_t i) { return lhs[i] - rhs[i]; });
+    if constexpr (SimdScalar<T> && std::same_as<T, U>)
+      return cartesian_vector_from_lanes<T, N>(
+        [&](std::size_t i) { return lhs._coordinates_[i] - rhs._coordinates_[i]; });
+    else
+      return ::mp_units::utility::detail::cartesian_vector_from(std::make_index_sequence<N>{},
+                                                                [&](std::size_t i) { return lhs[i] - rhs[i]; });
   }
 
   // A `Reference` (unit) or `Quantity` right-hand operand is deliberately excluded from these
@@ -114,8 +149,13 @@ struct cartesian_vector_iface {
     requires(!Reference<U>) && (!Quantity<U>) && requires(const T& t, const U& u) { t * u; }
   [[nodiscard]] friend constexpr auto operator*(const cartesian_vector<T, N>& lhs, const U& rhs)
   {
-    return ::mp_units::utility::detail::cartesian_vector_from(std::make_index_sequence<N>{},
-                                                              [&](std::size_t i) { return lhs[i] * rhs; });
+    // the padding is masked as `0 * inf` would make it a NaN
+    if constexpr (SimdScalar<T> && std::same_as<decltype(lhs[0] * rhs), T>)
+      return cartesian_vector_from_lanes<T, N>(
+        [&](std::size_t i) { return i < N ? lhs._coordinates_[i] * rhs : T{}; });
+    else
+      return ::mp_units::utility::detail::cartesian_vector_from(std::make_index_sequence<N>{},
+                                                                [&](std::size_t i) { return lhs[i] * rhs; });
   }
 
   template<typename T, std::size_t N, typename U>
@@ -129,8 +169,12 @@ struct cartesian_vector_iface {
     requires(!Reference<U>) && (!Quantity<U>) && requires(const T& t, const U& u) { t / u; }
   [[nodiscard]] friend constexpr auto operator/(const cartesian_vector<T, N>& lhs, const U& rhs)
   {
-    return ::mp_units::utility::detail::cartesian_vector_from(std::make_index_sequence<N>{},
-                                                              [&](std::size_t i) { return lhs[i] / rhs; });
+    if constexpr (SimdScalar<T> && std::same_as<decltype(lhs[0] / rhs), T>)
+      return cartesian_vector_from_lanes<T, N>(
+        [&](std::size_t i) { return i < N ? lhs._coordinates_[i] / rhs : T{}; });
+    else
+      return ::mp_units::utility::detail::cartesian_vector_from(std::make_index_sequence<N>{},
+                                                                [&](std::size_t i) { return lhs[i] / rhs; });
   }
 
   template<typename T, std::size_t N, std::equality_comparable_with<T> U>
@@ -152,9 +196,19 @@ struct cartesian_vector_iface {
     // Hermitian (sesquilinear) for complex elements, conjugating the first argument (physics
     // convention). `conjugate` is the identity for real elements, so this is the ordinary dot
     // product there and reduces to a real result.
-    return [&]<std::size_t... Is>(std::index_sequence<Is...>) {
-      return (... + (::mp_units::utility::detail::conjugate(lhs[Is]) * rhs[Is]));
-    }(std::make_index_sequence<N>{});
+    if constexpr (SimdScalar<T> && std::same_as<T, U>) {
+      // lane-wise products summed pairwise, as a horizontal add of a SIMD register does
+      constexpr std::size_t lanes = cartesian_vector_lanes<T, N>;
+      T products[lanes];
+      for (std::size_t i = 0; i < lanes; ++i) products[i] = lhs._coordinates_[i] * rhs._coordinates_[i];
+      if constexpr (lanes == 2)
+        return products[0] + products[1];
+      else
+        return (products[0] + products[2]) + (products[1] + products[3]);
+    } else
+      return [&]<std::size_t... Is>(std::index_sequence<Is...>) {
+        return (... + (::mp_units::utility::detail::conjugate(lhs[Is]) * rhs[Is]));
+      }(std::make_index_sequence<N>{});
   }
 
   // The cross product yields an (axial) vector only in three dimensions (ISO 80000-2:2019, 2-18.11).
@@ -166,8 +220,19 @@ struct cartesian_vector_iface {
   [[nodiscard]] friend constexpr auto vector_product(const cartesian_vector<T, N>& lhs,
                                                      const cartesian_vector<U, N>& rhs)
   {
-    return ::mp_units::utility::cartesian_vector{lhs[1] * rhs[2] - lhs[2] * rhs[1], lhs[2] * rhs[0] - lhs[0] * rhs[2],
-                                                 lhs[0] * rhs[1] - lhs[1] * rhs[0]};
+    if constexpr (SimdScalar<T> && std::same_as<T, U>) {
+      // `a.yzx * b.zxy - a.zxy * b.yzx` over lane permutations; the padding stays `0 * 0 - 0 * 0`
+      const T(&a)[4] = lhs._coordinates_;
+      const T(&b)[4] = rhs._coordinates_;
+      const T a_yzx[] = {a[1], a[2], a[0], a[3]};
+      const T a_zxy[] = {a[2], a[0], a[1], a[3]};
+      const T b_yzx[] = {b[1], b[2], b[0], b[3]};
+      const T b_zxy[] = {b[2], b[0], b[1], b[3]};
+      return cartesian_vector_from_lanes<T, N>(
+        [&](std::size_t i) { return a_yzx[i] * b_zxy[i] - a_zxy[i] * b_yzx[i]; });
+    } else
+      return ::mp_units::utility::cartesian_vector{lhs[1] * rhs[2] - lhs[2] * rhs[1], lhs[2] * rhs[0] - lhs[0] * rhs[2],
+                                                   lhs[0] * rhs[1] - lhs[1] * rhs[0]};
   }
 
   // In two dimensions the cross product degenerates to the perp-dot product: the (pseudo)scalar
@@ -207,7 +272,7 @@ MP_UNITS_EXPORT template<Scalar T = double, std::size_t N = 3>
 class cartesian_vector : public detail::cartesian_vector_iface {
 public:
   // public members required to satisfy structural type requirements :-(
-  T _coordinates_[N];
+  alignas(detail::cartesian_vector_alignment<T, N>) T _coordinates_[detail::cartesian_vector_lanes<T, N>];
   using value_type = T;
 
   // The dimension N - the per-axis count (`std::extent`-style: count in one direction), which for a
@@ -282,6 +347,15 @@ public:
         return sqrt((... + (::mp_units::modulus(_coordinates_[Is]) * ::mp_units::modulus(_coordinates_[Is]))));
       }(std::make_index_sequence<N>{});
     } else {
+      if constexpr (detail::SimdScalar<T>) {
+        // The square root of the dot product is as accurate as `hypot` unless the sum of squares
+        // overflowed or a square of a coordinate lost its precision to underflow; only those
+        // (and NaN) take the `hypot` path below.
+        const T sum = scalar_product(*this, *this);
+        if (sum >= std::numeric_limits<T>::min() / std::numeric_limits<T>::epsilon() &&
+            sum <= std::numeric_limits<T>::max())
+          return std::sqrt(sum);
+      }
       using std::hypot;
       if constexpr (N == 2)
         return hypot(_coordinates_[0], _coordinates_[1]);
@@ -350,8 +424,13 @@ public:
   [[nodiscard]] constexpr cartesian_vector operator+() const { return *this; }
   [[nodiscard]] constexpr cartesian_vector operator-() const
   {
-    return detail::cartesian_vector_from(std::make_index_sequence<N>{},
-                                         [&](std::size_t i) { return -_coordinates_[i]; });
+    // the padding is masked as `-0` would make equal vectors differ as template arguments
+    if constexpr (detail::SimdScalar<T>)
+      return detail::cartesian_vector_from_lanes<T, N>(
+        [&](std::size_t i) { return i < N ? -_coordinates_[i] : T{}; });
+    else
+      return detail::cartesian_vector_from(std::make_index_sequence<N>{},
+                                           [&](std::size_t i) { return -_coordinates_[i]; });
   }
 
   template<typename U>
@@ -360,7 +439,10 @@ public:
     }
   constexpr cartesian_vector& operator+=(const cartesian_vector<U, N>& other)
   {
-    for (std::size_t i = 0; i < N; ++i) _coordinates_[i] += other[i];
+    if constexpr (detail::SimdScalar<T> && std::same_as<T, U>)
+      for (std::size_t i = 0; i < detail::cartesian_vector_lanes<T, N>; ++i) _coordinates_[i] += other._coordinates_[i];
+    else
+      for (std::size_t i = 0; i < N; ++i) _coordinates_[i] += other[i];
     return *this;
   }
 
@@ -370,7 +452,10 @@ public:
     }
   constexpr cartesian_vector& operator-=(const cartesian_vector<U, N>& other)
   {
-    for (std::size_t i = 0; i < N; ++i) _coordinates_[i] -= other[i];
+    if constexpr (detail::SimdScalar<T> && std::same_as<T, U>)
+      for (std::size_t i = 0; i < detail::cartesian_vector_lanes<T, N>; ++i) _coordinates_[i] -= other._coordinates_[i];
+    else
+      for (std::size_t i = 0; i < N; ++i) _coordinates_[i] -= other[i];
     return *this;
   }
 
@@ -0,0 +1,736 @@
+// The MIT License (MIT)
+//
+// Copyright (c) 2018 Mateusz Pusz
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+
+#pragma once
+
+#include <mp-units/bits/requires_hosted.h>
+//
+#include <mp-units/bits/module_macros.h>
+#include <mp-units/ext/contracts.h>
+
+#ifndef MP_UNITS_IN_MODULE_INTERFACE
+#include <mp-units/utility/representation.h>
+#include <mp-units/utility/uncertain.h>
+#ifdef MP_UNITS_IMPORT_STD
+import std;
+#else
+#include <algorithm>
+#include <array>
+#include <atomic>
+#include <cmath>
+#include <compare>
+#include <concepts>
+#include <cstddef>
+#include <cstdint>
+#include <iosfwd>
+#include <span>
+#include <type_traits>
+#include <utility>
+#include <vector>
+#endif
+#endif
+
+namespace mp_units::utility {
+
+/**
+ * @brief Identifies an independent source of uncertainty
+ *
+ * Every `correlated_uncertain` value records how it depends on the sources it was derived from,
+ * and two values that share a source are correlated through it. A source is either named by the
+ * user, which lets independently constructed values refer to the same error (e.g., every reading
+ * taken with one calibrated instrument), or drawn from `unique()`, which is what the two-argument
+ * `correlated_uncertain` constructor does.
+ *
+ * Named sources use the ids up to `max_named_id`, and `unique()` hands out the ones above it, so
+ * the two never collide. A default-constructed source is the named source `0`.
+ */
+MP_UNITS_EXPORT class uncertainty_source {
+public:
+  /// @brief The largest id a named source may use; the ones above are reserved for `unique()`
+  static constexpr std::uint64_t max_named_id = (std::uint64_t{1} << 63) - 1;
+
+  [[nodiscard]] constexpr uncertainty_source() = default;
+
+  /// @brief Names a source (`id` must not exceed `max_named_id`)
+  [[nodiscard]] constexpr explicit uncertainty_source(std::uint64_t id) : id_(id)
+  {
+    MP_UNITS_PRECONDITION(id_ <= max_named_id);
+  }
+
+  /**
+   * @brief Returns a source distinct from every named one and from every other `unique()` result
+   *
+   * Thread-safe. The ids come from a relaxed atomic counter, so they are unique but carry no
+   * ordering guarantee between threads.
+   */
+  [[nodiscard]] static uncertainty_source unique()
+  {
+    static std::atomic<std::uint64_t> next{0};
+    uncertainty_source res;
+    res.id_ = (max_named_id + 1) | next.fetch_add(1, std::memory_order_relaxed);
+    return res;
+  }
+
+  [[nodiscard]] constexpr std::uint64_t id() const { return id_; }
+
+  [[nodiscard]] friend constexpr bool operator==(uncertainty_source, uncertainty_source) = default;
+  [[nodiscard]] friend constexpr auto operator<=>(uncertainty_source, uncertainty_source) = default;
+
+private:
+  std::uint64_t id_ = 0;
+};
+
+namespace detail {
+
+// A vector that keeps up to `N` elements inline and only moves to the heap past that. The
+// `std::vector` member stays empty (and therefore unallocated) while the elements fit inline, so
+// copying or moving a small one never touches the allocator. Elements are only ever written
+// through `resize_for_overwrite`, which is all the merge-based arithmetic needs.
+template<typename T, std::size_t N>
+class small_buffer_vector {
+public:
+  [[nodiscard]] constexpr small_buffer_vector() = default;
+
+  [[nodiscard]] constexpr std::size_t size() const { return size_; }
+  [[nodiscard]] constexpr bool empty() const { return size_ == 0; }
+  [[nodiscard]] constexpr bool is_inline() const { return size_ <= N; }
+
+  [[nodiscard]] constexpr const T* data() const { return is_inline() ? inline_.data() : heap_.data(); }
+  [[nodiscard]] constexpr const T* begin() const { return data(); }
+  [[nodiscard]] constexpr const T* end() const { return data() + size_; }
+  [[nodiscard]] constexpr const T& operator[](std::size_t i) const { return data()[i]; }
+
+  // Resizes to `n` elements and returns the storage for the caller to fill in.
+  constexpr T* resize_for_overwrite(std::size_t n)
+  {
+    size_ = n;
+    if (n <= N) {
+      heap_ = {};
+      return inline_.data();
+    }
+    heap_.resize(n);
+    return heap_.data();
+  }
+
+  constexpr void assign(const T* first, std::size_t n) { std::copy_n(first, n, resize_for_overwrite(n)); }
+
+  [[nodiscard]] friend constexpr bool operator==(const small_buffer_vector& lhs, const small_buffer_vector& rhs)
+  {
+    return std::equal(lhs.begin(), lhs.end(), rhs.begin(), rhs.end());
+  }
+
+  [[nodiscard]] friend constexpr auto operator<=>(const small_buffer_vector& lhs, const small_buffer_vector& rhs)
+  {
+    return std::lexicographical_compare_three_way(lhs.begin(), lhs.end(), rhs.begin(), rhs.end());
+  }
+
+private:
+  std::array<T, N> inline_{};
+  std::vector<T> heap_;
+  std::size_t size_ = 0;
+};
+
+}  // namespace detail
+
+/**
+ * @brief A representation type for values with uncertainties that tracks their correlations
+ *
+ * Where `uncertain<T>` stores a single standard uncertainty and therefore has to assume its
+ * operands are independent, this class stores the linearized error of the value as a sparse
+ * vector of signed components, one per independent `uncertainty_source` it depends on. Every
+ * operation propagates the components through its partial derivatives (forward-mode
+ * differentiation with respect to the sources) and merges the vectors of its operands by source,
+ * so contributions from a shared source add up linearly and may cancel:
+ *
+ * - `z = f(x, y)` has the components `c_i(z) = ∂f/∂x · c_i(x) + ∂f/∂y · c_i(y)`,
+ * - the standard uncertainty is `σ_z = √(Σ c_i(z)²)`,
+ * - the covariance of two values is `Σ c_i(x) · c_i(y)` over the sources they share.
+ *
+ * For independent operands this gives exactly the results of `uncertain<T>`. For correlated ones
+ * it gives the correct ones: `x - x` is `0 ± 0`, `x * x` is `x² ± 2|x|σ`, and the covariance
+ * matrices one would otherwise carry by hand are implied by the shared sources.
+ *
+ * **Cost:** a value stores up to `inline_capacity` components inline, so arithmetic on values
+ * derived from up to that many sources never allocates. The merge is linear in the number of
+ * components, which keeps a typical operation within a small factor of `uncertain<T>`. Exact zero
+ * components (e.g., the ones that cancel in `x - x`) are dropped so they do not accumulate.
+ *
+ * **Limitations:** the propagation is first-order, with the same accuracy caveats as
+ * `uncertain<T>`. The relative uncertainty of a conversion factor built from measured constants
+ * is folded in as a fresh source on each conversion (the customization point receives only its
+ * magnitude), so two conversions through the same constant are taken as independent.
+ *
+ * **Example:**
+ * @code
+ * quantity length = correlated_uncertain{10.0, 0.1} * m;  // 10.0 ± 0.1 m
+ * quantity perimeter = 2 * length + 2 * length;           // 40.0 ± 0.4 m, not ± 0.28 m
+ * quantity zero = length - length;                        // 0 ± 0 m
+ * @endcode
+ */
+// The constraints are those of `uncertain<T>`, plus `representation_values<T>::one()`, which the
+// derivatives of the linear operations are built from.
+MP_UNITS_EXPORT template<typename T>
+  requires RealScalar<T> && (!disable_representation<T>) && requires {
+    representation_values<T>::zero();
+    representation_values<T>::one();
+  }
+class correlated_uncertain {
+public:
+  using value_type = T;
+
+  /// @brief The signed uncertainty contribution `∂f/∂x_i · u(x_i)` of one source
+  struct component {
+    uncertainty_source source;
+    value_type value{};
+
+    [[nodiscard]] friend constexpr bool operator==(const component&, const component&) = default;
+    [[nodiscard]] friend constexpr auto operator<=>(const component&, const component&) = default;
+  };
+
+  /// @brief The number of components stored without a heap allocation
+  static constexpr std::size_t inline_capacity = 8;
+
+  [[nodiscard]] correlated_uncertain() = default;
+
+  /**
+   * @brief Converts an exact value to an uncertain one (value ± 0)
+   *
+   * Intentionally implicit for the same reason as in `uncertain<T>`: an exact value joins
+   * propagation losslessly, depending on no source at all.
+   */
+  // NOLINTNEXTLINE(google-explicit-constructor, hicpp-explicit-conversions)
+  [[nodiscard]] constexpr explicit(false) correlated_uncertain(value_type val) : value_(std::move(val)) {}
+
+  /**
+   * @brief Constructs an uncertain value depending on a new, independent source
+   *
+   * @param val The central value
+   * @param err The absolute standard uncertainty (must be non-negative)
+   */
+  // NOLINTNEXTLINE(bugprone-easily-swappable-parameters)
+  [[nodiscard]] explicit correlated_uncertain(value_type val, value_type err) :
+      correlated_uncertain(std::move(val), std::move(err), uncertainty_source::unique())
+  {
+  }
+
+  /**
+   * @brief Constructs an uncertain value depending on the given source
+   *
+   * Values constructed with the same source are fully correlated, which is how the readings of
+   * one instrument or the uses of one calibration constant are tied together.
+   *
+   * @param val The central value
+   * @param err The absolute standard uncertainty (must be non-negative)
+   * @param source The source of the uncertainty
+   */
+  // NOLINTNEXTLINE(bugprone-easily-swappable-parameters)
+  [[nodiscard]] constexpr explicit correlated_uncertain(value_type val, value_type err, uncertainty_source source) :
+      value_(std::move(val))
+  {
+    MP_UNITS_PRECONDITION(err >= representation_values<value_type>::zero());
+    if (err != representation_values<value_type>::zero()) *components_.resize_for_overwrite(1) = {source, err};
+  }
+
+  /// @brief Returns the central value
+  [[nodiscard]] constexpr const value_type& value() const { return value_; }
+
+  /// @brief Returns the variance (σ²), the sum of the squared components
+  [[nodiscard]] constexpr value_type variance() const
+  {
+    value_type res = representation_values<value_type>::zero();
+    for (const component& c : components_) res += c.value * c.value;
+    return res;
+  }
+
+  /// @brief Returns the absolute uncertainty (standard deviation)
+  [[nodiscard]] constexpr value_type uncertainty() const
+  {
+    // A single source needs no square root, which keeps the common uncorrelated case exact.
+    using std::abs;
+    using std::sqrt;
+    return components_.size() == 1 ? abs(components_[0].value) : sqrt(variance());
+  }
+
+  /// @brief Returns the relative standard uncertainty (σ/|x|)
+  [[nodiscard]] constexpr value_type relative_uncertainty() const
+  {
+    using std::abs;
+    return uncertainty() / abs(value());
+  }
+
+  /// @brief Returns the lower bound of the uncertainty interval (value - σ)
+  [[nodiscard]] constexpr value_type lower_bound() const { return value() - uncertainty(); }
+
+  /// @brief Returns the upper bound of the uncertainty interval (value + σ)
+  [[nodiscard]] constexpr value_type upper_bound() const { return value() + uncertainty(); }
+
+  /// @brief Returns the uncertainty components, ordered by source
+  [[nodiscard]] constexpr std::span<const component> components() const
+  {
+    return {components_.data(), components_.size()};
+  }
+
+  /// @brief Returns the signed uncertainty contribution of `source` (zero if it does not contribute)
+  [[nodiscard]] constexpr value_type component_of(uncertainty_source source) const
+  {
+    const auto it = std::ranges::lower_bound(components_, source, {}, &component::source);
+    return it != components_.end() && it->source == source ? it->value : representation_values<value_type>::zero();
+  }
+
+  /// @brief Collapses the value to an `uncertain<T>`, dropping the correlation information
+  [[nodiscard]] constexpr explicit operator uncertain<value_type>() const
+  {
+    return uncertain<value_type>(value(), uncertainty());
+  }
+
+  /// @brief Unary negation (flips the sign of every component)
+  [[nodiscard]] constexpr correlated_uncertain operator-() const
+  {
+    return unary(-value(), *this, -representation_values<value_type>::one());
+  }
+
+  /**
+   * @brief Addition of two uncertain values
+   * @note Formula: c_i = c_i(x) + c_i(y)
+   */
+  [[nodiscard]] friend constexpr correlated_uncertain operator+(const correlated_uncertain& lhs,
+                                                                const correlated_uncertain& rhs)
+  {
+    const value_type one = representation_values<value_type>::one();
+    return binary(lhs.value() + rhs.value(), lhs, one, rhs, one);
+  }
+
+  /**
+   * @brief Subtraction of two uncertain values
+   * @note Formula: c_i = c_i(x) - c_i(y), so `x - x` has no uncertainty
+   */
+  [[nodiscard]] friend constexpr correlated_uncertain operator-(const correlated_uncertain& lhs,
+                                                                const correlated_uncertain& rhs)
+  {
+    const value_type one = representation_values<value_type>::one();
+    return binary(lhs.value() - rhs.value(), lhs, one, rhs, -one);
+  }
+
+  /**
+   * @brief Multiplication of two uncertain values
+   * @note Formula: c_i = y·c_i(x) + x·c_i(y)
+   */
+  [[nodiscard]] friend constexpr correlated_uncertain operator*(const correlated_uncertain& lhs,
+                                                                const correlated_uncertain& rhs)
+  {
+    return binary(lhs.value() * rhs.value(), lhs, rhs.value(), rhs, lhs.value());
+  }
+
+  /**
+   * @brief Multiplication by an exact scalar
+   * @note The scalar is treated as exact (no uncertainty). Formula: c_i = k·c_i(x)
+   */
+  [[nodiscard]] friend constexpr correlated_uncertain operator*(const correlated_uncertain& lhs,
+                                                                const std::convertible_to<value_type> auto& value)
+  {
+    return unary(static_cast<value_type>(lhs.value() * value), lhs, static_cast<value_type>(value));
+  }
+
+  /// @brief Multiplication by an exact scalar (commutative)
+  [[nodiscard]] friend constexpr correlated_uncertain operator*(const std::convertible_to<value_type> auto& value,
+                                                                const correlated_uncertain& rhs)
+  {
+    return unary(static_cast<value_type>(value * rhs.value()), rhs, static_cast<value_type>(value));
+  }
+
+  /**
+   * @brief Division of two uncertain values
+   * @note Formula: c_i = c_i(x)/y - (x/y²)·c_i(y)
+   */
+  [[nodiscard]] friend constexpr correlated_uncertain operator/(const correlated_uncertain& lhs,
+                                                                const correlated_uncertain& rhs)
+  {
+    const value_type val = lhs.value() / rhs.value();
+    const value_type one = representation_values<value_type>::one();
+    return binary(val, lhs, one / rhs.value(), rhs, -val / rhs.value());
+  }
+
+  /**
+   * @brief Division by an exact scalar
+   * @note The scalar is treated as exact (no uncertainty). Formula: c_i = c_i(x)/k
+   */
+  [[nodiscard]] friend constexpr correlated_uncertain operator/(const correlated_uncertain& lhs,
+                                                                const std::convertible_to<value_type> auto& value)
+  {
+    const value_type one = representation_values<value_type>::one();
+    return unary(static_cast<value_type>(lhs.value()) / value, lhs, one / static_cast<value_type>(value));
+  }
+
+  /**
+   * @brief Division of an exact scalar by an uncertain value
+   * @note Formula: c_i = -(k/x²)·c_i(x)
+   */
+  [[nodiscard]] friend constexpr correlated_uncertain operator/(const std::convertible_to<value_type> auto& value,
+                                                                const correlated_uncertain& rhs)
+  {
+    const auto val = static_cast<value_type>(value / rhs.value());
+    return unary(val, rhs, -val / rhs.value());
+  }
+
+  /**
+   * @brief Adds the uncertainty of a unit conversion factor to the value
+   *
+   * Implements the `fold_conversion_uncertainty` customization point. The factor becomes a new
+   * source with the component `x·u_r`.
+   */
+  [[nodiscard]] friend correlated_uncertain fold_conversion_uncertainty(const correlated_uncertain& val,
+                                                                        long double relative_uncertainty)
+  {
+    using std::abs;
+    const auto err = static_cast<value_type>(abs(static_cast<long double>(val.value()) * relative_uncertainty));
+    return val + correlated_uncertain(representation_values<value_type>::zero(), err);
+  }
+
+  /**
+   * @brief Covariance of two uncertain values
+   * @note Formula: cov(x, y) = Σ c_i(x)·c_i(y) over the shared sources
+   */
+  [[nodiscard]] friend constexpr value_type covariance(const correlated_uncertain& lhs, const correlated_uncertain& rhs)
+  {
+    value_type res = representation_values<value_type>::zero();
+    const component* l = lhs.components_.begin();
+    const component* r = rhs.components_.begin();
+    while (l != lhs.components_.end() && r != rhs.components_.end()) {
+      if (l->source < r->source)
+        ++l;
+      else if (r->source < l->source)
+        ++r;
+      else
+        res += (l++)->value * (r++)->value;
+    }
+    return res;
+  }
+
+  /**
+   * @brief Correlation coefficient of two uncertain values
+   * @note Formula: ρ = cov(x, y) / (σ_x·σ_y); undefined (NaN) when either value is exact
+   */
+  [[nodiscard]] friend constexpr value_type correlation(const correlated_uncertain& lhs,
+                                                        const correlated_uncertain& rhs)
+  {
+    return covariance(lhs, rhs) / (lhs.uncertainty() * rhs.uncertainty());
+  }
+
+  /**
+   * @brief Comparison of two uncertain values
+   *
+   * As for `uncertain<T>`, the order is structural rather than statistical: primarily by the
+   * central value, with the components as a lexicographic tie-breaker, which keeps it total and
+   * consistent with equality.
+   */
+  [[nodiscard]] constexpr bool operator==(const correlated_uncertain&) const = default;
+  [[nodiscard]] constexpr auto operator<=>(const correlated_uncertain&) const = default;
+
+  friend std::ostream& operator<<(std::ostream& os, const correlated_uncertain& arg)
+  {
+    return os << arg.value() << " ± " << arg.uncertainty();
+  }
+
+  /**
+   * @brief Absolute value of an uncertain value
+   * @note Formula: c_i = sign(x)·c_i(x)
+   */
+  [[nodiscard]] friend constexpr correlated_uncertain abs(const correlated_uncertain& arg)
+    requires requires { abs(arg.value()); } || requires { std::abs(arg.value()); }
+  {
+    using std::abs;
+    const value_type one = representation_values<value_type>::one();
+    return unary(abs(arg.value()), arg, arg.value() < representation_values<value_type>::zero() ? -one : one);
+  }
+
+  /**
+   * @brief Power function with runtime exponent
+   * @note Formula: if f = x^n, then c_i = n·f/x·c_i(x)
+   */
+  [[nodiscard]] friend constexpr correlated_uncertain pow(const correlated_uncertain& base, const value_type& exponent)
+    requires requires { pow(base.value(), exponent); } || requires { std::pow(base.value(), exponent); }
+  {
+    using std::pow;
+    const auto val = pow(base.value(), exponent);
+    return unary(val, base, exponent * val / base.value());
+  }
+
+  /**
+   * @brief Square root of an uncertain value
+   * @note Formula: c_i = c_i(x) / (2√x)
+   */
+  [[nodiscard]] friend constexpr correlated_uncertain sqrt(const correlated_uncertain& arg)
+    requires requires { sqrt(arg.value()); } || requires { std::sqrt(arg.value()); }
+  {
+    using std::sqrt;
+    const auto val = sqrt(arg.value());
+    return unary(val, arg, representation_values<value_type>::one() / (value_type{2} * val));
+  }
+
+  /**
+   * @brief Exponential function of an uncertain value
+   * @note Formula: if f = exp(x), then c_i = f·c_i(x)
+   */
+  [[nodiscard]] friend constexpr correlated_uncertain exp(const correlated_uncertain& arg)
+    requires requires { exp(arg.value()); } || requires { std::exp(arg.value()); }
+  {
+    using std::exp;
+    const auto val = exp(arg.value());
+    return unary(val, arg, val);
+  }
+
+  /**
+   * @brief Natural logarithm of an uncertain value
+   * @note Formula: c_i = c_i(x) / x
+   */
+  [[nodiscard]] friend constexpr correlated_uncertain log(const correlated_uncertain& arg)
+    requires requires { log(arg.value()); } || requires { std::log(arg.value()); }
+  {
+    using std::log;
+    return unary(log(arg.value()), arg, representation_values<value_type>::one() / arg.value());
+  }
+
+  /**
+   * @brief Common (base-10) logarithm of an uncertain value
+   * @note Formula: c_i = c_i(x) / (x·ln(10))
+   */
+  [[nodiscard]] friend constexpr correlated_uncertain log10(const correlated_uncertain& arg)
+    requires requires { log10(arg.value()); } || requires { std::log10(arg.value()); }
+  {
+    using std::log;
+    using std::log10;
+    return unary(log10(arg.value()), arg,
+                 representation_values<value_type>::one() / (arg.value() * log(value_type{10})));
+  }
+
+  /**
+   * @brief Binary (base-2) logarithm of an uncertain value
+   * @note Formula: c_i = c_i(x) / (x·ln(2))
+   */
+  [[nodiscard]] friend constexpr correlated_uncertain log2(const correlated_uncertain& arg)
+    requires requires { log2(arg.value()); } || requires { std::log2(arg.value()); }
+  {
+    using std::log;
+    using std::log2;
+    return unary(log2(arg.value()), arg, representation_values<value_type>::one() / (arg.value() * log(value_type{2})));
+  }
+
+  /**
+   * @brief Cube root of an uncertain value
+   * @note Formula: if f = ∛x, then c_i = c_i(x) / (3·f²)
+   */
+  [[nodiscard]] friend constexpr correlated_uncertain cbrt(const correlated_uncertain& arg)
+    requires requires { cbrt(arg.value()); } || requires { std::cbrt(arg.value()); }
+  {
+    using std::cbrt;
+    const auto val = cbrt(arg.value());
+    return unary(val, arg, representation_values<value_type>::one() / (value_type{3} * val * val));
+  }
+
+  /**
+   * @brief Sine of an uncertain value (argument in radians)
+   * @note Formula: c_i = cos(x)·c_i(x)
+   */
+  [[nodiscard]] friend constexpr correlated_uncertain sin(const correlated_uncertain& arg)
+    requires requires { sin(arg.value()); } || requires { std::sin(arg.value()); }
+  {
+    using std::cos;
+    using std::sin;
+    return unary(sin(arg.value()), arg, cos(arg.value()));
+  }
+
+  /**
+   * @brief Cosine of an uncertain value (argument in radians)
+   * @note Formula: c_i = -sin(x)·c_i(x)
+   */
+  [[nodiscard]] friend constexpr correlated_uncertain cos(const correlated_uncertain& arg)
+    requires requires { cos(arg.value()); } || requires { std::cos(arg.value()); }
+  {
+    using std::cos;
+    using std::sin;
+    return unary(cos(arg.value()), arg, -sin(arg.value()));
+  }
+
+  /**
+   * @brief Tangent of an uncertain value (argument in radians)
+   * @note Formula: c_i = c_i(x) / cos²(x)
+   */
+  [[nodiscard]] friend constexpr correlated_uncertain tan(const correlated_uncertain& arg)
+    requires requires { tan(arg.value()); } || requires { std::tan(arg.value()); }
+  {
+    using std::cos;
+    using std::tan;
+    const auto cos_val = cos(arg.value());
+    return unary(tan(arg.value()), arg, representation_values<value_type>::one() / (cos_val * cos_val));
+  }
+
+  /**
+   * @brief Arc sine of an uncertain value (result in radians)
+   * @note Formula: c_i = c_i(x) / √(1 - x²)
+   */
+  [[nodiscard]] friend constexpr correlated_uncertain asin(const correlated_uncertain& arg)
+    requires requires { asin(arg.value()); } || requires { std::asin(arg.value()); }
+  {
+    using std::asin;
+    using std::sqrt;
+    const value_type one = representation_values<value_type>::one();
+    return unary(asin(arg.value()), arg, one / sqrt(one - arg.value() * arg.value()));
+  }
+
+  /**
+   * @brief Arc cosine of an uncertain value (result in radians)
+   * @note Formula: c_i = -c_i(x) / √(1 - x²)
+   */
+  [[nodiscard]] friend constexpr correlated_uncertain acos(const correlated_uncertain& arg)
+    requires requires { acos(arg.value()); } || requires { std::acos(arg.value()); }
+  {
+    using std::acos;
+    using std::sqrt;
+    const value_type one = representation_values<value_type>::one();
+    return unary(acos(arg.value()), arg, -one / sqrt(one - arg.value() * arg.value()));
+  }
+
+  /**
+   * @brief Arc tangent of an uncertain value (result in radians)
+   * @note Formula: c_i = c_i(x) / (1 + x²)
+   */
+  [[nodiscard]] friend constexpr correlated_uncertain atan(const correlated_uncertain& arg)
+    requires requires { atan(arg.value()); } || requires { std::atan(arg.value()); }
+  {
+    using std::atan;
+    const value_type one = representation_values<value_type>::one();
+    return unary(atan(arg.value()), arg, one / (one + arg.value() * arg.value()));
+  }
+
+  /**
+   * @brief Two-argument arc tangent (result in radians)
+   * @note Formula: c_i = (x·c_i(y) - y·c_i(x)) / (x² + y²)
+   */
+  [[nodiscard]] friend constexpr correlated_uncertain atan2(const correlated_uncertain& lhs,
+                                                            const correlated_uncertain& rhs)
+    requires requires { atan2(lhs.value(), rhs.value()); } || requires { std::atan2(lhs.value(), rhs.value()); }
+  {
+    using std::atan2;
+    const auto sum_of_squares = rhs.value() * rhs.value() + lhs.value() * lhs.value();
+    return binary(atan2(lhs.value(), rhs.value()), lhs, rhs.value() / sum_of_squares, rhs,
+                  -lhs.value() / sum_of_squares);
+  }
+
+private:
+  using components_type = detail::small_buffer_vector<component, inline_capacity>;
+
+  // f(x) with the components `d·c_i(x)`, where `d` is the derivative of f at x.
+  [[nodiscard]] static constexpr correlated_uncertain unary(value_type val, const correlated_uncertain& arg,
+                                                            const value_type& d)
+  {
+    correlated_uncertain res(std::move(val));
+    if (d == representation_values<value_type>::zero()) return res;
+    component* out = res.components_.resize_for_overwrite(arg.components_.size());
+    for (const component& c : arg.components_) *out++ = {c.source, d * c.value};
+    return res;
+  }
+
+  // f(x, y) with the components `dx·c_i(x) + dy·c_i(y)`, merged by source. Both inputs are
+  // ordered by source, so this is a single linear pass. It runs into a stack buffer whenever the
+  // union could still fit inline, so operands sharing sources do not allocate either.
+  [[nodiscard]] static constexpr correlated_uncertain binary(value_type val, const correlated_uncertain& x,
+                                                             const value_type& dx, const correlated_uncertain& y,
+                                                             const value_type& dy)
+  {
+    correlated_uncertain res(std::move(val));
+    const auto merge = [&](component* out) {
+      const component* const first = out;
+      const auto emit = [&out](const uncertainty_source& source, const value_type& value) {
+        if (value != representation_values<value_type>::zero()) *out++ = {source, value};
+      };
+      const component* l = x.components_.begin();
+      const component* r = y.components_.begin();
+      while (l != x.components_.end() && r != y.components_.end()) {
+        if (l->source < r->source) {
+          emit(l->source, dx * l->value);
+          ++l;
+        } else if (r->source < l->source) {
+          emit(r->source, dy * r->value);
+          ++r;
+        } else {
+          emit(l->source, dx * l->value + dy * r->value);
+          ++l;
+          ++r;
+        }
+      }
+      for (; l != x.components_.end(); ++l) emit(l->source, dx * l->value);
+      for (; r != y.components_.end(); ++r) emit(r->source, dy * r->value);
+      return static_cast<std::size_t>(out - first);
+    };
+
+    const std::size_t max_size = x.components_.size() + y.components_.size();
+    if (max_size <= 2 * inline_capacity) {
+      std::array<component, 2 * inline_capacity> buffer{};
+      res.components_.assign(buffer.data(), merge(buffer.data()));
+    } else {
+      std::vector<component> buffer(max_size);
+      res.components_.assign(buffer.data(), merge(buffer.data()));
+    }
+    return res;
+  }
+
+  value_type value_{};
+  components_type components_;
+};
+
+}  // namespace mp_units::utility
+
+template<typename T, typename U>
+  requires requires { typename std::common_type_t<T, U>; }
+struct std::common_type<mp_units::utility::correlated_uncertain<T>, mp_units::utility::correlated_uncertain<U>> {
+  using type = mp_units::utility::correlated_uncertain<std::common_type_t<T, U>>;
+};
+
+// An exact value joins uncertainty propagation as `value ± 0`, exactly as for `uncertain`.
+template<typename T, typename U>
+  requires(std::is_arithmetic_v<U>) && requires { typename std::common_type_t<T, U>; }
+struct std::common_type<mp_units::utility::correlated_uncertain<T>, U> {
+  using type = mp_units::utility::correlated_uncertain<std::common_type_t<T, U>>;
+};
+
+template<typename T, typename U>
+  requires(std::is_arithmetic_v<U>) && requires { typename std::common_type_t<T, U>; }
+struct std::common_type<U, mp_units::utility::correlated_uncertain<T>> {
+  using type = mp_units::utility::correlated_uncertain<std::common_type_t<T, U>>;
+};
+
+/**
+ * @brief Formatting support for `correlated_uncertain`
+ *
+ * The value is printed through its `uncertain<T>` collapse, so every option of that formatter,
+ * including the concise `~` notation, applies unchanged.
+ */
+template<typename T, typename Char>
+struct MP_UNITS_STD_FMT::formatter<mp_units::utility::correlated_uncertain<T>, Char> :
+    formatter<mp_units::utility::uncertain<T>, Char> {
+  template<typename FormatContext>
+  auto format(const mp_units::utility::correlated_uncertain<T>& arg, FormatContext& ctx) const
+  {
+    return formatter<mp_units::utility::uncertain<T>, Char>::format(
+      static_cast<mp_units::utility::uncertain<T>>(arg), ctx);
+  }
+};
@@ -0,0 +1,402 @@
+// The MIT License (MIT)
+//
+// Copyright (c) 2018 Mateusz Pusz
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+
+#pragma once
+
+#include <mp-units/bits/requires_hosted.h>
+//
+#include <mp-units/bits/module_macros.h>
+#include <mp-units/utility/cartesian_tensor.h>
+
+#ifndef MP_UNITS_IN_MODULE_INTERFACE
+#include <mp-units/framework/customization_points.h>
+#include <mp-units/framework/representation_concepts.h>
+#if MP_UNITS_HOSTED
+#include <mp-units/ext/format.h>
+#endif
+#ifdef MP_UNITS_IMPORT_STD
+import std;
+#else
+#include <cmath>
+#include <cstddef>
+#include <type_traits>
+#include <utility>
+#if MP_UNITS_HOSTED
+#include <iosfwd>
+#endif
+#endif
+#endif
+
+namespace mp_units::utility {
+
+MP_UNITS_EXPORT template<Scalar T, std::size_t N>
+  requires(N == 2 || N == 3)
+class diagonal_cartesian_tensor;
+
+namespace detail {
+
+template<typename F, std::size_t... Is>
+[[nodiscard]] constexpr auto diagonal_cartesian_tensor_from(std::index_sequence<Is...>, F&& f)
+{
+  return diagonal_cartesian_tensor{f(Is)...};
+}
+
+// The operations of a `diagonal_cartesian_tensor`, including the mixed ones with a dense
+// `cartesian_tensor` and a `cartesian_vector`, as hidden friends (see `cartesian_tensor_iface`). Each
+// one touches only the N diagonal components of the diagonal operand, so e.g. `D ⋅ a` takes N
+// multiplications instead of N², and `D ⋅ S` for a dense `S` scales its rows.
+struct diagonal_cartesian_tensor_iface {
+  template<typename T, std::size_t N, typename U>
+    requires requires(const T& t, const U& u) { t + u; }
+  [[nodiscard]] friend constexpr auto operator+(const diagonal_cartesian_tensor<T, N>& lhs,
+                                                const diagonal_cartesian_tensor<U, N>& rhs)
+  {
+    return ::mp_units::utility::detail::diagonal_cartesian_tensor_from(
+      std::make_index_sequence<N>{}, [&](std::size_t i) { return lhs._data_[i] + rhs._data_[i]; });
+  }
+
+  template<typename T, std::size_t N, typename U>
+    requires requires(const T& t, const U& u) { t - u; }
+  [[nodiscard]] friend constexpr auto operator-(const diagonal_cartesian_tensor<T, N>& lhs,
+                                                const diagonal_cartesian_tensor<U, N>& rhs)
+  {
+    return ::mp_units::utility::detail::diagonal_cartesian_tensor_from(
+      std::make_index_sequence<N>{}, [&](std::size_t i) { return lhs._data_[i] - rhs._data_[i]; });
+  }
+
+  // see `cartesian_tensor_iface` for why a `Reference` or a `Quantity` operand is excluded
+  template<typename T, std::size_t N, typename U>
+    requires(!Reference<U>) && (!Quantity<U>) && requires(const T& t, const U& u) { t * u; }
+  [[nodiscard]] friend constexpr auto operator*(const diagonal_cartesian_tensor<T, N>& lhs, const U& rhs)
+  {
+    return ::mp_units::utility::detail::diagonal_cartesian_tensor_from(
+      std::make_index_sequence<N>{}, [&](std::size_t i) { return lhs._data_[i] * rhs; });
+  }
+
+  template<typename T, std::size_t N, typename U>
+    requires(!Reference<T>) && (!Quantity<T>) && requires(const T& t, const U& u) { t * u; }
+  [[nodiscard]] friend constexpr auto operator*(const T& lhs, const diagonal_cartesian_tensor<U, N>& rhs)
+  {
+    return rhs * lhs;
+  }
+
+  template<typename T, std::size_t N, typename U>
+    requires(!Reference<U>) && (!Quantity<U>) && requires(const T& t, const U& u) { t / u; }
+  [[nodiscard]] friend constexpr auto operator/(const diagonal_cartesian_tensor<T, N>& lhs, const U& rhs)
+  {
+    return ::mp_units::utility::detail::diagonal_cartesian_tensor_from(
+      std::make_index_sequence<N>{}, [&](std::size_t i) { return lhs._data_[i] / rhs; });
+  }
+
+  template<typename T, std::size_t N, std::equality_comparable_with<T> U>
+  [[nodiscard]] friend constexpr bool operator==(const diagonal_cartesian_tensor<T, N>& lhs,
+                                                 const diagonal_cartesian_tensor<U, N>& rhs)
+  {
+    for (std::size_t i = 0; i < N; ++i)
+      if (!(lhs._data_[i] == rhs._data_[i])) return false;
+    return true;
+  }
+
+  // inner products (ISO 80000-2:2019, 2-18.23 and 2-18.24)
+  template<typename T, std::size_t N, typename U>
+    requires requires(const T& t, const U& u) { t * u; }
+  [[nodiscard]] friend constexpr auto inner_product(const diagonal_cartesian_tensor<T, N>& lhs,
+                                                    const diagonal_cartesian_tensor<U, N>& rhs)
+  {
+    return ::mp_units::utility::detail::diagonal_cartesian_tensor_from(
+      std::make_index_sequence<N>{}, [&](std::size_t i) { return lhs._data_[i] * rhs._data_[i]; });
+  }
+
+  template<typename T, std::size_t N, typename U>
+    requires requires(const T& t, const U& u) { t * u; }
+  [[nodiscard]] friend constexpr auto inner_product(const diagonal_cartesian_tensor<T, N>& lhs,
+                                                    const cartesian_vector<U, N>& rhs)
+  {
+    return ::mp_units::utility::detail::cartesian_vector_from(
+      std::make_index_sequence<N>{}, [&](std::size_t i) { return lhs._data_[i] * rhs[i]; });
+  }
+
+  template<typename T, std::size_t N, typename U>
+    requires requires(const T& t, const U& u) { t * u; }
+  [[nodiscard]] friend constexpr auto inner_product(const diagonal_cartesian_tensor<T, N>& lhs,
+                                                    const cartesian_tensor<U, N>& rhs)
+  {
+    return ::mp_units::utility::detail::cartesian_tensor_from(
+      std::make_index_sequence<N * N>{}, [&](std::size_t idx) { return lhs._data_[idx / N] * rhs._data_[idx]; });
+  }
+
+  template<typename T, std::size_t N, typename U>
+    requires requires(const T& t, const U& u) { t * u; }
+  [[nodiscard]] friend constexpr auto inner_product(const cartesian_tensor<T, N>& lhs,
+                                                    const diagonal_cartesian_tensor<U, N>& rhs)
+  {
+    return ::mp_units::utility::detail::cartesian_tensor_from(
+      std::make_index_sequence<N * N>{}, [&](std::size_t idx) { return lhs._data_[idx] * rhs._data_[idx % N]; });
+  }
+
+  // scalar (double-dot) products (ISO 80000-2:2019, 2-18.25); only the diagonal contributes
+  template<typename T, std::size_t N, typename U>
+    requires requires(const T& t, const U& u, decltype(t * u) v) {
+      t * u;
+      v + v;
+    }
+  [[nodiscard]] friend constexpr auto scalar_product(const diagonal_cartesian_tensor<T, N>& lhs,
+                                                     const diagonal_cartesian_tensor<U, N>& rhs)
+  {
+    auto acc = ::mp_units::utility::detail::conjugate(lhs._data_[0]) * rhs._data_[0];
+    for (std::size_t i = 1; i < N; ++i)
+      acc = acc + ::mp_units::utility::detail::conjugate(lhs._data_[i]) * rhs._data_[i];
+    return acc;
+  }
+
+  template<typename T, std::size_t N, typename U>
+    requires requires(const T& t, const U& u, decltype(t * u) v) {
+      t * u;
+      v + v;
+    }
+  [[nodiscard]] friend constexpr auto scalar_product(const diagonal_cartesian_tensor<T, N>& lhs,
+                                                     const cartesian_tensor<U, N>& rhs)
+  {
+    auto acc = ::mp_units::utility::detail::conjugate(lhs._data_[0]) * rhs._data_[0];
+    for (std::size_t i = 1; i < N; ++i)
+      acc = acc + ::mp_units::utility::detail::conjugate(lhs._data_[i]) * rhs._data_[i * (N + 1)];
+    return acc;
+  }
+
+  template<typename T, std::size_t N, typename U>
+    requires requires(const T& t, const U& u, decltype(t * u) v) {
+      t * u;
+      v + v;
+    }
+  [[nodiscard]] friend constexpr auto scalar_product(const cartesian_tensor<T, N>& lhs,
+                                                     const diagonal_cartesian_tensor<U, N>& rhs)
+  {
+    auto acc = ::mp_units::utility::detail::conjugate(lhs._data_[0]) * rhs._data_[0];
+    for (std::size_t i = 1; i < N; ++i)
+      acc = acc + ::mp_units::utility::detail::conjugate(lhs._data_[i * (N + 1)]) * rhs._data_[i];
+    return acc;
+  }
+};
+
+}  // namespace detail
+
+/**
+ * @brief A second-order Cartesian tensor with only its diagonal components stored
+ *
+ * Models the same tensor as `cartesian_tensor<T, N>` (e.g. a principal-axes inertia or stress tensor,
+ * or an uncorrelated covariance) in N instead of N² components. The off-diagonal components read as
+ * `T{}`; they are not formed as `x - x` from a component, which is NaN for an infinite one.
+ * Converts implicitly to the dense `cartesian_tensor` and to `symmetric_cartesian_tensor`.
+ */
+MP_UNITS_EXPORT template<Scalar T = double, std::size_t N = 3>
+  requires(N == 2 || N == 3)
+class diagonal_cartesian_tensor : public detail::diagonal_cartesian_tensor_iface {
+public:
+  // public members required to satisfy structural type requirements :-(
+  T _data_[N];
+  using value_type = T;
+
+  static constexpr std::integral_constant<std::size_t, N> extent{};
+
+  template<typename... Args>
+    requires(sizeof...(Args) <= N) && (... && std::constructible_from<T, Args>)
+  [[nodiscard]] constexpr explicit(!(... && detail::ImplicitlyConvertibleScalar<Args, T>))
+    diagonal_cartesian_tensor(Args&&... args) :
+      _data_{static_cast<T>(std::forward<Args>(args))...}
+  {
+  }
+
+private:
+  template<typename V, std::size_t... Is>
+  constexpr diagonal_cartesian_tensor(std::index_sequence<Is...>, V&& other) :
+      _data_{static_cast<T>(std::forward<V>(other)._data_[Is])...}
+  {
+  }
+
+public:
+  template<typename U>
+    requires std::constructible_from<T, U>
+  [[nodiscard]] constexpr explicit(!detail::ImplicitlyConvertibleScalar<U, T>)
+    diagonal_cartesian_tensor(const diagonal_cartesian_tensor<U, N>& other) :
+      diagonal_cartesian_tensor(std::make_index_sequence<N>{}, other)
+  {
+  }
+
+  template<typename U>
+    requires std::constructible_from<U, T>
+  [[nodiscard]] constexpr explicit(!detail::ImplicitlyConvertibleScalar<T, U>) operator cartesian_tensor<U, N>() const
+  {
+    return detail::cartesian_tensor_from(std::make_index_sequence<N * N>{}, [&](std::size_t idx) {
+      return idx % (N + 1) == 0 ? static_cast<U>(_data_[idx / (N + 1)]) : U{};
+    });
+  }
+
+  // element access via (row, column); the off-diagonal components are not stored, so it yields values
+  [[nodiscard]] constexpr T operator()(std::size_t row, std::size_t col) const
+  {
+    return row == col ? _data_[row] : T{};
+  }
+
+#if __cpp_multidimensional_subscript && MP_UNITS_COMP_GCC != 12
+  [[nodiscard]] constexpr T operator[](std::size_t row, std::size_t col) const { return (*this)(row, col); }
+#endif
+
+  // the i-th diagonal component; a single-index `operator[]` would make the tensor order ambiguous
+  [[nodiscard]] constexpr T& diagonal(std::size_t i) { return _data_[i]; }
+  [[nodiscard]] constexpr const T& diagonal(std::size_t i) const { return _data_[i]; }
+
+  [[nodiscard]] constexpr auto real() const
+    requires ComplexScalar<T>
+  {
+    return ::mp_units::utility::detail::diagonal_cartesian_tensor_from(
+      std::make_index_sequence<N>{}, [&](std::size_t i) { return ::mp_units::real(_data_[i]); });
+  }
+
+  [[nodiscard]] constexpr auto imag() const
+    requires ComplexScalar<T>
+  {
+    return ::mp_units::utility::detail::diagonal_cartesian_tensor_from(
+      std::make_index_sequence<N>{}, [&](std::size_t i) { return ::mp_units::imag(_data_[i]); });
+  }
+
+  // Frobenius norm
+  [[nodiscard]] constexpr auto magnitude() const
+    requires requires(T t) {
+      requires(requires { sqrt(t * t); } || requires { std::sqrt(t * t); }) || requires { ::mp_units::modulus(t); };
+    }
+  {
+    using std::sqrt;
+    if constexpr (ComplexScalar<T>) {
+      auto sum = ::mp_units::modulus(_data_[0]) * ::mp_units::modulus(_data_[0]);
+      for (std::size_t i = 1; i < N; ++i) sum += ::mp_units::modulus(_data_[i]) * ::mp_units::modulus(_data_[i]);
+      return sqrt(sum);
+    } else {
+      auto sum = _data_[0] * _data_[0];
+      for (std::size_t i = 1; i < N; ++i) sum += _data_[i] * _data_[i];
+      return sqrt(sum);
+    }
+  }
+
+  [[nodiscard]] constexpr auto norm() const
+    requires requires(const diagonal_cartesian_tensor& t) { t.magnitude(); }
+  {
+    return magnitude();
+  }
+
+  [[nodiscard]] constexpr diagonal_cartesian_tensor operator+() const { return *this; }
+  [[nodiscard]] constexpr diagonal_cartesian_tensor operator-() const
+  {
+    return ::mp_units::utility::detail::diagonal_cartesian_tensor_from(std::make_index_sequence<N>{},
+                                                                       [&](std::size_t i) { return -_data_[i]; });
+  }
+
+  template<typename U>
+    requires requires(T& t, const U& u) {
+      { t += u } -> std::same_as<T&>;
+    }
+  constexpr diagonal_cartesian_tensor& operator+=(const diagonal_cartesian_tensor<U, N>& other)
+  {
+    for (std::size_t i = 0; i < N; ++i) _data_[i] += other._data_[i];
+    return *this;
+  }
+
+  template<typename U>
+    requires requires(T& t, const U& u) {
+      { t -= u } -> std::same_as<T&>;
+    }
+  constexpr diagonal_cartesian_tensor& operator-=(const diagonal_cartesian_tensor<U, N>& other)
+  {
+    for (std::size_t i = 0; i < N; ++i) _data_[i] -= other._data_[i];
+    return *this;
+  }
+
+  template<typename U>
+    requires requires(T& t, const U& u) {
+      { t *= u } -> std::same_as<T&>;
+    }
+  constexpr diagonal_cartesian_tensor& operator*=(const U& value)
+  {
+    for (std::size_t i = 0; i < N; ++i) _data_[i] *= value;
+    return *this;
+  }
+
+  template<typename U>
+    requires requires(T& t, const U& u) {
+      { t /= u } -> std::same_as<T&>;
+    }
+  constexpr diagonal_cartesian_tensor& operator/=(const U& value)
+  {
+    for (std::size_t i = 0; i < N; ++i) _data_[i] /= value;
+    return *this;
+  }
+
+  [[nodiscard]] friend constexpr auto norm(const diagonal_cartesian_tensor& t)
+    requires requires { t.norm(); }
+  {
+    return t.norm();
+  }
+
+  [[nodiscard]] friend constexpr auto magnitude(const diagonal_cartesian_tensor& t)
+    requires requires { t.norm(); }
+  {
+    return t.norm();
+  }
+
+#if MP_UNITS_HOSTED
+  friend constexpr std::ostream& operator<<(std::ostream& os, const diagonal_cartesian_tensor& t)
+  {
+    return os << cartesian_tensor<T, N>(t);
+  }
+#endif
+};
+
+template<typename Arg, typename... Args>
+  requires(1 + sizeof...(Args) == 2 || 1 + sizeof...(Args) == 3) &&
+          requires { typename std::common_type_t<Arg, Args...>; }
+diagonal_cartesian_tensor(Arg, Args...)
+  -> diagonal_cartesian_tensor<std::common_type_t<Arg, Args...>, 1 + sizeof...(Args)>;
+
+// the dense tensor is deduced from a diagonal one (e.g. `cartesian_tensor dense = t;`)
+template<typename T, std::size_t N>
+cartesian_tensor(diagonal_cartesian_tensor<T, N>) -> cartesian_tensor<T, N>;
+
+}  // namespace mp_units::utility
+
+template<typename T, std::size_t N, typename U>
+  requires requires { typename std::common_type_t<T, U>; }
+struct std::common_type<mp_units::utility::diagonal_cartesian_tensor<T, N>,
+                        mp_units::utility::diagonal_cartesian_tensor<U, N>> {
+  using type = mp_units::utility::diagonal_cartesian_tensor<std::common_type_t<T, U>, N>;
+};
+
+#if MP_UNITS_HOSTED
+template<typename T, std::size_t N, typename Char>
+struct MP_UNITS_STD_FMT::formatter<mp_units::utility::diagonal_cartesian_tensor<T, N>, Char> :
+    MP_UNITS_STD_FMT::formatter<mp_units::utility::cartesian_tensor<T, N>, Char> {
+  template<typename FormatContext>
+  auto format(const mp_units::utility::diagonal_cartesian_tensor<T, N>& tensor, FormatContext& ctx) const
+  {
+    return MP_UNITS_STD_FMT::formatter<mp_units::utility::cartesian_tensor<T, N>, Char>::format(
+      mp_units::utility::cartesian_tensor<T, N>(tensor), ctx);
+  }
+};
+#endif
@@ -0,0 +1,352 @@
+// The MIT License (MIT)
+//
+// Copyright (c) 2018 Mateusz Pusz
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+
+#pragma once
+
+#include <mp-units/bits/requires_hosted.h>
+//
+#include <mp-units/bits/module_macros.h>
+
+#ifndef MP_UNITS_IN_MODULE_INTERFACE
+#include <mp-units/framework/quantity.h>
+#include <mp-units/framework/quantity_concepts.h>
+#include <mp-units/framework/quantity_spec.h>
+#include <mp-units/framework/reference.h>
+#include <mp-units/framework/reference_concepts.h>
+#include <mp-units/framework/representation_concepts.h>
+#include <mp-units/framework/unit.h>
+#ifdef MP_UNITS_IMPORT_STD
+import std;
+#else
+#include <cmath>
+#include <concepts>
+#include <cstddef>
+#include <tuple>
+#include <type_traits>
+#include <utility>
+#endif
+#endif
+
+namespace mp_units::utility {
+
+/**
+ * @brief The references of the rows (or the columns) of a `dimensioned_matrix`
+ *
+ * A typed index attaches a compile-time reference to every position along one axis of a
+ * matrix, e.g. `typed_index<isq::length[m], isq::speed[m / s]>` for the rows of a
+ * position-velocity state vector.
+ */
+MP_UNITS_EXPORT template<Reference auto... Rs>
+struct typed_index {
+  static constexpr std::size_t size = sizeof...(Rs);
+};
+
+namespace detail {
+
+template<typename T>
+constexpr bool is_typed_index = false;
+
+template<auto... Rs>
+constexpr bool is_typed_index<typed_index<Rs...>> = true;
+
+template<typename T>
+struct inverse_typed_index;
+
+template<auto... Rs>
+struct inverse_typed_index<typed_index<Rs...>> {
+  using type = typed_index<(one / Rs)...>;
+};
+
+template<std::size_t I, auto... Rs>
+[[nodiscard]] consteval Reference auto typed_index_at(typed_index<Rs...>)
+{
+  return std::get<I>(std::tuple{Rs...});
+}
+
+// A fixed-size matrix type with the interface of an Eigen `Matrix` (`Scalar`, `Index`,
+// `RowsAtCompileTime`, `ColsAtCompileTime`, `Zero()`, `transpose()`, `inverse()`, `operator()`,
+// and products that evaluate to their `PlainObject`). It is detected structurally, so this
+// header does not depend on Eigen.
+template<typename S>
+concept EigenLikeMatrix = requires(S& s, const S& cs, typename S::Index i) {
+  typename S::Scalar;
+  { S::RowsAtCompileTime } -> std::convertible_to<int>;
+  { S::ColsAtCompileTime } -> std::convertible_to<int>;
+  { S::Zero() };
+  { cs.transpose() };
+  { s(i, i) } -> std::same_as<typename S::Scalar&>;
+};
+
+template<typename Storage>
+struct matrix_scalar {
+  using type = Storage;
+};
+
+template<EigenLikeMatrix Storage>
+struct matrix_scalar<Storage> {
+  using type = Storage::Scalar;
+};
+
+template<typename Storage, std::size_t Rows, std::size_t Cols>
+constexpr bool matrix_storage_of = !EigenLikeMatrix<Storage>;
+
+template<EigenLikeMatrix Storage, std::size_t Rows, std::size_t Cols>
+constexpr bool matrix_storage_of<Storage, Rows, Cols> =
+  Storage::RowsAtCompileTime == static_cast<int>(Rows) && Storage::ColsAtCompileTime == static_cast<int>(Cols);
+
+}  // namespace detail
+
+MP_UNITS_EXPORT template<typename Rows, typename Cols, typename Storage = double>
+  requires detail::is_typed_index<Rows> && detail::is_typed_index<Cols> &&
+           detail::matrix_storage_of<Storage, Rows::size, Cols::size>
+class dimensioned_matrix;
+
+MP_UNITS_EXPORT template<typename Rows, typename Storage = double>
+using dimensioned_vector = dimensioned_matrix<Rows, typed_index<one>, Storage>;
+
+MP_UNITS_EXPORT template<typename T>
+using inverse_typed_index_t = detail::inverse_typed_index<T>::type;
+
+/**
+ * @brief A fixed-size matrix whose entries have different units
+ *
+ * The reference of the entry `(i, j)` is derived at compile time as `Rows_i / Cols_j` from the
+ * typed indices of the rows and the columns, while the numbers are stored as a plain
+ * `Storage[rows][cols]` array or, when `Storage` is a fixed-size Eigen matrix, in that matrix.
+ * This is the structure of every matrix of linear algebra applied to a physical system: the
+ * state transition matrix of a state `x` is `<x, x>`, its covariance `<x, 1/x>` (the entries
+ * are of `x_i * x_j`), a Jacobian of `z(x)` is `<z, x>`, and a state vector is `<x, one>`.
+ *
+ * `get<I, J>()` and `set<I, J>()` return and check a `quantity` of the reference of the entry.
+ * The product, `transpose()`, and `inverse()` derive the typed indices of their results
+ * (`<R, C> * <C, C2>` is `<R, C2>`, the transpose of `<R, C>` is `<1/C, 1/R>`, and its inverse
+ * `<C, R>`), so the units of every entry are checked once, when the types of the operands match,
+ * and the numbers are computed exactly as for a matrix of raw numbers: as all the references of
+ * the product are built from the same units, no entry ever needs a conversion at runtime.
+ *
+ * @code
+ * using state = typed_index<isq::length[m], isq::speed[m / s]>;
+ * dimensioned_matrix<state, state> f = dimensioned_matrix<state, state>::identity();
+ * f.set<0, 1>(1. * s);
+ * dimensioned_matrix<state, inverse_typed_index_t<state>> p;
+ * p.set<0, 1>(2. * m * m / s);
+ * auto next = f * p * transpose(f);  // dimensioned_matrix<state, inverse_typed_index_t<state>>
+ * @endcode
+ *
+ * @tparam Rows the typed index of the rows
+ * @tparam Cols the typed index of the columns
+ * @tparam Storage the type of the numbers, or a fixed-size Eigen matrix of `Rows::size` x `Cols::size`
+ */
+template<typename Rows, typename Cols, typename Storage>
+  requires detail::is_typed_index<Rows> && detail::is_typed_index<Cols> &&
+           detail::matrix_storage_of<Storage, Rows::size, Cols::size>
+class dimensioned_matrix {
+  static constexpr bool eigen_storage = detail::EigenLikeMatrix<Storage>;
+
+public:
+  using rep = detail::matrix_scalar<Storage>::type;
+  using storage_type = std::conditional_t<eigen_storage, Storage, rep[Rows::size][Cols::size]>;
+  using row_index = Rows;
+  using column_index = Cols;
+  static constexpr std::size_t rows = Rows::size;
+  static constexpr std::size_t cols = Cols::size;
+
+  template<std::size_t I, std::size_t J>
+    requires(I < rows) && (J < cols)
+  static constexpr Reference auto reference =
+    detail::typed_index_at<I>(Rows{}) / detail::typed_index_at<J>(Cols{});
+
+private:
+  storage_type storage_{};
+
+public:
+  constexpr dimensioned_matrix()
+  {
+    if constexpr (eigen_storage) storage_ = Storage::Zero();
+  }
+
+  /**
+   * @brief Wraps the numbers of the entries, each in the unit of `reference<I, J>`
+   */
+  constexpr explicit dimensioned_matrix(const Storage& numbers)
+    requires eigen_storage
+      : storage_(numbers)
+  {
+  }
+
+  [[nodiscard]] static constexpr dimensioned_matrix identity()
+    requires(rows == cols)
+  {
+    dimensioned_matrix m;
+    [&]<std::size_t... Is>(std::index_sequence<Is...>) {
+      static_assert((QuantityOf<quantity<reference<Is, Is>, rep>, dimensionless> && ...),
+                    "the diagonal of an identity matrix has to be dimensionless");
+      ((m(Is, Is) = (rep{1} * one).numerical_value_in(get_unit(reference<Is, Is>))), ...);
+    }(std::make_index_sequence<rows>{});
+    return m;
+  }
+
+  template<std::size_t I, std::size_t J>
+    requires(I < rows) && (J < cols)
+  [[nodiscard]] constexpr quantity<reference<I, J>, rep> get() const
+  {
+    return (*this)(I, J) * reference<I, J>;
+  }
+
+  template<std::size_t I, std::size_t J, Quantity Q>
+    requires(I < rows) && (J < cols) && std::convertible_to<Q, quantity<reference<I, J>, rep>>
+  constexpr void set(const Q& q)
+  {
+    (*this)(I, J) = quantity<reference<I, J>, rep>(q).numerical_value_in(get_unit(reference<I, J>));
+  }
+
+  /**
+   * @brief The number of the entry `(i, j)` in the unit of `reference<i, j>`
+   */
+  [[nodiscard]] constexpr rep& operator()(std::size_t i, std::size_t j)
+  {
+    if constexpr (eigen_storage)
+      return storage_(static_cast<typename Storage::Index>(i), static_cast<typename Storage::Index>(j));
+    else
+      return storage_[i][j];
+  }
+
+  [[nodiscard]] constexpr const rep& operator()(std::size_t i, std::size_t j) const
+  {
+    if constexpr (eigen_storage)
+      return storage_(static_cast<typename Storage::Index>(i), static_cast<typename Storage::Index>(j));
+    else
+      return storage_[i][j];
+  }
+
+  [[nodiscard]] constexpr storage_type& numerical_values() { return storage_; }
+  [[nodiscard]] constexpr const storage_type& numerical_values() const { return storage_; }
+
+  [[nodiscard]] friend constexpr dimensioned_matrix operator+(dimensioned_matrix lhs, const dimensioned_matrix& rhs)
+  {
+    if constexpr (eigen_storage)
+      lhs.storage_ += rhs.storage_;
+    else
+      for (std::size_t i = 0; i < rows; ++i)
+        for (std::size_t j = 0; j < cols; ++j) lhs.storage_[i][j] += rhs.storage_[i][j];
+    return lhs;
+  }
+
+  [[nodiscard]] friend constexpr dimensioned_matrix operator-(dimensioned_matrix lhs, const dimensioned_matrix& rhs)
+  {
+    if constexpr (eigen_storage)
+      lhs.storage_ -= rhs.storage_;
+    else
+      for (std::size_t i = 0; i < rows; ++i)
+        for (std::size_t j = 0; j < cols; ++j) lhs.storage_[i][j] -= rhs.storage_[i][j];
+    return lhs;
+  }
+
+  template<typename Cols2, typename Storage2>
+    requires(eigen_storage == detail::EigenLikeMatrix<Storage2>) &&
+            std::same_as<rep, typename detail::matrix_scalar<Storage2>::type>
+  [[nodiscard]] friend constexpr auto operator*(const dimensioned_matrix& lhs,
+                                                const dimensioned_matrix<Cols, Cols2, Storage2>& rhs)
+  {
+    if constexpr (eigen_storage) {
+      auto product = (lhs.storage_ * rhs.numerical_values()).eval();
+      return dimensioned_matrix<Rows, Cols2, decltype(product)>(product);
+    } else {
+      dimensioned_matrix<Rows, Cols2, Storage> res;
+      for (std::size_t i = 0; i < rows; ++i)
+        for (std::size_t k = 0; k < cols; ++k)
+          for (std::size_t j = 0; j < Cols2::size; ++j) res(i, j) += lhs(i, k) * rhs(k, j);
+      return res;
+    }
+  }
+
+  [[nodiscard]] friend constexpr auto transpose(const dimensioned_matrix& m)
+  {
+    using res_rows = inverse_typed_index_t<Cols>;
+    using res_cols = inverse_typed_index_t<Rows>;
+    if constexpr (eigen_storage) {
+      auto t = m.storage_.transpose().eval();
+      return dimensioned_matrix<res_rows, res_cols, decltype(t)>(t);
+    } else {
+      dimensioned_matrix<res_rows, res_cols, Storage> res;
+      for (std::size_t i = 0; i < rows; ++i)
+        for (std::size_t j = 0; j < cols; ++j) res(j, i) = m(i, j);
+      return res;
+    }
+  }
+
+  /**
+   * @brief The inverse of a square matrix, which has to be invertible
+   *
+   * Eigen storage uses `inverse()` of Eigen (which needs `<Eigen/LU>`); a plain array is inverted
+   * by the Gauss-Jordan elimination with partial pivoting.
+   */
+  [[nodiscard]] friend constexpr auto inverse(const dimensioned_matrix& m)
+    requires(rows == cols)
+  {
+    if constexpr (eigen_storage) {
+      return dimensioned_matrix<Cols, Rows, Storage>(Storage(m.storage_.inverse()));
+    } else {
+      using std::abs;
+      dimensioned_matrix a = m;
+      dimensioned_matrix<Cols, Rows, Storage> res;
+      for (std::size_t i = 0; i < rows; ++i) res(i, i) = rep{1};
+      for (std::size_t col = 0; col < rows; ++col) {
+        std::size_t pivot = col;
+        for (std::size_t r = col + 1; r < rows; ++r)
+          if (abs(a(r, col)) > abs(a(pivot, col))) pivot = r;
+        for (std::size_t j = 0; j < rows; ++j) {
+          std::swap(a(col, j), a(pivot, j));
+          std::swap(res(col, j), res(pivot, j));
+        }
+        const rep scale = rep{1} / a(col, col);
+        for (std::size_t j = 0; j < rows; ++j) {
+          a(col, j) *= scale;
+          res(col, j) *= scale;
+        }
+        for (std::size_t r = 0; r < rows; ++r) {
+          if (r == col) continue;
+          const rep factor = a(r, col);
+          for (std::size_t j = 0; j < rows; ++j) {
+            a(r, j) -= factor * a(col, j);
+            res(r, j) -= factor * res(col, j);
+          }
+        }
+      }
+      return res;
+    }
+  }
+
+  [[nodiscard]] friend constexpr bool operator==(const dimensioned_matrix& lhs, const dimensioned_matrix& rhs)
+  {
+    if constexpr (eigen_storage)
+      return lhs.storage_ == rhs.storage_;
+    else {
+      for (std::size_t i = 0; i < rows; ++i)
+        for (std::size_t j = 0; j < cols; ++j)
+          if (lhs.storage_[i][j] != rhs.storage_[i][j]) return false;
+      return true;
+    }
+  }
+};
+
+}  // namespace mp_units::utility
@@ -0,0 +1,227 @@
+// The MIT License (MIT)
+//
+// Copyright (c) 2018 Mateusz Pusz
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+
+#pragma once
+
+#include <mp-units/bits/requires_hosted.h>
+//
+#include <mp-units/bits/module_macros.h>
+
+#ifndef MP_UNITS_IN_MODULE_INTERFACE
+#include <mp-units/framework/customization_points.h>
+#include <mp-units/framework/quantity.h>
+#include <mp-units/framework/quantity_concepts.h>
+#include <mp-units/framework/reference.h>
+#include <mp-units/framework/reference_concepts.h>
+#include <mp-units/framework/unit.h>
+#ifdef MP_UNITS_IMPORT_STD
+import std;
+#else
+#include <concepts>
+#include <type_traits>
+#endif
+#endif
+
+namespace mp_units::utility {
+
+MP_UNITS_EXPORT template<Reference auto R, typename Expr>
+class lazy_quantity;
+
+namespace detail {
+
+template<typename T>
+constexpr bool is_lazy_quantity = false;
+
+template<auto R, typename Expr>
+constexpr bool is_lazy_quantity<lazy_quantity<R, Expr>> = true;
+
+// A scalar factor of an expression: a plain number convertible to the element type `Elem`.
+template<typename T, typename Elem>
+concept LazyScalarFactor = (!Quantity<T>) && (!is_lazy_quantity<T>) && std::convertible_to<const T&, Elem>;
+
+}  // namespace detail
+
+/**
+ * @brief A quantity whose numerical value is an unevaluated expression template
+ *
+ * Expression-template libraries (e.g. Eigen and Blaze) return lazy proxies from their arithmetic
+ * operators, and `representation_canonical_type` makes a `quantity` evaluate every such proxy, so
+ * `a * q1 + b * q2 - q3` with vector representations materializes a temporary at each operator.
+ * `lazy(q)` opts out of that for one expression: the arithmetic on `lazy_quantity` objects
+ * computes the resulting reference at compile time, exactly like the arithmetic on quantities, and
+ * composes the numerical values into a single proxy. It is evaluated in one pass when it is
+ * converted to a `quantity` or when `eval()` is called:
+ *
+ * @code{.cpp}
+ * quantity<isq::velocity[m / s], Eigen::VectorXd> v = 2. * lazy(v1) + lazy(v2) - lazy(v3);
+ * @endcode
+ *
+ * Unit conversions needed by the addition and the subtraction are folded into the proxy as
+ * constant factors.
+ *
+ * @note Like the proxies it holds, a `lazy_quantity` refers to the numerical values of its
+ *       operands, so it has to be evaluated before those quantities go out of scope. Do not
+ *       store it in an `auto` variable that outlives them.
+ *
+ * @tparam R the reference of the result
+ * @tparam Expr the type of the proxy, or a reference to the numerical value of a quantity
+ */
+MP_UNITS_EXPORT template<Reference auto R, typename Expr>
+class lazy_quantity {
+  Expr expr_;
+
+  template<Reference auto R2, typename Expr2>
+  friend class lazy_quantity;
+
+public:
+  static constexpr Reference auto reference = R;
+  static constexpr QuantitySpec auto quantity_spec = get_quantity_spec(reference);
+  static constexpr Unit auto unit = get_unit(reference);
+  using expression_type = Expr;
+  using rep = representation_canonical_type_t<std::remove_cvref_t<Expr>>;
+  using element_type = representation_underlying_type_t<rep>;
+
+  [[nodiscard]] constexpr explicit lazy_quantity(Expr expr) : expr_(static_cast<Expr>(expr)) {}
+
+  [[nodiscard]] constexpr const std::remove_reference_t<Expr>& expression() const { return expr_; }
+
+  // The proxy scaled to the numerical value of the same quantity in `U` (no-op when `U` is `unit`).
+  template<Unit U>
+  [[nodiscard]] constexpr decltype(auto) expression_in(U) const
+  {
+    if constexpr (U{} == unit)
+      return expression();
+    else {
+      constexpr element_type factor = quantity<unit, element_type>{element_type{1}, unit}.numerical_value_in(U{});
+      return expr_ * factor;
+    }
+  }
+
+  [[nodiscard]] constexpr quantity<R, rep> eval() const { return quantity<R, rep>{rep(expr_), R}; }
+
+  // Evaluates the expression directly into a quantity wherever a `quantity<R, rep>` would convert
+  // implicitly, with any unit conversion folded into the single pass.
+  template<Reference auto R2, typename Rep2>
+    requires std::convertible_to<quantity<R, rep>, quantity<R2, Rep2>> &&
+             requires(const lazy_quantity& q) { Rep2(q.expression_in(get_unit(R2))); }
+  [[nodiscard]] constexpr operator quantity<R2, Rep2>() const
+  {
+    return quantity<R2, Rep2>{Rep2(expression_in(get_unit(R2))), R2};
+  }
+
+  [[nodiscard]] friend constexpr auto operator-(const lazy_quantity& q)
+    requires requires { -q.expr_; }
+  {
+    return lazy_quantity<R, std::remove_cvref_t<decltype(-q.expr_)>>(-q.expr_);
+  }
+
+  template<auto R2, typename Expr2>
+    requires requires(const lazy_quantity& lhs, const lazy_quantity<R2, Expr2>& rhs) {
+      lhs.expression_in(get_unit(get_common_reference(R, R2))) +
+        rhs.expression_in(get_unit(get_common_reference(R, R2)));
+    }
+  [[nodiscard]] friend constexpr auto operator+(const lazy_quantity& lhs, const lazy_quantity<R2, Expr2>& rhs)
+  {
+    constexpr Reference auto ret = get_common_reference(R, R2);
+    using expr = decltype(lhs.expression_in(get_unit(ret)) + rhs.expression_in(get_unit(ret)));
+    return lazy_quantity<ret, std::remove_cvref_t<expr>>(lhs.expression_in(get_unit(ret)) +
+                                                         rhs.expression_in(get_unit(ret)));
+  }
+
+  template<auto R2, typename Expr2>
+    requires requires(const lazy_quantity& lhs, const lazy_quantity<R2, Expr2>& rhs) {
+      lhs.expression_in(get_unit(get_common_reference(R, R2))) -
+        rhs.expression_in(get_unit(get_common_reference(R, R2)));
+    }
+  [[nodiscard]] friend constexpr auto operator-(const lazy_quantity& lhs, const lazy_quantity<R2, Expr2>& rhs)
+  {
+    constexpr Reference auto ret = get_common_reference(R, R2);
+    using expr = decltype(lhs.expression_in(get_unit(ret)) - rhs.expression_in(get_unit(ret)));
+    return lazy_quantity<ret, std::remove_cvref_t<expr>>(lhs.expression_in(get_unit(ret)) -
+                                                         rhs.expression_in(get_unit(ret)));
+  }
+
+  // scaling by a number keeps the reference
+  template<detail::LazyScalarFactor<element_type> S>
+    requires requires(const Expr& e, element_type s) { e * s; }
+  [[nodiscard]] friend constexpr auto operator*(const lazy_quantity& q, const S& s)
+  {
+    using expr = decltype(q.expr_ * static_cast<element_type>(s));
+    return lazy_quantity<R, std::remove_cvref_t<expr>>(q.expr_ * static_cast<element_type>(s));
+  }
+
+  template<detail::LazyScalarFactor<element_type> S>
+    requires requires(const Expr& e, element_type s) { e * s; }
+  [[nodiscard]] friend constexpr auto operator*(const S& s, const lazy_quantity& q)
+  {
+    return q * s;
+  }
+
+  template<detail::LazyScalarFactor<element_type> S>
+    requires requires(const Expr& e, element_type s) { e / s; }
+  [[nodiscard]] friend constexpr auto operator/(const lazy_quantity& q, const S& s)
+  {
+    using expr = decltype(q.expr_ / static_cast<element_type>(s));
+    return lazy_quantity<R, std::remove_cvref_t<expr>>(q.expr_ / static_cast<element_type>(s));
+  }
+
+  // scaling by a scalar quantity multiplies the references
+  template<auto R2, typename Rep2>
+    requires std::convertible_to<const Rep2&, element_type> && requires(const Expr& e, element_type s) { e * s; }
+  [[nodiscard]] friend constexpr auto operator*(const lazy_quantity& q, const quantity<R2, Rep2>& s)
+  {
+    const auto value = static_cast<element_type>(s.numerical_value_ref_in(get_unit(R2)));
+    return lazy_quantity<R * R2, std::remove_cvref_t<decltype(q.expr_ * value)>>(q.expr_ * value);
+  }
+
+  template<auto R2, typename Rep2>
+    requires std::convertible_to<const Rep2&, element_type> && requires(const Expr& e, element_type s) { e * s; }
+  [[nodiscard]] friend constexpr auto operator*(const quantity<R2, Rep2>& s, const lazy_quantity& q)
+  {
+    const auto value = static_cast<element_type>(s.numerical_value_ref_in(get_unit(R2)));
+    return lazy_quantity<R2 * R, std::remove_cvref_t<decltype(q.expr_ * value)>>(q.expr_ * value);
+  }
+
+  template<auto R2, typename Rep2>
+    requires std::convertible_to<const Rep2&, element_type> && requires(const Expr& e, element_type s) { e / s; }
+  [[nodiscard]] friend constexpr auto operator/(const lazy_quantity& q, const quantity<R2, Rep2>& s)
+  {
+    const auto value = static_cast<element_type>(s.numerical_value_ref_in(get_unit(R2)));
+    return lazy_quantity<R / R2, std::remove_cvref_t<decltype(q.expr_ / value)>>(q.expr_ / value);
+  }
+};
+
+/**
+ * @brief Starts an unevaluated expression on the numerical value of `q`
+ *
+ * The result refers to `q`, so an rvalue quantity is rejected.
+ */
+MP_UNITS_EXPORT template<auto R, typename Rep>
+[[nodiscard]] constexpr lazy_quantity<R, const Rep&> lazy(const quantity<R, Rep>& q)
+{
+  return lazy_quantity<R, const Rep&>(q.numerical_value_ref_in(get_unit(R)));
+}
+
+MP_UNITS_EXPORT template<auto R, typename Rep>
+void lazy(const quantity<R, Rep>&&) = delete;
+
+}  // namespace mp_units::utility
@@ -0,0 +1,498 @@
+// The MIT License (MIT)
+//
+// Copyright (c) 2018 Mateusz Pusz
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+
+#pragma once
+
+#include <mp-units/bits/requires_hosted.h>
+//
+#include <mp-units/bits/module_macros.h>
+#include <mp-units/ext/contracts.h>
+#include <mp-units/utility/random.h>
+#include <mp-units/utility/uncertain.h>
+
+#ifndef MP_UNITS_IN_MODULE_INTERFACE
+#include <mp-units/framework/quantity.h>
+#include <mp-units/framework/quantity_concepts.h>
+#ifdef MP_UNITS_IMPORT_STD
+import std;
+#else
+#include <algorithm>
+#include <atomic>
+#include <cmath>
+#include <concepts>
+#include <cstddef>
+#include <cstdint>
+#include <exception>
+#include <functional>
+#include <limits>
+#include <random>
+#include <span>
+#include <thread>
+#include <tuple>
+#include <type_traits>
+#include <utility>
+#include <vector>
+#endif
+#endif
+
+namespace mp_units::utility {
+
+/**
+ * @brief The options of a Monte Carlo uncertainty propagation
+ *
+ * The samples are generated and evaluated in blocks of `block_size`, and every block draws from
+ * its own `philox4x32` stream keyed by `(seed, block index)`. The blocks are combined in their
+ * index order, so the result depends only on `seed`, `block_size`, and `quantile_accuracy`, and is
+ * bit-identical for every value of `threads`.
+ */
+MP_UNITS_EXPORT struct mc_policy {
+  /// @brief The seed of the random streams
+  std::uint64_t seed = 0;
+  /// @brief The number of threads to evaluate the blocks on (`0` selects the hardware concurrency)
+  std::size_t threads = 0;
+  /// @brief The number of samples generated and evaluated together
+  std::size_t block_size = 4096;
+  /// @brief The capacity of each level of the quantile summary (see `mc_result::quantile()`)
+  std::size_t quantile_accuracy = 4096;
+};
+
+namespace detail {
+
+// A mergeable summary for the quantiles of a stream of values in bounded memory. Level `l` holds
+// values that stand for `2^l` samples each; a full level is sorted and every other value (the odd
+// or the even ones, alternately) moves up a level. This is the compactor of the KLL sketch with a
+// deterministic choice of the half that is kept, so the same stream always gives the same summary.
+// The memory is O(k log(n/k)), and the rank error of a quantile is a small multiple of n/k.
+template<typename T>
+class quantile_sketch {
+  std::vector<std::vector<T>> levels_;
+  std::size_t capacity_;
+  std::uint64_t compactions_ = 0;
+
+  void compact(std::size_t level)
+  {
+    if (level + 1 == levels_.size()) levels_.emplace_back().reserve(capacity_);
+    std::vector<T>& from = levels_[level];
+    std::ranges::sort(from);
+    const std::size_t offset = compactions_++ & 1;
+    for (std::size_t i = offset; i < from.size(); i += 2) levels_[level + 1].push_back(from[i]);
+    from.clear();
+    if (levels_[level + 1].size() >= capacity_) compact(level + 1);
+  }
+
+public:
+  explicit quantile_sketch(std::size_t capacity) : capacity_(std::max<std::size_t>(capacity + (capacity & 1), 2))
+  {
+    levels_.emplace_back().reserve(capacity_);
+  }
+
+  void push(T value)
+  {
+    levels_[0].push_back(value);
+    if (levels_[0].size() >= capacity_) compact(0);
+  }
+
+  // The smallest summarized value whose cumulative weight reaches `p` of the total.
+  [[nodiscard]] T quantile(double p) const
+  {
+    std::vector<std::pair<T, std::uint64_t>> items;
+    std::uint64_t total = 0;
+    for (std::size_t level = 0; level < levels_.size(); ++level) {
+      const std::uint64_t weight = std::uint64_t{1} << level;
+      for (const T& v : levels_[level]) items.emplace_back(v, weight);
+      total += weight * levels_[level].size();
+    }
+    std::ranges::sort(items, {}, &std::pair<T, std::uint64_t>::first);
+    const double target = p * static_cast<double>(total);
+    std::uint64_t cumulative = 0;
+    for (const auto& [value, weight] : items) {
+      cumulative += weight;
+      if (static_cast<double>(cumulative) >= target) return value;
+    }
+    return items.back().first;
+  }
+};
+
+// The moments and extremes of a set of samples, merged with the pairwise update of Chan et al.
+template<typename T>
+struct mc_moments {
+  std::size_t count = 0;
+  T mean{};
+  T m2{};
+  T min = std::numeric_limits<T>::infinity();
+  T max = -std::numeric_limits<T>::infinity();
+
+  // Two passes over the numerical values of one block, which are exact enough and vectorize.
+  template<Quantity Q>
+  [[nodiscard]] static mc_moments of(std::span<const Q> samples)
+  {
+    mc_moments res;
+    res.count = samples.size();
+    T sum{};
+    for (const Q& q : samples) sum += q.numerical_value_in(Q::unit);
+    res.mean = sum / static_cast<T>(samples.size());
+    for (const Q& q : samples) {
+      const T v = q.numerical_value_in(Q::unit);
+      res.m2 += (v - res.mean) * (v - res.mean);
+      res.min = std::min(res.min, v);
+      res.max = std::max(res.max, v);
+    }
+    return res;
+  }
+
+  void merge(const mc_moments& other)
+  {
+    if (other.count == 0) return;
+    const std::size_t n = count + other.count;
+    const T delta = other.mean - mean;
+    const T weight = static_cast<T>(other.count) / static_cast<T>(n);
+    mean += delta * weight;
+    m2 += other.m2 + delta * delta * static_cast<T>(count) * weight;
+    count = n;
+    min = std::min(min, other.min);
+    max = std::max(max, other.max);
+  }
+};
+
+// Counter-based, so every block gets its own stream without any seeding or jumps.
+using mc_engine = philox4x32;
+
+// An input that always takes the same value.
+template<Quantity Q>
+struct mc_constant_input {
+  using quantity_type = Q;
+  Q value;
+
+  template<typename Generator>
+  void fill(Generator&, std::span<Q> out) const
+  {
+    std::ranges::fill(out, value);
+  }
+};
+
+// An input drawn from a distribution. Every block samples from a fresh copy, so the state some
+// distributions carry between calls never leaks from one block into another.
+template<typename D>
+struct mc_distribution_input {
+  using quantity_type = std::remove_cvref_t<decltype(std::declval<D&>()(std::declval<mc_engine&>()))>;
+  D dist;
+
+  template<typename Generator>
+  void fill(Generator& g, std::span<quantity_type> out) const
+  {
+    D d = dist;
+    generate(d, g, out);
+  }
+};
+
+template<typename T>
+concept McDistribution = requires(T& d, mc_engine& g) {
+  { d(g) } -> Quantity;
+};
+
+// An input with a normal distribution; a zero standard deviation (an exact value) is not sampled.
+template<Quantity Q>
+struct mc_normal_input {
+  using quantity_type = Q;
+  Q mean;
+  Q stddev;
+
+  template<typename Generator>
+  void fill(Generator& g, std::span<Q> out) const
+  {
+    if (stddev.numerical_value_ref_in(Q::unit) == typename Q::rep{0}) {
+      std::ranges::fill(out, mean);
+      return;
+    }
+    normal_distribution<Q> d(mean, stddev);
+    generate(d, g, out);
+  }
+};
+
+template<typename T>
+inline constexpr bool is_uncertain_quantity = false;
+
+template<auto R, typename T>
+inline constexpr bool is_uncertain_quantity<quantity<R, uncertain<T>>> = true;
+
+template<typename Input>
+concept McInput = Quantity<Input> || McDistribution<Input>;
+
+// A quantity with an `uncertain` representation is sampled from the normal distribution it
+// describes (GUM Supplement 1, 6.4.7), any other quantity is exact, and a distribution is sampled
+// as it is.
+template<McInput Input>
+[[nodiscard]] auto make_mc_input(const Input& in)
+{
+  if constexpr (is_uncertain_quantity<Input>) {
+    using Q = quantity<Input::reference, typename Input::rep::value_type>;
+    const auto& v = in.numerical_value_ref_in(Input::unit);
+    return mc_normal_input<Q>{v.value() * Input::reference, v.uncertainty() * Input::reference};
+  } else if constexpr (Quantity<Input>)
+    return mc_constant_input<Input>{in};
+  else
+    return mc_distribution_input<Input>{in};
+}
+
+// The quantity types `f` may return: `mc_result` summarizes floating-point values.
+template<typename T>
+concept McOutput = Quantity<T> && std::floating_point<typename T::rep>;
+
+// The quantity type an input is sampled as.
+template<McInput Input>
+using mc_sample_t = decltype(make_mc_input(std::declval<const Input&>()))::quantity_type;
+
+}  // namespace detail
+
+MP_UNITS_EXPORT template<Quantity Q>
+  requires std::floating_point<typename Q::rep>
+class mc_result;
+
+namespace detail {
+
+template<Quantity Out, typename Evaluate, typename... Inputs>
+mc_result<Out> run_mc(Evaluate& evaluate, const std::tuple<Inputs...>& inputs, std::size_t n_samples,
+                      const mc_policy& policy);
+
+}  // namespace detail
+
+/**
+ * @brief The result of a Monte Carlo uncertainty propagation
+ *
+ * Summarizes the distribution of the output quantity: its mean and standard deviation (also
+ * available together as an `uncertain` quantity), its extremes, and its quantiles. The quantiles
+ * come from a bounded-memory summary, which is exact while the sample count is below
+ * `mc_policy::quantile_accuracy` and otherwise has a rank error of a small multiple of
+ * `sample_count() / quantile_accuracy`.
+ *
+ * @tparam Q the type of the output quantity
+ */
+template<Quantity Q>
+  requires std::floating_point<typename Q::rep>
+class mc_result {
+  using rep = Q::rep;
+  detail::mc_moments<rep> moments_;
+  detail::quantile_sketch<rep> sketch_;
+
+  template<Quantity Out, typename Evaluate, typename... Inputs>
+  friend mc_result<Out> detail::run_mc(Evaluate& evaluate, const std::tuple<Inputs...>& inputs, std::size_t n_samples,
+                                       const mc_policy& policy);
+
+  explicit mc_result(std::size_t quantile_accuracy) : sketch_(quantile_accuracy) {}
+
+public:
+  using quantity_type = Q;
+
+  /// @brief Returns the number of samples evaluated
+  [[nodiscard]] std::size_t sample_count() const { return moments_.count; }
+
+  /// @brief Returns the sample mean
+  [[nodiscard]] Q mean() const { return moments_.mean * Q::reference; }
+
+  /// @brief Returns the sample standard deviation (with Bessel's correction)
+  [[nodiscard]] Q stddev() const
+  {
+    using std::sqrt;
+    if (moments_.count < 2) return rep{0} * Q::reference;
+    return sqrt(moments_.m2 / static_cast<rep>(moments_.count - 1)) * Q::reference;
+  }
+
+  /// @brief Returns the mean and the standard deviation as an `uncertain` quantity
+  [[nodiscard]] quantity<Q::reference, uncertain<rep>> value() const
+  {
+    return uncertain<rep>{mean().numerical_value_in(Q::unit), stddev().numerical_value_in(Q::unit)} * Q::reference;
+  }
+
+  /// @brief Returns the smallest sample
+  [[nodiscard]] Q min() const { return moments_.min * Q::reference; }
+
+  /// @brief Returns the largest sample
+  [[nodiscard]] Q max() const { return moments_.max * Q::reference; }
+
+  /**
+   * @brief Returns the `p`-quantile of the samples
+   *
+   * `quantile(0)` and `quantile(1)` are the exact extremes.
+   *
+   * @pre `0 <= p <= 1` and at least one sample was evaluated
+   */
+  [[nodiscard]] Q quantile(double p) const
+  {
+    MP_UNITS_PRECONDITION(0. <= p && p <= 1.);
+    MP_UNITS_PRECONDITION(sample_count() > 0);
+    if (p == 0.) return min();
+    if (p == 1.) return max();
+    return sketch_.quantile(p) * Q::reference;
+  }
+
+  /**
+   * @brief Returns the probabilistically symmetric coverage interval for the probability `level`
+   *
+   * The interval between the `(1 - level) / 2` and `(1 + level) / 2` quantiles (GUM Supplement 1,
+   * 7.7), e.g. the 95 % interval for `level == 0.95`.
+   */
+  [[nodiscard]] std::pair<Q, Q> coverage_interval(double level) const
+  {
+    MP_UNITS_PRECONDITION(0. <= level && level <= 1.);
+    return {quantile((1. - level) / 2.), quantile((1. + level) / 2.)};
+  }
+};
+
+namespace detail {
+
+// The stream of one block depends on the seed and the block index only, which is what keeps the
+// result independent of the number of threads.
+[[nodiscard]] inline mc_engine mc_block_engine(std::uint64_t seed, std::size_t block)
+{
+  return mc_engine(seed, static_cast<std::uint64_t>(block));
+}
+
+template<Quantity Out, typename Evaluate, typename... Inputs>
+mc_result<Out> run_mc(Evaluate& evaluate, const std::tuple<Inputs...>& inputs, std::size_t n_samples,
+                      const mc_policy& policy)
+{
+  using rep = Out::rep;
+  struct block_result {
+    std::vector<Out> samples;
+    mc_moments<rep> moments;
+    std::exception_ptr error;
+  };
+
+  const std::size_t block_size = std::max<std::size_t>(policy.block_size, 1);
+  const std::size_t blocks = (n_samples + block_size - 1) / block_size;
+  std::size_t threads = policy.threads != 0 ? policy.threads : std::thread::hardware_concurrency();
+  threads = std::clamp<std::size_t>(threads, 1, std::max<std::size_t>(blocks, 1));
+  // The blocks in flight at a time; only their samples are held, which bounds the memory.
+  const std::size_t window = threads * 4;
+  std::vector<block_result> slots(std::min(window, blocks));
+  mc_result<Out> res(policy.quantile_accuracy);
+
+  for (std::size_t first = 0; first < blocks; first += window) {
+    const std::size_t count = std::min(window, blocks - first);
+    std::atomic<std::size_t> next{0};
+    const auto worker = [&] {
+      std::tuple<std::vector<typename Inputs::quantity_type>...> buffers;
+      for (std::size_t s = next.fetch_add(1, std::memory_order_relaxed); s < count;
+           s = next.fetch_add(1, std::memory_order_relaxed)) {
+        block_result& slot = slots[s];
+        try {
+          const std::size_t block = first + s;
+          const std::size_t size = std::min(block_size, n_samples - block * block_size);
+          mc_engine gen = mc_block_engine(policy.seed, block);
+          [&]<std::size_t... Is>(std::index_sequence<Is...>) {
+            (std::get<Is>(buffers).resize(size), ...);
+            (std::get<Is>(inputs).fill(gen, std::span{std::get<Is>(buffers)}), ...);
+            slot.samples.resize(size);
+            evaluate(std::span<Out>{slot.samples},
+                     std::span<const typename Inputs::quantity_type>{std::get<Is>(buffers)}...);
+          }(std::index_sequence_for<Inputs...>{});
+          slot.moments = mc_moments<rep>::of(std::span<const Out>{slot.samples});
+        } catch (...) {
+          slot.error = std::current_exception();
+        }
+      }
+    };
+    {
+      std::vector<std::jthread> pool;
+      for (std::size_t t = 1; t < std::min(threads, count); ++t) pool.emplace_back(worker);
+      worker();
+    }
+    // merged in the block order, independently of which thread evaluated which block
+    for (std::size_t s = 0; s < count; ++s) {
+      if (slots[s].error) std::rethrow_exception(slots[s].error);
+      res.moments_.merge(slots[s].moments);
+      for (const Out& q : slots[s].samples) res.sketch_.push(q.numerical_value_in(Out::unit));
+    }
+  }
+  return res;
+}
+
+}  // namespace detail
+
+/**
+ * @brief Propagates the uncertainty of the inputs through `f` with the Monte Carlo method
+ *
+ * For non-linear models, or inputs that are not normally distributed, the first-order propagation
+ * of `uncertain` can be far off. This implements the propagation of distributions of
+ * GUM Supplement 1 instead: `n_samples` sets of input values are drawn, `f` is evaluated for each,
+ * and the distribution of the outputs is summarized in the returned `mc_result`.
+ *
+ * Each input is one of:
+ * - a quantity with an `uncertain` representation, sampled from the normal distribution with its
+ *   value as the mean and its uncertainty as the standard deviation,
+ * - a distribution from `mp-units/utility/random.h` (or any other callable with a random engine
+ *   that returns a quantity), sampled as it is,
+ * - any other quantity, taken as exact.
+ *
+ * `f` is called with one quantity per input (in the unit and representation they are sampled in)
+ * and returns a quantity with a floating-point representation, so the model stays unit-safe.
+ *
+ * The samples are generated and evaluated in blocks of `policy.block_size` on `policy.threads`
+ * threads. Only the blocks in flight are held in memory, and every block draws from its own
+ * `philox4x32` stream keyed by `(policy.seed, block index)`, so the result is reproducible and
+ * does not depend on the number of threads.
+ *
+ * @code
+ * const quantity g = uncertain{9.81, 0.02} * isq::acceleration[m / s2];
+ * const quantity t = uncertain{1.2, 0.1} * isq::duration[s];
+ * mc_result res = propagate_mc([](auto g, auto t) { return g * t * t / 2; }, std::tuple{g, t}, 1'000'000);
+ * std::println("{}, 95 % interval [{}, {}]", res.value(), res.quantile(0.025), res.quantile(0.975));
+ * @endcode
+ *
+ * @pre Exceptions thrown by `f` are rethrown from here, after the block they occurred in
+ */
+MP_UNITS_EXPORT template<typename F, detail::McInput... Inputs>
+  requires std::invocable<F&, const detail::mc_sample_t<Inputs>&...> &&
+           detail::McOutput<std::remove_cvref_t<std::invoke_result_t<F&, const detail::mc_sample_t<Inputs>&...>>>
+[[nodiscard]] auto propagate_mc(F&& f, const std::tuple<Inputs...>& inputs, std::size_t n_samples,
+                                const mc_policy& policy = {})
+{
+  const auto samplers = std::apply([](const auto&... in) { return std::tuple{detail::make_mc_input(in)...}; }, inputs);
+  using Out = std::remove_cvref_t<std::invoke_result_t<F&, const detail::mc_sample_t<Inputs>&...>>;
+  // element-wise over the sample buffers of a block, which the compiler can vectorize for a simple `f`
+  auto evaluate = [&f](std::span<Out> out, const auto&... in) {
+    for (std::size_t i = 0; i < out.size(); ++i) out[i] = std::invoke(f, in[i]...);
+  };
+  return detail::run_mc<Out>(evaluate, samplers, n_samples, policy);
+}
+
+/**
+ * @brief Propagates the uncertainty of the inputs through a batched `f` with the Monte Carlo method
+ *
+ * Like `propagate_mc()`, but `f` evaluates a whole block of samples at once: it is called as
+ * `f(out, in...)` with a `std::span<Out>` to fill and one `std::span` of samples per input, all of
+ * the same size. That lets a model run its own vectorized kernels (e.g. the batch math functions
+ * of the library) over the sample blocks.
+ *
+ * @tparam Out the type of the output quantity
+ */
+MP_UNITS_EXPORT template<detail::McOutput Out, typename F, detail::McInput... Inputs>
+  requires std::invocable<F&, std::span<Out>, std::span<const detail::mc_sample_t<Inputs>>...>
+[[nodiscard]] mc_result<Out> propagate_mc_batched(F&& f, const std::tuple<Inputs...>& inputs, std::size_t n_samples,
+                                                  const mc_policy& policy = {})
+{
+  const auto samplers = std::apply([](const auto&... in) { return std::tuple{detail::make_mc_input(in)...}; }, inputs);
+  auto evaluate = [&f](std::span<Out> out, const auto&... in) { std::invoke(f, out, in...); };
+  return detail::run_mc<Out>(evaluate, samplers, n_samples, policy);
+}
+
+}  // namespace mp_units::utility
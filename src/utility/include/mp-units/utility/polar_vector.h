@@ -25,7 +25,12 @@
 #include <mp-units/bits/requires_hosted.h>
 //
 #include <mp-units/bits/module_macros.h>
+#include <mp-units/ext/contracts.h>
+#include <mp-units/math.h>
+#include <mp-units/systems/angular/math.h>
+#include <mp-units/systems/si/math.h>
 #include <mp-units/utility/cartesian_vector.h>
+#include <mp-units/utility/vector_quantity_soa.h>
 
 #ifndef MP_UNITS_IN_MODULE_INTERFACE
 #include <mp-units/framework/quantity.h>
@@ -41,9 +46,12 @@
 #ifdef MP_UNITS_IMPORT_STD
 import std;
 #else
+#include <algorithm>
 #include <cmath>
 #include <concepts>
+#include <cstddef>
 #include <numbers>
+#include <span>
 #include <tuple>
 #include <type_traits>
 #include <utility>
@@ -207,6 +215,41 @@ template<Unit auto U, std::floating_point T>
   return {incl, wrap_azimuth(phi)};
 }
 
+// sin and cos of a stored angle with the selected accuracy of `si::sincos` or `angular::sincos`,
+// which reduce the angle in its own unit (e.g. `deg`). Angles of other registered systems use the
+// standard library in radians.
+template<Unit auto U, std::floating_point T, MathAccuracy Accuracy>
+[[nodiscard]] inline std::pair<T, T> angle_sin_cos(const quantity<U, T>& a, Accuracy acc)
+{
+  if constexpr (requires { si::sincos(a, acc); }) {
+    const auto [s, c] = si::sincos(a, acc);
+    return {s.numerical_value_in(one), c.numerical_value_in(one)};
+  } else if constexpr (requires { angular::sincos(a, acc); }) {
+    const auto [s, c] = angular::sincos(a, acc);
+    return {s.numerical_value_in(one), c.numerical_value_in(one)};
+  } else {
+    using std::cos;
+    using std::sin;
+    const T rad = angle_in_radians(a);
+    return {sin(rad), cos(rad)};
+  }
+}
+
+// The angle of the point (x, y) as a plain value in the angle unit `U`, with the selected accuracy of
+// `si::atan2` or `angular::atan2`. Angles of other registered systems use the standard library.
+template<Unit auto U, std::floating_point T, MathAccuracy Accuracy>
+[[nodiscard]] inline T angle_atan2(T y, T x, Accuracy acc)
+{
+  if constexpr (requires { si::atan2(y * one, x * one, acc).numerical_value_in(U); })
+    return si::atan2(y * one, x * one, acc).numerical_value_in(U);
+  else if constexpr (requires { angular::atan2(y * one, x * one, acc).numerical_value_in(U); })
+    return angular::atan2(y * one, x * one, acc).numerical_value_in(U);
+  else {
+    using std::atan2;
+    return radians_to_angle<U, T>(atan2(y, x)).numerical_value_in(U);
+  }
+}
+
 }  // namespace detail
 
 /// @brief A 2-D polar coordinate facade: a scalar-`quantity` radius `r` and an angle `theta` from
@@ -355,4 +398,70 @@ template<Reference auto VR, detail::VectorRepOf<2> V>
 polar_vector(quantity<VR, V>)
   -> polar_vector<detail::magnitude_reference_of<VR, V>, si::radian, std::tuple_element_t<0, V>>;
 
+namespace detail {
+
+template<typename T>
+constexpr bool is_polar_vector = false;
+
+template<auto RR, auto AU, typename Rep>
+constexpr bool is_polar_vector<polar_vector<RR, AU, Rep>> = true;
+
+}  // namespace detail
+
+/**
+ * @brief Converts all elements of a span of polar vectors to Cartesian coordinates
+ *
+ * `out[i]` is `in[i].to_cartesian()`, with the sine and the cosine of the angle computed with the
+ * selected accuracy (see `MathAccuracy`). The angle is reduced in its own unit, so degrees are not
+ * scaled to radians first, and `fast_accuracy` leaves the loop free of branches, which lets the
+ * compiler vectorize it. `out` is resized to the size of `in`, and its unit has to be convertible from
+ * the radius unit.
+ */
+MP_UNITS_EXPORT template<typename From, std::size_t N, auto ROut, typename T, MathAccuracy Accuracy = libm_accuracy_t>
+  requires detail::is_polar_vector<std::remove_const_t<From>> && std::same_as<typename From::rep, T> &&
+           requires(const From& v) { v.radius().numerical_value_in(get_unit(ROut)); }
+void to_cartesian(std::span<From, N> in, vector_quantity_soa<ROut, T, 2>& out, Accuracy acc = Accuracy{})
+{
+  const std::size_t count = in.size();
+  out.resize(count);
+  const auto c = detail::soa_data(out);
+  for (std::size_t i = 0; i < count; ++i) {
+    const T r = in[i]._r_.numerical_value_in(get_unit(ROut));
+    const auto [sin_theta, cos_theta] = detail::angle_sin_cos(in[i]._theta_, acc);
+    c[0][i] = r * cos_theta;
+    c[1][i] = r * sin_theta;
+  }
+}
+
+/**
+ * @brief Converts all elements of a container of 2-D vector quantities to polar vectors
+ *
+ * `out[i]` is `To{in[i]}`: the magnitude is computed as in `magnitude(in, out)` and the angle
+ * with the selected accuracy of `atan2` (see `MathAccuracy`) directly in the angle unit of `To`.
+ *
+ * @pre `in.size() <= out.size()`
+ */
+MP_UNITS_EXPORT template<auto R, typename T, typename To, std::size_t M, MathAccuracy Accuracy = libm_accuracy_t>
+  requires detail::is_polar_vector<To> && std::same_as<typename To::rep, T> &&
+           requires(T v) { (v * get_unit(R)).numerical_value_in(To::radius_unit); }
+void to_polar(const vector_quantity_soa<R, T, 2>& in, std::span<To, M> out, Accuracy acc = Accuracy{})
+{
+  MP_UNITS_PRECONDITION(in.size() <= out.size());
+  const std::size_t count = in.size();
+  const auto c = detail::soa_data(in);
+  for (std::size_t first = 0; first < count; first += detail::soa_block_size) {
+    const std::size_t n = std::min(detail::soa_block_size, count - first);
+    T radius[detail::soa_block_size];
+    T theta[detail::soa_block_size];
+    detail::soa_magnitudes(c, first, n, radius);
+    for (std::size_t i = 0; i < n; ++i)
+      theta[i] = detail::angle_atan2<To::angle_unit>(c[1][first + i], c[0][first + i], acc);
+    // the constructor wraps an angle of a half turn to the canonical one
+    for (std::size_t i = 0; i < n; ++i)
+      out[first + i] = To{typename To::radius_type{(radius[i] * get_unit(R)).numerical_value_in(To::radius_unit),
+                                                   To::radius_reference},
+                          typename To::angle_type{theta[i], To::angle_unit}};
+  }
+}
+
 }  // namespace mp_units::utility
@@ -27,8 +27,20 @@
 #ifndef MP_UNITS_IN_MODULE_INTERFACE
 #include <mp-units/framework/quantity.h>
 #ifndef MP_UNITS_IMPORT_STD
+#include <algorithm>
+#include <array>
+#include <atomic>
+#include <bit>
+#include <cmath>
+#include <cstddef>
+#include <cstdint>
 #include <functional>
+#include <limits>
 #include <random>
+#include <span>
+#include <thread>
+#include <type_traits>
+#include <vector>
 #endif
 #endif
 
@@ -86,6 +98,17 @@ std::vector<typename Q::rep> fw_bl_pwl(std::initializer_list<Q>& bl, UnaryOperat
   }
   return weights;
 }
+
+[[nodiscard]] constexpr std::uint64_t splitmix64(std::uint64_t& x)
+{
+  std::uint64_t z = (x += 0x9e3779b97f4a7c15);
+  z = (z ^ (z >> 30)) * 0xbf58476d1ce4e5b9;
+  z = (z ^ (z >> 27)) * 0x94d049bb133111eb;
+  return z ^ (z >> 31);
+}
+
+struct xoshiro256pp_lanes;
+
 }  // namespace detail
 
 MP_UNITS_EXPORT_BEGIN
@@ -579,6 +602,545 @@ public:
   [[nodiscard]] Q max() const { return quantity{base::max(), Q::reference}; }
 };
 
+/**
+ * @brief The xoshiro256++ pseudo-random number generator
+ *
+ * A small and fast 64-bit generator by Blackman and Vigna with a period of 2^256 - 1. It
+ * satisfies the standard uniform random bit generator requirements, so it works with every
+ * distribution in this header, and `generate()` fills spans with it in block kernels.
+ *
+ * A 64-bit seed is expanded into the 256-bit state with SplitMix64, as recommended by the
+ * authors. `jump()` and `long_jump()` advance the state by 2^128 and 2^192 steps to obtain
+ * non-overlapping sequences for parallel computations.
+ */
+class xoshiro256pp {
+public:
+  using result_type = std::uint64_t;
+  static constexpr result_type default_seed = 0x5eed;
+
+  constexpr xoshiro256pp() : xoshiro256pp(default_seed) {}
+  constexpr explicit xoshiro256pp(result_type value) { seed(value); }
+
+  template<typename Sseq>
+    requires requires(Sseq& q, std::uint32_t* it) { q.generate(it, it); }
+  explicit xoshiro256pp(Sseq& q)
+  {
+    seed(q);
+  }
+
+  constexpr void seed(result_type value = default_seed)
+  {
+    for (result_type& word : s_) word = detail::splitmix64(value);
+  }
+
+  template<typename Sseq>
+    requires requires(Sseq& q, std::uint32_t* it) { q.generate(it, it); }
+  void seed(Sseq& q)
+  {
+    std::array<std::uint32_t, 8> words{};
+    q.generate(words.begin(), words.end());
+    for (std::size_t i = 0; i < s_.size(); ++i)
+      s_[i] = (static_cast<result_type>(words[2 * i + 1]) << 32) | words[2 * i];
+    // the all-zero state is the only fixed point of the generator
+    if (s_ == std::array<result_type, 4>{}) seed();
+  }
+
+  [[nodiscard]] static constexpr result_type min() { return 0; }
+  [[nodiscard]] static constexpr result_type max() { return std::numeric_limits<result_type>::max(); }
+
+  constexpr result_type operator()()
+  {
+    const result_type result = std::rotl(s_[0] + s_[3], 23) + s_[0];
+    const result_type t = s_[1] << 17;
+    s_[2] ^= s_[0];
+    s_[3] ^= s_[1];
+    s_[1] ^= s_[2];
+    s_[0] ^= s_[3];
+    s_[2] ^= t;
+    s_[3] = std::rotl(s_[3], 45);
+    return result;
+  }
+
+  constexpr void discard(unsigned long long z)
+  {
+    for (; z != 0; --z) (void)(*this)();
+  }
+
+  /**
+   * @brief Advances the state by 2^128 steps
+   */
+  constexpr void jump()
+  {
+    apply_jump({0x180ec6d33cfd0aba, 0xd5a61266f0c9392c, 0xa9582618e03fc9aa, 0x39abdc4529b1661c});
+  }
+
+  /**
+   * @brief Advances the state by 2^192 steps
+   */
+  constexpr void long_jump()
+  {
+    apply_jump({0x76e15d3efefdcbbf, 0xc5004e441c522fb3, 0x77710069854ee241, 0x39109bb02acbe635});
+  }
+
+  [[nodiscard]] friend constexpr bool operator==(const xoshiro256pp&, const xoshiro256pp&) = default;
+
+private:
+  friend struct detail::xoshiro256pp_lanes;
+  std::array<result_type, 4> s_{};
+
+  constexpr void apply_jump(const std::array<result_type, 4>& polynomial)
+  {
+    std::array<result_type, 4> s{};
+    for (const result_type word : polynomial)
+      for (int b = 0; b < 64; ++b) {
+        if (word & (result_type{1} << b))
+          for (std::size_t i = 0; i < s.size(); ++i) s[i] ^= s_[i];
+        (void)(*this)();
+      }
+    s_ = s;
+  }
+};
+
+MP_UNITS_EXPORT_END
+
+namespace detail {
+
+inline constexpr std::size_t random_lanes = 8;
+inline constexpr std::size_t random_block = 256;
+// below this size, jumping the lanes costs more than the block kernels save
+inline constexpr std::size_t random_bulk_threshold = 8 * random_block;
+
+// `random_lanes` interleaved xoshiro256++ streams, `jump()`s apart and advanced together: the
+// independent lanes keep the pipeline busy where a single stream waits on its own state, and
+// compilers vectorize them where 64-bit vector rotates exist (e.g., AVX-512)
+struct xoshiro256pp_lanes {
+  std::array<std::uint64_t, random_lanes> s0, s1, s2, s3;
+
+  explicit xoshiro256pp_lanes(xoshiro256pp& g)
+  {
+    for (std::size_t k = 0; k < random_lanes; ++k) {
+      s0[k] = g.s_[0];
+      s1[k] = g.s_[1];
+      s2[k] = g.s_[2];
+      s3[k] = g.s_[3];
+      g.jump();
+    }
+  }
+
+  void fill(std::uint64_t (&out)[random_block])
+  {
+    std::array<std::uint64_t, random_lanes> a = s0, b = s1, c = s2, d = s3;
+    for (std::size_t step = 0; step < random_block / random_lanes; ++step)
+      for (std::size_t k = 0; k < random_lanes; ++k) {
+        out[step * random_lanes + k] = std::rotl(a[k] + d[k], 23) + a[k];
+        const std::uint64_t t = b[k] << 17;
+        c[k] ^= a[k];
+        d[k] ^= b[k];
+        b[k] ^= c[k];
+        a[k] ^= d[k];
+        c[k] ^= t;
+        d[k] = std::rotl(d[k], 45);
+      }
+    s0 = a;
+    s1 = b;
+    s2 = c;
+    s3 = d;
+  }
+};
+
+// [0, 1) and [-1, 1) from the upper 52 bits, by filling the mantissa of a double in [1, 2) or
+// [2, 4); unlike an integer conversion, this vectorizes without AVX-512
+[[nodiscard]] constexpr double unit_interval(std::uint64_t bits)
+{
+  return std::bit_cast<double>((bits >> 12) | 0x3ff0000000000000) - 1.;
+}
+
+[[nodiscard]] constexpr double symmetric_unit_interval(std::uint64_t bits)
+{
+  return std::bit_cast<double>((bits >> 12) | 0x4000000000000000) - 3.;
+}
+
+// (0, 1), safe to take the logarithm of
+[[nodiscard]] constexpr double open_unit_interval(std::uint64_t bits)
+{
+  return std::bit_cast<double>((bits >> 12) | 0x3ff0000000000001) - 1.;
+}
+
+// The 256 layers of the ziggurat of Marsaglia and Tsang: `x[i]` are the layer edges from the base
+// strip (`x[0]`) and the tail start (`x[1]`) down to the peak (`x[256] == 0`), `f[i]` the density
+// at them. The lower 8 bits of a sample pick the layer, the upper 52 bits the position in it.
+struct ziggurat_table {
+  std::array<double, 257> x;
+  std::array<double, 257> f;
+};
+
+template<typename Pdf, typename PdfInverse>
+[[nodiscard]] ziggurat_table make_ziggurat(double r, double v, Pdf pdf, PdfInverse pdf_inverse)
+{
+  ziggurat_table t{};
+  t.x[0] = v / pdf(r);
+  t.x[1] = r;
+  for (std::size_t i = 2; i < 256; ++i) t.x[i] = pdf_inverse(v / t.x[i - 1] + pdf(t.x[i - 1]));
+  t.x[256] = 0.;
+  for (std::size_t i = 0; i < t.x.size(); ++i) t.f[i] = pdf(t.x[i]);
+  return t;
+}
+
+[[nodiscard]] inline const ziggurat_table& normal_ziggurat()
+{
+  static const ziggurat_table table = make_ziggurat(
+    3.6541528853610088, 0.00492867323399, [](double x) { return std::exp(-x * x / 2); },
+    [](double y) { return std::sqrt(-2 * std::log(y)); });
+  return table;
+}
+
+[[nodiscard]] inline const ziggurat_table& exponential_ziggurat()
+{
+  static const ziggurat_table table = make_ziggurat(7.69711747013104972, 0.0039496598225815571993,
+                                                    [](double x) { return std::exp(-x); },
+                                                    [](double y) { return -std::log(y); });
+  return table;
+}
+
+// the complete sampler, starting from the 64 random `bits` that the fast path rejected
+[[nodiscard]] inline double normal_ziggurat(std::uint64_t bits, xoshiro256pp& g)
+{
+  const ziggurat_table& t = normal_ziggurat();
+  while (true) {
+    const std::size_t i = bits & 0xff;
+    const double u = symmetric_unit_interval(bits);
+    const double x = u * t.x[i];
+    if (std::abs(x) < t.x[i + 1]) return x;
+    if (i == 0) {
+      // Marsaglia's tail algorithm beyond `x[1]`
+      double tx = 0., ty = 0.;
+      do {
+        tx = std::log(open_unit_interval(g())) / t.x[1];
+        ty = std::log(open_unit_interval(g()));
+      } while (-2 * ty < tx * tx);
+      return u < 0 ? tx - t.x[1] : t.x[1] - tx;
+    }
+    if (t.f[i + 1] + (t.f[i] - t.f[i + 1]) * unit_interval(g()) < std::exp(-x * x / 2)) return x;
+    bits = g();
+  }
+}
+
+[[nodiscard]] inline double exponential_ziggurat(std::uint64_t bits, xoshiro256pp& g)
+{
+  const ziggurat_table& t = exponential_ziggurat();
+  while (true) {
+    const std::size_t i = bits & 0xff;
+    const double x = unit_interval(bits) * t.x[i];
+    if (x < t.x[i + 1]) return x;
+    // the tail of an exponential distribution is the same distribution shifted by `x[1]`
+    if (i == 0) return t.x[1] - std::log(open_unit_interval(g()));
+    if (t.f[i + 1] + (t.f[i] - t.f[i + 1]) * unit_interval(g()) < std::exp(-x)) return x;
+    bits = g();
+  }
+}
+
+// One block of standard samples: a branch-free pass accepts the ~99 % of the samples that fall
+// inside their layer, then the rest are redrawn with the complete sampler.
+template<bool Symmetric>
+void ziggurat_block(const ziggurat_table& t, xoshiro256pp_lanes& lanes, xoshiro256pp& g,
+                    double (&z)[random_block])
+{
+  std::uint64_t bits[random_block];
+  lanes.fill(bits);
+  bool inside[random_block];
+  for (std::size_t j = 0; j < random_block; ++j) {
+    const std::size_t i = bits[j] & 0xff;
+    const double x = (Symmetric ? symmetric_unit_interval(bits[j]) : unit_interval(bits[j])) * t.x[i];
+    z[j] = x;
+    inside[j] = std::abs(x) < t.x[i + 1];
+  }
+  for (std::size_t j = 0; j < random_block; ++j)
+    if (!inside[j]) [[unlikely]]
+      z[j] = Symmetric ? normal_ziggurat(bits[j], g) : exponential_ziggurat(bits[j], g);
+}
+
+// Fills `out` with `transform(z)` of standard samples `z` produced by `block` (or by `scalar` for
+// short spans)
+template<Quantity Q, typename Block, typename Scalar, typename Transform>
+void generate_bulk_impl(xoshiro256pp& g, std::span<Q> out, Block block, Scalar scalar, Transform transform)
+{
+  using rep = Q::rep;
+  if (out.size() < random_bulk_threshold) {
+    for (Q& q : out) q = quantity{static_cast<rep>(transform(scalar(g))), Q::reference};
+    return;
+  }
+  xoshiro256pp_lanes lanes(g);
+  double z[random_block];
+  for (std::size_t offset = 0; offset < out.size(); offset += random_block) {
+    block(lanes, g, z);
+    const std::size_t count = std::min(random_block, out.size() - offset);
+    Q* const dst = out.data() + offset;
+    for (std::size_t j = 0; j < count; ++j) dst[j] = quantity{static_cast<rep>(transform(z[j])), Q::reference};
+  }
+}
+
+template<Quantity Q>
+void generate_bulk(uniform_real_distribution<Q>& dist, xoshiro256pp& g, std::span<Q> out)
+{
+  const double a = dist.base::a();
+  const double width = dist.base::b() - a;
+  generate_bulk_impl(
+    g, out,
+    [](xoshiro256pp_lanes& lanes, xoshiro256pp&, double (&z)[random_block]) {
+      std::uint64_t bits[random_block];
+      lanes.fill(bits);
+      for (std::size_t j = 0; j < random_block; ++j) z[j] = unit_interval(bits[j]);
+    },
+    [](xoshiro256pp& gen) { return unit_interval(gen()); }, [=](double u) { return a + width * u; });
+}
+
+template<Quantity Q>
+void generate_bulk(normal_distribution<Q>& dist, xoshiro256pp& g, std::span<Q> out)
+{
+  const double mean = dist.base::mean();
+  const double stddev = dist.base::stddev();
+  generate_bulk_impl(
+    g, out,
+    [&t = normal_ziggurat()](xoshiro256pp_lanes& lanes, xoshiro256pp& gen, double (&z)[random_block]) {
+      ziggurat_block<true>(t, lanes, gen, z);
+    },
+    [](xoshiro256pp& gen) { return normal_ziggurat(gen(), gen); }, [=](double z) { return mean + stddev * z; });
+}
+
+template<Quantity Q>
+void generate_bulk(exponential_distribution<Q>& dist, xoshiro256pp& g, std::span<Q> out)
+{
+  const double scale = 1. / dist.lambda();
+  generate_bulk_impl(
+    g, out,
+    [&t = exponential_ziggurat()](xoshiro256pp_lanes& lanes, xoshiro256pp& gen, double (&z)[random_block]) {
+      ziggurat_block<false>(t, lanes, gen, z);
+    },
+    [](xoshiro256pp& gen) { return exponential_ziggurat(gen(), gen); }, [=](double z) { return scale * z; });
+}
+
+}  // namespace detail
+
+/**
+ * @brief Fills `out` with samples of the distribution
+ *
+ * Equivalent to assigning `dist(g)` to every element of `out`. With `xoshiro256pp`, the
+ * `uniform_real_distribution`, `normal_distribution`, and `exponential_distribution` are instead
+ * sampled in blocks by branch-free, vectorizable kernels: long spans are drawn from `jump()`ed
+ * interleaved streams, and the normal and exponential samples come from a 256-layer ziggurat.
+ * Those samples follow the same distribution but are a different sequence than the one of the
+ * repeated `dist(g)` calls.
+ *
+ * @param dist the distribution to sample
+ * @param g the uniform random bit generator to use
+ * @param out the quantities to overwrite
+ */
+MP_UNITS_EXPORT template<typename Distribution, typename Generator>
+  requires Quantity<std::invoke_result_t<Distribution&, Generator&>>
+void generate(Distribution& dist, Generator& g, std::span<std::invoke_result_t<Distribution&, Generator&>> out)
+{
+  if constexpr (std::same_as<Generator, xoshiro256pp> && requires { detail::generate_bulk(dist, g, out); })
+    detail::generate_bulk(dist, g, out);
+  else
+    for (auto& q : out) q = dist(g);
+}
+
+namespace detail {
+
+// The Philox4x32-10 and Threefry4x64-20 bijections of Salmon et al., "Parallel random numbers: as
+// easy as 1, 2, 3" (SC '11), mapping a 64-bit seed and a 128-bit counter made of the stream id and
+// the block counter to one block of random words.
+struct philox4x32_bijection {
+  using word = std::uint32_t;
+  using block = std::array<word, 4>;
+
+  [[nodiscard]] static constexpr block encrypt(std::uint64_t seed, std::uint64_t stream, std::uint64_t counter)
+  {
+    block c{static_cast<word>(counter), static_cast<word>(counter >> 32), static_cast<word>(stream),
+            static_cast<word>(stream >> 32)};
+    word k0 = static_cast<word>(seed);
+    word k1 = static_cast<word>(seed >> 32);
+    for (int round = 0; round < 10; ++round) {
+      const std::uint64_t p0 = std::uint64_t{0xd2511f53} * c[0];
+      const std::uint64_t p1 = std::uint64_t{0xcd9e8d57} * c[2];
+      c = {static_cast<word>(p1 >> 32) ^ c[1] ^ k0, static_cast<word>(p1), static_cast<word>(p0 >> 32) ^ c[3] ^ k1,
+           static_cast<word>(p0)};
+      k0 += 0x9e3779b9;
+      k1 += 0xbb67ae85;
+    }
+    return c;
+  }
+};
+
+struct threefry4x64_bijection {
+  using word = std::uint64_t;
+  using block = std::array<word, 4>;
+
+  [[nodiscard]] static constexpr block encrypt(std::uint64_t seed, std::uint64_t stream, std::uint64_t counter)
+  {
+    constexpr int rotations[8][2] = {{14, 16}, {52, 57}, {23, 40}, {5, 37}, {25, 33}, {46, 12}, {58, 22}, {32, 32}};
+    const std::array<word, 5> ks{seed, 0, 0, 0, 0x1bd11bdaa9fc1a22 ^ seed};
+    block x{counter + ks[0], stream, 0, 0};
+    for (int round = 0; round < 20; ++round) {
+      const auto [r0, r1] = rotations[round % 8];
+      if (round % 2 == 0) {
+        x[0] += x[1];
+        x[1] = std::rotl(x[1], r0) ^ x[0];
+        x[2] += x[3];
+        x[3] = std::rotl(x[3], r1) ^ x[2];
+      } else {
+        x[0] += x[3];
+        x[3] = std::rotl(x[3], r0) ^ x[0];
+        x[2] += x[1];
+        x[1] = std::rotl(x[1], r1) ^ x[2];
+      }
+      if (round % 4 == 3) {
+        const auto s = static_cast<std::size_t>(round + 1) / 4;
+        for (std::size_t i = 0; i < x.size(); ++i) x[i] += ks[(s + i) % ks.size()];
+        x[3] += s;
+      }
+    }
+    return x;
+  }
+};
+
+// the counter range of every chunk of `parallel_generate()`
+inline constexpr std::size_t parallel_generate_chunk = 8192;
+inline constexpr int parallel_generate_chunk_counter_bits = 32;
+
+}  // namespace detail
+
+MP_UNITS_EXPORT_BEGIN
+
+/**
+ * @brief A counter-based pseudo-random number generator
+ *
+ * The `n`-th block of random words of the sequence is `Bijection::encrypt(seed, stream, n)`, so
+ * the generator has no state to evolve: every `(seed, stream)` pair selects an independent
+ * sequence of 2^64 blocks without any jumps, and `discard()` is O(1). Parallel computations can
+ * thus give each task its own stream (or counter range) and produce the same numbers regardless
+ * of how the tasks are scheduled.
+ *
+ * It satisfies the standard uniform random bit generator requirements, so it works with every
+ * distribution in this header.
+ *
+ * @tparam Bijection the keyed block function (see `philox4x32` and `threefry4x64`)
+ */
+template<typename Bijection>
+class counter_based_engine {
+public:
+  using result_type = Bijection::word;
+  static constexpr std::uint64_t default_seed = 0x5eed;
+
+  constexpr counter_based_engine() : counter_based_engine(default_seed) {}
+  constexpr explicit counter_based_engine(std::uint64_t seed, std::uint64_t stream = 0, std::uint64_t counter = 0) :
+      seed_(seed), stream_(stream), counter_(counter)
+  {
+  }
+
+  [[nodiscard]] static constexpr result_type min() { return 0; }
+  [[nodiscard]] static constexpr result_type max() { return std::numeric_limits<result_type>::max(); }
+
+  [[nodiscard]] constexpr std::uint64_t seed() const { return seed_; }
+  [[nodiscard]] constexpr std::uint64_t stream() const { return stream_; }
+
+  /**
+   * @brief The first block of which no result was used yet
+   */
+  [[nodiscard]] constexpr std::uint64_t counter() const { return index_ == 0 ? counter_ : counter_ + 1; }
+  constexpr void set_counter(std::uint64_t counter)
+  {
+    counter_ = counter;
+    index_ = 0;
+  }
+
+  constexpr result_type operator()()
+  {
+    if (index_ == 0) block_ = Bijection::encrypt(seed_, stream_, counter_);
+    const result_type result = block_[index_];
+    if (++index_ == block_.size()) {
+      index_ = 0;
+      ++counter_;
+    }
+    return result;
+  }
+
+  constexpr void discard(unsigned long long z)
+  {
+    constexpr std::size_t words = std::tuple_size_v<block>;
+    const unsigned long long position = index_ + z % words;
+    counter_ += z / words + position / words;
+    index_ = static_cast<std::size_t>(position % words);
+    if (index_ != 0) block_ = Bijection::encrypt(seed_, stream_, counter_);
+  }
+
+  [[nodiscard]] friend constexpr bool operator==(const counter_based_engine& lhs, const counter_based_engine& rhs)
+  {
+    return lhs.seed_ == rhs.seed_ && lhs.stream_ == rhs.stream_ && lhs.counter_ == rhs.counter_ &&
+           lhs.index_ == rhs.index_;
+  }
+
+private:
+  using block = Bijection::block;
+  std::uint64_t seed_;
+  std::uint64_t stream_;
+  std::uint64_t counter_;
+  std::size_t index_ = 0;
+  block block_{};
+};
+
+/**
+ * @brief The Philox4x32-10 counter-based generator with 32-bit results
+ */
+using philox4x32 = counter_based_engine<detail::philox4x32_bijection>;
+
+/**
+ * @brief The Threefry4x64-20 counter-based generator with 64-bit results
+ */
+using threefry4x64 = counter_based_engine<detail::threefry4x64_bijection>;
+
+/**
+ * @brief Fills `out` with samples of the distribution on many threads, reproducibly
+ *
+ * `out` is split into fixed-size chunks independently of the number of threads. Chunk `c` is
+ * filled by `generate()` with a copy of `dist` and a generator with the seed and stream of `g`
+ * whose counter starts `c · 2^32` blocks after the counter of `g`, so the result is identical
+ * for any `threads`. On return, `g` is advanced past the counters of all the chunks.
+ *
+ * @param dist the distribution to sample; it is copied for every chunk
+ * @param g the counter-based generator defining the random sequence
+ * @param out the quantities to overwrite
+ * @param threads the number of threads to use; `0` uses all the hardware threads
+ */
+template<typename Distribution, typename Bijection>
+  requires Quantity<std::invoke_result_t<Distribution&, counter_based_engine<Bijection>&>> &&
+           std::copy_constructible<Distribution>
+void parallel_generate(const Distribution& dist, counter_based_engine<Bijection>& g,
+                       std::span<std::invoke_result_t<Distribution&, counter_based_engine<Bijection>&>> out,
+                       std::size_t threads = 0)
+{
+  constexpr std::size_t chunk_size = detail::parallel_generate_chunk;
+  const std::size_t chunks = (out.size() + chunk_size - 1) / chunk_size;
+  const std::uint64_t base = g.counter();
+  std::atomic<std::size_t> next{0};
+  const auto worker = [&] {
+    for (std::size_t c = next.fetch_add(1, std::memory_order_relaxed); c < chunks;
+         c = next.fetch_add(1, std::memory_order_relaxed)) {
+      Distribution d = dist;
+      counter_based_engine<Bijection> gen(
+        g.seed(), g.stream(), base + (std::uint64_t{c} << detail::parallel_generate_chunk_counter_bits));
+      generate(d, gen, out.subspan(c * chunk_size, std::min(chunk_size, out.size() - c * chunk_size)));
+    }
+  };
+  if (threads == 0) threads = std::thread::hardware_concurrency();
+  {
+    std::vector<std::jthread> pool;
+    for (std::size_t t = 1; t < std::min(threads, chunks); ++t) pool.emplace_back(worker);
+    worker();
+  }
+  g.set_counter(base + (std::uint64_t{chunks} << detail::parallel_generate_chunk_counter_bits));
+}
+
 MP_UNITS_EXPORT_END
 
 }  // namespace mp_units::utility
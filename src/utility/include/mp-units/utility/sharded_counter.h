@@ -0,0 +1,162 @@
+// The MIT License (MIT)
+//
+// Copyright (c) 2018 Mateusz Pusz
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+
+
+#pragma once
+
+#include <mp-units/bits/requires_hosted.h>
+//
+#include <mp-units/bits/module_macros.h>
+
+#ifndef MP_UNITS_IN_MODULE_INTERFACE
+#include <mp-units/framework/quantity.h>
+#include <mp-units/framework/quantity_concepts.h>
+#ifdef MP_UNITS_IMPORT_STD
+import std;
+#else
+#include <algorithm>
+#include <atomic>
+#include <bit>
+#include <cstddef>
+#include <thread>
+#include <vector>
+#endif
+#endif
+
+namespace mp_units::utility {
+
+namespace detail {
+
+// 64 bytes is the destructive interference size of mainstream x86-64 and AArch64 cores.
+// `std::hardware_destructive_interference_size` is not used because GCC warns that its value
+// depends on the tuning flags, which would make the layout differ between translation units.
+inline constexpr std::size_t cache_line_size = 64;
+
+// A small process-wide ordinal assigned to each thread the first time it touches a sharded
+// counter. Consecutive threads get consecutive ordinals, so up to `shard_count()` threads
+// always land on distinct shards.
+[[nodiscard]] inline std::size_t this_thread_ordinal() noexcept
+{
+  static std::atomic<std::size_t> next{0};
+  thread_local const std::size_t ordinal = next.fetch_add(1, std::memory_order_relaxed);
+  return ordinal;
+}
+
+}  // namespace detail
+
+/**
+ * @brief A quantity counter that scales under heavy write contention
+ *
+ * A single `std::atomic<quantity<...>>` updated from many threads makes the cache line holding it
+ * bounce between cores on every increment. `sharded_counter` splits the count into cache-line-padded
+ * shards, and each thread updates only its own shard, so increments do not contend. `read()` sums
+ * all the shards into a single quantity.
+ *
+ * Increments are `relaxed` atomic operations. `read()` is therefore not a linearizable snapshot
+ * while writers are active; it returns an exact total once the writers have finished (e.g. after
+ * they were joined).
+ *
+ * @code
+ * sharded_counter<quantity<iec::byte, std::uint64_t>> bytes_sent;
+ * bytes_sent += std::uint64_t{4} * KiB;  // from any thread
+ * quantity total = bytes_sent.read();    // quantity<iec::byte, std::uint64_t>
+ * @endcode
+ *
+ * @tparam Q the quantity type being counted; its representation must be an arithmetic type
+ */
+MP_UNITS_EXPORT template<Quantity Q>
+  requires mp_units::detail::AtomicArithmeticRep<typename Q::rep>
+class sharded_counter {
+  struct alignas(detail::cache_line_size) shard {
+    std::atomic<Q> value{};
+  };
+
+public:
+  using value_type = Q;
+
+  /**
+   * @brief The default number of shards
+   *
+   * The number of hardware threads rounded up to a power of two.
+   */
+  [[nodiscard]] static std::size_t default_shard_count() noexcept
+  {
+    return std::bit_ceil(std::max<std::size_t>(std::thread::hardware_concurrency(), 1));
+  }
+
+  /**
+   * @brief Creates a zero-initialized counter
+   *
+   * @param shard_count the number of shards; rounded up to a power of two
+   */
+  explicit sharded_counter(std::size_t shard_count = default_shard_count()) :
+      shards_(std::bit_ceil(std::max<std::size_t>(shard_count, 1)))
+  {
+  }
+
+  sharded_counter(const sharded_counter&) = delete;
+  sharded_counter& operator=(const sharded_counter&) = delete;
+
+  [[nodiscard]] std::size_t shard_count() const noexcept { return shards_.size(); }
+
+  void add(value_type q) noexcept { local().value.fetch_add(q, std::memory_order_relaxed); }
+  void sub(value_type q) noexcept { local().value.fetch_sub(q, std::memory_order_relaxed); }
+
+  sharded_counter& operator+=(value_type q) noexcept
+  {
+    add(q);
+    return *this;
+  }
+
+  sharded_counter& operator-=(value_type q) noexcept
+  {
+    sub(q);
+    return *this;
+  }
+
+  /**
+   * @brief Aggregates all the shards into a single quantity
+   */
+  [[nodiscard]] value_type read() const noexcept
+  {
+    value_type total = value_type::zero();
+    for (const shard& s : shards_) total += s.value.load(std::memory_order_relaxed);
+    return total;
+  }
+
+  /**
+   * @brief Resets the counter to zero
+   *
+   * Increments that race with the reset may survive it.
+   */
+  void reset() noexcept
+  {
+    for (shard& s : shards_) s.value.store(value_type::zero(), std::memory_order_relaxed);
+  }
+
+private:
+  std::vector<shard> shards_;
+
+  [[nodiscard]] shard& local() noexcept { return shards_[detail::this_thread_ordinal() & (shards_.size() - 1)]; }
+};
+
+}  // namespace mp_units::utility
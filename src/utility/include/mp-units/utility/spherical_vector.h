@@ -26,7 +26,10 @@
 //
 #include <mp-units/bits/module_macros.h>
 #include <mp-units/utility/cartesian_vector.h>
+#include <mp-units/ext/contracts.h>
+#include <mp-units/math.h>
 #include <mp-units/utility/polar_vector.h>  // shared angle helpers + the AngleUnit/RadialUnit concepts and radian_of
+#include <mp-units/utility/vector_quantity_soa.h>
 
 #ifndef MP_UNITS_IN_MODULE_INTERFACE
 #include <mp-units/framework/quantity.h>
@@ -35,8 +38,11 @@
 #ifdef MP_UNITS_IMPORT_STD
 import std;
 #else
+#include <algorithm>
 #include <cmath>
 #include <concepts>
+#include <cstddef>
+#include <span>
 #if MP_UNITS_HOSTED
 #include <iosfwd>
 #endif
@@ -211,4 +217,82 @@ template<Reference auto VR, detail::VectorRepOf<3> V>
 spherical_vector(quantity<VR, V>)
   -> spherical_vector<detail::magnitude_reference_of<VR, V>, si::radian, std::tuple_element_t<0, V>>;
 
+namespace detail {
+
+template<typename T>
+constexpr bool is_spherical_vector = false;
+
+template<auto RR, auto AU, typename Rep>
+constexpr bool is_spherical_vector<spherical_vector<RR, AU, Rep>> = true;
+
+}  // namespace detail
+
+/**
+ * @brief Converts all elements of a span of spherical vectors to Cartesian coordinates
+ *
+ * `out[i]` is `in[i].to_cartesian()`, with the sines and the cosines of the angles computed with the
+ * selected accuracy (see `MathAccuracy`). The angles are reduced in their own unit, so degrees are not
+ * scaled to radians first, and `fast_accuracy` leaves the loop free of branches, which lets the
+ * compiler vectorize it. `out` is resized to the size of `in`, and its unit has to be convertible from
+ * the radius unit.
+ */
+MP_UNITS_EXPORT template<typename From, std::size_t N, auto ROut, typename T, MathAccuracy Accuracy = libm_accuracy_t>
+  requires detail::is_spherical_vector<std::remove_const_t<From>> && std::same_as<typename From::rep, T> &&
+           requires(const From& v) { v.radius().numerical_value_in(get_unit(ROut)); }
+void to_cartesian(std::span<From, N> in, vector_quantity_soa<ROut, T, 3>& out, Accuracy acc = Accuracy{})
+{
+  const std::size_t count = in.size();
+  out.resize(count);
+  const auto c = detail::soa_data(out);
+  for (std::size_t i = 0; i < count; ++i) {
+    const T r = in[i]._r_.numerical_value_in(get_unit(ROut));
+    const auto [sin_theta, cos_theta] = detail::angle_sin_cos(in[i]._theta_, acc);
+    const auto [sin_phi, cos_phi] = detail::angle_sin_cos(in[i]._phi_, acc);
+    c[0][i] = r * sin_theta * cos_phi;
+    c[1][i] = r * sin_theta * sin_phi;
+    c[2][i] = r * cos_theta;
+  }
+}
+
+/**
+ * @brief Converts all elements of a container of 3-D vector quantities to spherical vectors
+ *
+ * `out[i]` is `To{in[i]}`: the magnitude is computed as in `magnitude(in, out)`, and the angles
+ * with the selected accuracy of `atan2` (see `MathAccuracy`) directly in the angle unit of `To`. The
+ * inclination is `atan2(hypot(x, y), z)`, which stays accurate near the poles where `acos(z / r)`
+ * does not.
+ *
+ * @pre `in.size() <= out.size()`
+ */
+MP_UNITS_EXPORT template<auto R, typename T, typename To, std::size_t M, MathAccuracy Accuracy = libm_accuracy_t>
+  requires detail::is_spherical_vector<To> && std::same_as<typename To::rep, T> &&
+           requires(T v) { (v * get_unit(R)).numerical_value_in(To::radius_unit); }
+void to_spherical(const vector_quantity_soa<R, T, 3>& in, std::span<To, M> out, Accuracy acc = Accuracy{})
+{
+  MP_UNITS_PRECONDITION(in.size() <= out.size());
+  const std::size_t count = in.size();
+  const auto c = detail::soa_data(in);
+  for (std::size_t first = 0; first < count; first += detail::soa_block_size) {
+    const std::size_t n = std::min(detail::soa_block_size, count - first);
+    T radius[detail::soa_block_size];
+    T theta[detail::soa_block_size];
+    T phi[detail::soa_block_size];
+    detail::soa_magnitudes(c, first, n, radius);
+    for (std::size_t i = 0; i < n; ++i) {
+      const T x = c[0][first + i];
+      const T y = c[1][first + i];
+      const T rho = hypot(x * one, y * one, acc).numerical_value_in(one);
+      theta[i] = detail::angle_atan2<To::angle_unit>(rho, c[2][first + i], acc);
+      phi[i] = detail::angle_atan2<To::angle_unit>(y, x, acc);
+    }
+    // the constructor canonicalizes the angles; the direction of a zero vector is undefined, and its
+    // inclination is zero as in the constructor from a vector quantity (`atan2(0, -0)` would be a half turn)
+    for (std::size_t i = 0; i < n; ++i)
+      out[first + i] = To{typename To::radius_type{(radius[i] * get_unit(R)).numerical_value_in(To::radius_unit),
+                                                   To::radius_reference},
+                          typename To::angle_type{radius[i] != T{0} ? theta[i] : T{0}, To::angle_unit},
+                          typename To::angle_type{phi[i], To::angle_unit}};
+  }
+}
+
 }  // namespace mp_units::utility
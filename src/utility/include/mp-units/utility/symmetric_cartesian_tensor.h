@@ -0,0 +1,525 @@
+// The MIT License (MIT)
+//
+// Copyright (c) 2018 Mateusz Pusz
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+
+#pragma once
+
+#include <mp-units/bits/requires_hosted.h>
+//
+#include <mp-units/bits/module_macros.h>
+#include <mp-units/utility/cartesian_tensor.h>
+#include <mp-units/utility/diagonal_cartesian_tensor.h>
+
+#ifndef MP_UNITS_IN_MODULE_INTERFACE
+#include <mp-units/framework/customization_points.h>
+#include <mp-units/framework/representation_concepts.h>
+#if MP_UNITS_HOSTED
+#include <mp-units/ext/format.h>
+#endif
+#ifdef MP_UNITS_IMPORT_STD
+import std;
+#else
+#include <cmath>
+#include <cstddef>
+#include <type_traits>
+#include <utility>
+#if MP_UNITS_HOSTED
+#include <iosfwd>
+#endif
+#endif
+#endif
+
+namespace mp_units::utility {
+
+MP_UNITS_EXPORT template<Scalar T, std::size_t N>
+  requires(N == 2 || N == 3)
+class symmetric_cartesian_tensor;
+
+namespace detail {
+
+// The number of distinct components of a symmetric N×N tensor
+template<std::size_t N>
+inline constexpr std::size_t symmetric_components = N * (N + 1) / 2;
+
+// The position of the component (row, col) in the Voigt order used for the storage: the diagonal
+// first, then `yz, xz, xy` in 3D (`xy` in 2D), so `6 - row - col` for an off-diagonal one in 3D.
+template<std::size_t N>
+[[nodiscard]] constexpr std::size_t voigt_index(std::size_t row, std::size_t col)
+{
+  if (row == col) return row;
+  if constexpr (N == 2)
+    return 2;
+  else
+    return 6 - row - col;
+}
+
+template<typename F, std::size_t... Is>
+[[nodiscard]] constexpr auto symmetric_cartesian_tensor_from(std::index_sequence<Is...>, F&& f)
+{
+  return symmetric_cartesian_tensor{f(Is)...};
+}
+
+// The operations of a `symmetric_cartesian_tensor`, including the mixed ones with the dense and the
+// diagonal tensors and with a `cartesian_vector`, as hidden friends (see `cartesian_tensor_iface`).
+// The element-wise operations and the scalar product run over the N(N+1)/2 stored components only;
+// the latter counts each off-diagonal product twice instead of computing it twice.
+struct symmetric_cartesian_tensor_iface {
+  template<typename T, std::size_t N, typename U>
+    requires requires(const T& t, const U& u) { t + u; }
+  [[nodiscard]] friend constexpr auto operator+(const symmetric_cartesian_tensor<T, N>& lhs,
+                                                const symmetric_cartesian_tensor<U, N>& rhs)
+  {
+    return ::mp_units::utility::detail::symmetric_cartesian_tensor_from(
+      std::make_index_sequence<symmetric_components<N>>{},
+      [&](std::size_t i) { return lhs._data_[i] + rhs._data_[i]; });
+  }
+
+  template<typename T, std::size_t N, typename U>
+    requires requires(const T& t, const U& u) { t - u; }
+  [[nodiscard]] friend constexpr auto operator-(const symmetric_cartesian_tensor<T, N>& lhs,
+                                                const symmetric_cartesian_tensor<U, N>& rhs)
+  {
+    return ::mp_units::utility::detail::symmetric_cartesian_tensor_from(
+      std::make_index_sequence<symmetric_components<N>>{},
+      [&](std::size_t i) { return lhs._data_[i] - rhs._data_[i]; });
+  }
+
+  // see `cartesian_tensor_iface` for why a `Reference` or a `Quantity` operand is excluded
+  template<typename T, std::size_t N, typename U>
+    requires(!Reference<U>) && (!Quantity<U>) && requires(const T& t, const U& u) { t * u; }
+  [[nodiscard]] friend constexpr auto operator*(const symmetric_cartesian_tensor<T, N>& lhs, const U& rhs)
+  {
+    return ::mp_units::utility::detail::symmetric_cartesian_tensor_from(
+      std::make_index_sequence<symmetric_components<N>>{}, [&](std::size_t i) { return lhs._data_[i] * rhs; });
+  }
+
+  template<typename T, std::size_t N, typename U>
+    requires(!Reference<T>) && (!Quantity<T>) && requires(const T& t, const U& u) { t * u; }
+  [[nodiscard]] friend constexpr auto operator*(const T& lhs, const symmetric_cartesian_tensor<U, N>& rhs)
+  {
+    return rhs * lhs;
+  }
+
+  template<typename T, std::size_t N, typename U>
+    requires(!Reference<U>) && (!Quantity<U>) && requires(const T& t, const U& u) { t / u; }
+  [[nodiscard]] friend constexpr auto operator/(const symmetric_cartesian_tensor<T, N>& lhs, const U& rhs)
+  {
+    return ::mp_units::utility::detail::symmetric_cartesian_tensor_from(
+      std::make_index_sequence<symmetric_components<N>>{}, [&](std::size_t i) { return lhs._data_[i] / rhs; });
+  }
+
+  template<typename T, std::size_t N, std::equality_comparable_with<T> U>
+  [[nodiscard]] friend constexpr bool operator==(const symmetric_cartesian_tensor<T, N>& lhs,
+                                                 const symmetric_cartesian_tensor<U, N>& rhs)
+  {
+    for (std::size_t i = 0; i < symmetric_components<N>; ++i)
+      if (!(lhs._data_[i] == rhs._data_[i])) return false;
+    return true;
+  }
+
+  // inner product with a vector (ISO 80000-2:2019, 2-18.24): (S ⋅ a)_i = sum_j S_ij a_j
+  template<typename T, std::size_t N, typename U>
+    requires requires(const T& t, const U& u, decltype(t * u) v) {
+      t * u;
+      v + v;
+    }
+  [[nodiscard]] friend constexpr auto inner_product(const symmetric_cartesian_tensor<T, N>& lhs,
+                                                    const cartesian_vector<U, N>& rhs)
+  {
+    return ::mp_units::utility::detail::cartesian_vector_from(std::make_index_sequence<N>{}, [&](std::size_t i) {
+      auto acc = lhs(i, 0) * rhs[0];
+      for (std::size_t j = 1; j < N; ++j) acc = acc + lhs(i, j) * rhs[j];
+      return acc;
+    });
+  }
+
+  // Inner products with another tensor (ISO 80000-2:2019, 2-18.23). The product of two symmetric
+  // tensors is not symmetric in general, so all of them yield a dense `cartesian_tensor`; a diagonal
+  // operand scales the rows (on the left) or the columns (on the right) of the symmetric one.
+  template<typename T, std::size_t N, typename U>
+    requires requires(const T& t, const U& u, decltype(t * u) v) {
+      t * u;
+      v + v;
+    }
+  [[nodiscard]] friend constexpr auto inner_product(const symmetric_cartesian_tensor<T, N>& lhs,
+                                                    const symmetric_cartesian_tensor<U, N>& rhs)
+  {
+    return ::mp_units::utility::detail::cartesian_tensor_from(std::make_index_sequence<N * N>{}, [&](std::size_t idx) {
+      const std::size_t i = idx / N, k = idx % N;
+      auto acc = lhs(i, 0) * rhs(0, k);
+      for (std::size_t j = 1; j < N; ++j) acc = acc + lhs(i, j) * rhs(j, k);
+      return acc;
+    });
+  }
+
+  template<typename T, std::size_t N, typename U>
+    requires requires(const T& t, const U& u, decltype(t * u) v) {
+      t * u;
+      v + v;
+    }
+  [[nodiscard]] friend constexpr auto inner_product(const symmetric_cartesian_tensor<T, N>& lhs,
+                                                    const cartesian_tensor<U, N>& rhs)
+  {
+    return ::mp_units::utility::detail::cartesian_tensor_from(std::make_index_sequence<N * N>{}, [&](std::size_t idx) {
+      const std::size_t i = idx / N, k = idx % N;
+      auto acc = lhs(i, 0) * rhs(0, k);
+      for (std::size_t j = 1; j < N; ++j) acc = acc + lhs(i, j) * rhs(j, k);
+      return acc;
+    });
+  }
+
+  template<typename T, std::size_t N, typename U>
+    requires requires(const T& t, const U& u, decltype(t * u) v) {
+      t * u;
+      v + v;
+    }
+  [[nodiscard]] friend constexpr auto inner_product(const cartesian_tensor<T, N>& lhs,
+                                                    const symmetric_cartesian_tensor<U, N>& rhs)
+  {
+    return ::mp_units::utility::detail::cartesian_tensor_from(std::make_index_sequence<N * N>{}, [&](std::size_t idx) {
+      const std::size_t i = idx / N, k = idx % N;
+      auto acc = lhs(i, 0) * rhs(0, k);
+      for (std::size_t j = 1; j < N; ++j) acc = acc + lhs(i, j) * rhs(j, k);
+      return acc;
+    });
+  }
+
+  template<typename T, std::size_t N, typename U>
+    requires requires(const T& t, const U& u) { t * u; }
+  [[nodiscard]] friend constexpr auto inner_product(const symmetric_cartesian_tensor<T, N>& lhs,
+                                                    const diagonal_cartesian_tensor<U, N>& rhs)
+  {
+    return ::mp_units::utility::detail::cartesian_tensor_from(
+      std::make_index_sequence<N * N>{}, [&](std::size_t idx) { return lhs(idx / N, idx % N) * rhs._data_[idx % N]; });
+  }
+
+  template<typename T, std::size_t N, typename U>
+    requires requires(const T& t, const U& u) { t * u; }
+  [[nodiscard]] friend constexpr auto inner_product(const diagonal_cartesian_tensor<T, N>& lhs,
+                                                    const symmetric_cartesian_tensor<U, N>& rhs)
+  {
+    return ::mp_units::utility::detail::cartesian_tensor_from(
+      std::make_index_sequence<N * N>{}, [&](std::size_t idx) { return lhs._data_[idx / N] * rhs(idx / N, idx % N); });
+  }
+
+  // scalar (double-dot) products (ISO 80000-2:2019, 2-18.25)
+  template<typename T, std::size_t N, typename U>
+    requires requires(const T& t, const U& u, decltype(t * u) v) {
+      t * u;
+      v + v;
+    }
+  [[nodiscard]] friend constexpr auto scalar_product(const symmetric_cartesian_tensor<T, N>& lhs,
+                                                     const symmetric_cartesian_tensor<U, N>& rhs)
+  {
+    auto diag = ::mp_units::utility::detail::conjugate(lhs._data_[0]) * rhs._data_[0];
+    for (std::size_t i = 1; i < N; ++i)
+      diag = diag + ::mp_units::utility::detail::conjugate(lhs._data_[i]) * rhs._data_[i];
+    auto off = ::mp_units::utility::detail::conjugate(lhs._data_[N]) * rhs._data_[N];
+    for (std::size_t i = N + 1; i < symmetric_components<N>; ++i)
+      off = off + ::mp_units::utility::detail::conjugate(lhs._data_[i]) * rhs._data_[i];
+    return diag + (off + off);
+  }
+
+  template<typename T, std::size_t N, typename U>
+    requires requires(const T& t, const U& u, decltype(t * u) v) {
+      t * u;
+      v + v;
+    }
+  [[nodiscard]] friend constexpr auto scalar_product(const symmetric_cartesian_tensor<T, N>& lhs,
+                                                     const cartesian_tensor<U, N>& rhs)
+  {
+    // S : A = sum_i S_ii A_ii + sum_{i<j} S_ij (A_ij + A_ji)
+    auto acc = ::mp_units::utility::detail::conjugate(lhs(0, 0)) * rhs(0, 0);
+    for (std::size_t i = 1; i < N; ++i) acc = acc + ::mp_units::utility::detail::conjugate(lhs(i, i)) * rhs(i, i);
+    for (std::size_t i = 0; i < N; ++i)
+      for (std::size_t j = i + 1; j < N; ++j)
+        acc = acc + ::mp_units::utility::detail::conjugate(lhs(i, j)) * (rhs(i, j) + rhs(j, i));
+    return acc;
+  }
+
+  template<typename T, std::size_t N, typename U>
+    requires requires(const T& t, const U& u, decltype(t * u) v) {
+      t * u;
+      v + v;
+    }
+  [[nodiscard]] friend constexpr auto scalar_product(const cartesian_tensor<T, N>& lhs,
+                                                     const symmetric_cartesian_tensor<U, N>& rhs)
+  {
+    auto acc = ::mp_units::utility::detail::conjugate(lhs(0, 0)) * rhs(0, 0);
+    for (std::size_t i = 1; i < N; ++i) acc = acc + ::mp_units::utility::detail::conjugate(lhs(i, i)) * rhs(i, i);
+    for (std::size_t i = 0; i < N; ++i)
+      for (std::size_t j = i + 1; j < N; ++j)
+        acc = acc + ::mp_units::utility::detail::conjugate(lhs(i, j) + lhs(j, i)) * rhs(i, j);
+    return acc;
+  }
+
+  template<typename T, std::size_t N, typename U>
+    requires requires(const T& t, const U& u, decltype(t * u) v) {
+      t * u;
+      v + v;
+    }
+  [[nodiscard]] friend constexpr auto scalar_product(const symmetric_cartesian_tensor<T, N>& lhs,
+                                                     const diagonal_cartesian_tensor<U, N>& rhs)
+  {
+    auto acc = ::mp_units::utility::detail::conjugate(lhs._data_[0]) * rhs._data_[0];
+    for (std::size_t i = 1; i < N; ++i)
+      acc = acc + ::mp_units::utility::detail::conjugate(lhs._data_[i]) * rhs._data_[i];
+    return acc;
+  }
+
+  template<typename T, std::size_t N, typename U>
+    requires requires(const T& t, const U& u, decltype(t * u) v) {
+      t * u;
+      v + v;
+    }
+  [[nodiscard]] friend constexpr auto scalar_product(const diagonal_cartesian_tensor<T, N>& lhs,
+                                                     const symmetric_cartesian_tensor<U, N>& rhs)
+  {
+    auto acc = ::mp_units::utility::detail::conjugate(lhs._data_[0]) * rhs._data_[0];
+    for (std::size_t i = 1; i < N; ++i)
+      acc = acc + ::mp_units::utility::detail::conjugate(lhs._data_[i]) * rhs._data_[i];
+    return acc;
+  }
+};
+
+}  // namespace detail
+
+/**
+ * @brief A symmetric second-order Cartesian tensor with only its distinct components stored
+ *
+ * Models the same tensor as `cartesian_tensor<T, N>` for the symmetric case (e.g. a stress, strain,
+ * inertia, or covariance tensor) in N(N+1)/2 instead of N² components - 6 instead of 9 in 3D. The
+ * components are given and stored in the Voigt order: `xx, yy, zz, yz, xz, xy` in 3D and
+ * `xx, yy, xy` in 2D. Writing `t(row, col)` updates `t(col, row)` as well. Converts implicitly to the
+ * dense `cartesian_tensor` and from `diagonal_cartesian_tensor`.
+ */
+MP_UNITS_EXPORT template<Scalar T = double, std::size_t N = 3>
+  requires(N == 2 || N == 3)
+class symmetric_cartesian_tensor : public detail::symmetric_cartesian_tensor_iface {
+public:
+  // public members required to satisfy structural type requirements :-(
+  T _data_[detail::symmetric_components<N>];
+  using value_type = T;
+
+  static constexpr std::integral_constant<std::size_t, N> extent{};
+
+  template<typename... Args>
+    requires(sizeof...(Args) <= detail::symmetric_components<N>) && (... && std::constructible_from<T, Args>)
+  [[nodiscard]] constexpr explicit(!(... && detail::ImplicitlyConvertibleScalar<Args, T>))
+    symmetric_cartesian_tensor(Args&&... args) :
+      _data_{static_cast<T>(std::forward<Args>(args))...}
+  {
+  }
+
+private:
+  template<typename V, std::size_t... Is>
+  constexpr symmetric_cartesian_tensor(std::index_sequence<Is...>, V&& other) :
+      _data_{static_cast<T>(std::forward<V>(other)._data_[Is])...}
+  {
+  }
+
+  template<typename U, std::size_t... Is>
+  constexpr symmetric_cartesian_tensor(std::index_sequence<Is...>, const diagonal_cartesian_tensor<U, N>& d) :
+      _data_{static_cast<T>(d._data_[Is])...}
+  {
+  }
+
+public:
+  template<typename U>
+    requires std::constructible_from<T, U>
+  [[nodiscard]] constexpr explicit(!detail::ImplicitlyConvertibleScalar<U, T>)
+    symmetric_cartesian_tensor(const symmetric_cartesian_tensor<U, N>& other) :
+      symmetric_cartesian_tensor(std::make_index_sequence<detail::symmetric_components<N>>{}, other)
+  {
+  }
+
+  // the off-diagonal components are value-initialized
+  template<typename U>
+    requires std::constructible_from<T, U>
+  [[nodiscard]] constexpr explicit(!detail::ImplicitlyConvertibleScalar<U, T>)
+    symmetric_cartesian_tensor(const diagonal_cartesian_tensor<U, N>& d) :
+      symmetric_cartesian_tensor(std::make_index_sequence<N>{}, d)
+  {
+  }
+
+  template<typename U>
+    requires std::constructible_from<U, T>
+  [[nodiscard]] constexpr explicit(!detail::ImplicitlyConvertibleScalar<T, U>) operator cartesian_tensor<U, N>() const
+  {
+    return detail::cartesian_tensor_from(std::make_index_sequence<N * N>{},
+                                         [&](std::size_t idx) { return static_cast<U>((*this)(idx / N, idx % N)); });
+  }
+
+  // element access via (row, column); (row, col) and (col, row) name the same stored component
+  [[nodiscard]] constexpr T& operator()(std::size_t row, std::size_t col)
+  {
+    return _data_[detail::voigt_index<N>(row, col)];
+  }
+  [[nodiscard]] constexpr const T& operator()(std::size_t row, std::size_t col) const
+  {
+    return _data_[detail::voigt_index<N>(row, col)];
+  }
+
+#if __cpp_multidimensional_subscript && MP_UNITS_COMP_GCC != 12
+  [[nodiscard]] constexpr T& operator[](std::size_t row, std::size_t col) { return (*this)(row, col); }
+  [[nodiscard]] constexpr const T& operator[](std::size_t row, std::size_t col) const { return (*this)(row, col); }
+#endif
+
+  [[nodiscard]] constexpr auto real() const
+    requires ComplexScalar<T>
+  {
+    return ::mp_units::utility::detail::symmetric_cartesian_tensor_from(
+      std::make_index_sequence<detail::symmetric_components<N>>{},
+      [&](std::size_t i) { return ::mp_units::real(_data_[i]); });
+  }
+
+  [[nodiscard]] constexpr auto imag() const
+    requires ComplexScalar<T>
+  {
+    return ::mp_units::utility::detail::symmetric_cartesian_tensor_from(
+      std::make_index_sequence<detail::symmetric_components<N>>{},
+      [&](std::size_t i) { return ::mp_units::imag(_data_[i]); });
+  }
+
+  // Frobenius norm, with each off-diagonal component counted twice
+  [[nodiscard]] constexpr auto magnitude() const
+    requires requires(T t) {
+      requires(requires { sqrt(t * t); } || requires { std::sqrt(t * t); }) || requires { ::mp_units::modulus(t); };
+    }
+  {
+    using std::sqrt;
+    const auto square = [](const T& v) {
+      if constexpr (ComplexScalar<T>)
+        return ::mp_units::modulus(v) * ::mp_units::modulus(v);
+      else
+        return v * v;
+    };
+    auto diag = square(_data_[0]);
+    for (std::size_t i = 1; i < N; ++i) diag += square(_data_[i]);
+    auto off = square(_data_[N]);
+    for (std::size_t i = N + 1; i < detail::symmetric_components<N>; ++i) off += square(_data_[i]);
+    return sqrt(diag + (off + off));
+  }
+
+  [[nodiscard]] constexpr auto norm() const
+    requires requires(const symmetric_cartesian_tensor& t) { t.magnitude(); }
+  {
+    return magnitude();
+  }
+
+  [[nodiscard]] constexpr symmetric_cartesian_tensor operator+() const { return *this; }
+  [[nodiscard]] constexpr symmetric_cartesian_tensor operator-() const
+  {
+    return ::mp_units::utility::detail::symmetric_cartesian_tensor_from(
+      std::make_index_sequence<detail::symmetric_components<N>>{}, [&](std::size_t i) { return -_data_[i]; });
+  }
+
+  template<typename U>
+    requires requires(T& t, const U& u) {
+      { t += u } -> std::same_as<T&>;
+    }
+  constexpr symmetric_cartesian_tensor& operator+=(const symmetric_cartesian_tensor<U, N>& other)
+  {
+    for (std::size_t i = 0; i < detail::symmetric_components<N>; ++i) _data_[i] += other._data_[i];
+    return *this;
+  }
+
+  template<typename U>
+    requires requires(T& t, const U& u) {
+      { t -= u } -> std::same_as<T&>;
+    }
+  constexpr symmetric_cartesian_tensor& operator-=(const symmetric_cartesian_tensor<U, N>& other)
+  {
+    for (std::size_t i = 0; i < detail::symmetric_components<N>; ++i) _data_[i] -= other._data_[i];
+    return *this;
+  }
+
+  template<typename U>
+    requires requires(T& t, const U& u) {
+      { t *= u } -> std::same_as<T&>;
+    }
+  constexpr symmetric_cartesian_tensor& operator*=(const U& value)
+  {
+    for (std::size_t i = 0; i < detail::symmetric_components<N>; ++i) _data_[i] *= value;
+    return *this;
+  }
+
+  template<typename U>
+    requires requires(T& t, const U& u) {
+      { t /= u } -> std::same_as<T&>;
+    }
+  constexpr symmetric_cartesian_tensor& operator/=(const U& value)
+  {
+    for (std::size_t i = 0; i < detail::symmetric_components<N>; ++i) _data_[i] /= value;
+    return *this;
+  }
+
+  [[nodiscard]] friend constexpr auto norm(const symmetric_cartesian_tensor& t)
+    requires requires { t.norm(); }
+  {
+    return t.norm();
+  }
+
+  [[nodiscard]] friend constexpr auto magnitude(const symmetric_cartesian_tensor& t)
+    requires requires { t.norm(); }
+  {
+    return t.norm();
+  }
+
+#if MP_UNITS_HOSTED
+  friend constexpr std::ostream& operator<<(std::ostream& os, const symmetric_cartesian_tensor& t)
+  {
+    return os << cartesian_tensor<T, N>(t);
+  }
+#endif
+};
+
+template<typename Arg, typename... Args>
+  requires(1 + sizeof...(Args) == 3 || 1 + sizeof...(Args) == 6) &&
+          requires { typename std::common_type_t<Arg, Args...>; }
+symmetric_cartesian_tensor(Arg, Args...)
+  -> symmetric_cartesian_tensor<std::common_type_t<Arg, Args...>, (1 + sizeof...(Args) == 3 ? 2 : 3)>;
+
+// the dense tensor is deduced from a symmetric one (e.g. `cartesian_tensor dense = t;`)
+template<typename T, std::size_t N>
+cartesian_tensor(symmetric_cartesian_tensor<T, N>) -> cartesian_tensor<T, N>;
+
+}  // namespace mp_units::utility
+
+template<typename T, std::size_t N, typename U>
+  requires requires { typename std::common_type_t<T, U>; }
+struct std::common_type<mp_units::utility::symmetric_cartesian_tensor<T, N>,
+                        mp_units::utility::symmetric_cartesian_tensor<U, N>> {
+  using type = mp_units::utility::symmetric_cartesian_tensor<std::common_type_t<T, U>, N>;
+};
+
+#if MP_UNITS_HOSTED
+template<typename T, std::size_t N, typename Char>
+struct MP_UNITS_STD_FMT::formatter<mp_units::utility::symmetric_cartesian_tensor<T, N>, Char> :
+    MP_UNITS_STD_FMT::formatter<mp_units::utility::cartesian_tensor<T, N>, Char> {
+  template<typename FormatContext>
+  auto format(const mp_units::utility::symmetric_cartesian_tensor<T, N>& tensor, FormatContext& ctx) const
+  {
+    return MP_UNITS_STD_FMT::formatter<mp_units::utility::cartesian_tensor<T, N>, Char>::format(
+      mp_units::utility::cartesian_tensor<T, N>(tensor), ctx);
+  }
+};
+#endif
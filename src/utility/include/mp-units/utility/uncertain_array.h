@@ -0,0 +1,589 @@
+// The MIT License (MIT)
+//
+// Copyright (c) 2018 Mateusz Pusz
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+
+#pragma once
+
+#include <mp-units/bits/requires_hosted.h>
+//
+#include <mp-units/bits/module_macros.h>
+#include <mp-units/ext/contracts.h>
+#include <mp-units/math.h>
+#include <mp-units/systems/si/math.h>
+#include <mp-units/utility/uncertain.h>
+#include <mp-units/utility/vector_quantity_soa.h>
+
+#ifndef MP_UNITS_IN_MODULE_INTERFACE
+#include <mp-units/framework/quantity.h>
+#include <mp-units/framework/quantity_concepts.h>
+#include <mp-units/framework/reference.h>
+#include <mp-units/framework/representation_concepts.h>
+#include <mp-units/framework/unit.h>
+#include <mp-units/systems/si/units.h>
+#ifdef MP_UNITS_IMPORT_STD
+import std;
+#else
+#include <algorithm>
+#include <cmath>
+#include <concepts>
+#include <cstddef>
+#include <span>
+#include <utility>
+#include <vector>
+#endif
+#endif
+
+namespace mp_units::utility {
+
+namespace detail {
+
+// Replaces `x[i]` with `hypot(x[i], y[i])` for the first `n` elements of a block. As in
+// `soa_magnitudes`, the square root of the sum of squares is taken for the whole block, which
+// vectorizes, and only the elements for which that sum overflowed or underflowed are recomputed
+// with `hypot`.
+template<typename T>
+void uncertain_quadrature(T (&x)[soa_block_size], const T (&y)[soa_block_size], std::size_t n)
+{
+  using std::hypot;
+  using std::sqrt;
+  T sums[soa_block_size];
+  std::size_t inaccurate = 0;
+  for (std::size_t i = 0; i < n; ++i) {
+    sums[i] = x[i] * x[i] + y[i] * y[i];
+    inaccurate += !sqrt_of_sum_of_squares_is_accurate(sums[i]);
+  }
+  if (inaccurate == 0) {
+    for (std::size_t i = 0; i < n; ++i) x[i] = sqrt(sums[i]);
+    return;
+  }
+  for (std::size_t i = 0; i < n; ++i)
+    x[i] = sqrt_of_sum_of_squares_is_accurate(sums[i]) ? sqrt(sums[i]) : hypot(x[i], y[i]);
+}
+
+}  // namespace detail
+
+/**
+ * @brief A structure-of-arrays container of quantities with uncertainties
+ *
+ * A `std::vector<quantity<R, uncertain<T>>>` interleaves the central values with their
+ * uncertainties, and every operation on its elements computes both one element at a time.
+ * `uncertain_array` stores the central values and the uncertainties (in `get_unit(R)`) in two
+ * separate contiguous arrays instead, so the batch arithmetic and math functions below run both
+ * channels at the full SIMD width of the target. A unit conversion computes the conversion factor,
+ * together with the uncertainty of one built from measured constants (see
+ * `fold_conversion_uncertainty`), once for the whole batch.
+ *
+ * The propagation formulas and their assumptions are those of `uncertain<T>`: every operand is
+ * taken as independent of the others.
+ *
+ * Elements are read as `quantity<R, uncertain<T>>` values and written through the proxy
+ * `reference` returned by the non-const `operator[]`, so every access stays unit-safe; the raw
+ * arrays are available through `numerical_values()` and `uncertainties()`.
+ *
+ * @code
+ * uncertain_array<isq::length[m]> length(1'000'000);
+ * length[0] = uncertain{10.0, 0.1} * isq::length[m];
+ * uncertain_array area = length * length;
+ * uncertain_array<isq::area[cm2]> in_cm2 = area;
+ * @endcode
+ *
+ * @tparam R the reference of every element
+ * @tparam T the underlying type of the central values and the uncertainties
+ */
+MP_UNITS_EXPORT template<Reference auto R, std::floating_point T = double>
+  requires RepresentationOf<uncertain<T>, get_quantity_spec(R)>
+class uncertain_array {
+  std::vector<T> values_;
+  std::vector<T> uncertainties_;
+
+public:
+  using value_type = quantity<R, uncertain<T>>;
+  using size_type = std::size_t;
+
+  /**
+   * @brief A proxy to one element of the container
+   *
+   * Converts to `value_type` and can be assigned any quantity implicitly convertible to it.
+   */
+  class reference {
+    uncertain_array* array_;
+    size_type index_;
+
+    friend uncertain_array;
+    constexpr reference(uncertain_array& array, size_type index) : array_(&array), index_(index) {}
+
+    [[nodiscard]] value_type get() const { return std::as_const(*array_)[index_]; }
+
+  public:
+    reference(const reference&) = default;
+
+    // NOLINTNEXTLINE(google-explicit-constructor, hicpp-explicit-conversions)
+    [[nodiscard]] operator value_type() const { return get(); }
+
+    reference& operator=(const value_type& q)
+    {
+      const uncertain<T>& v = q.numerical_value_ref_in(value_type::unit);
+      array_->values_[index_] = v.value();
+      array_->uncertainties_[index_] = v.uncertainty();
+      return *this;
+    }
+
+    // NOLINTNEXTLINE(cert-oop54-cpp)
+    reference& operator=(const reference& other) { return *this = other.get(); }
+
+    [[nodiscard]] friend bool operator==(const reference& lhs, const value_type& rhs) { return lhs.get() == rhs; }
+  };
+
+  using const_reference = value_type;
+
+  uncertain_array() = default;
+
+  /**
+   * @brief Creates a container of `count` exact zeros
+   */
+  explicit uncertain_array(size_type count) : values_(count, T{}), uncertainties_(count, T{}) {}
+
+  /**
+   * @brief Converts all elements of a container in another unit at once
+   *
+   * Implicit when the conversion of a single element is. The conversion factor is computed once,
+   * as an `uncertain<T>` into which the relative uncertainty of a factor built from measured
+   * constants is folded, and then applied to both arrays:
+   * v' = k·v, σ' = √((k·σ)² + (v·σ_k)²).
+   */
+  template<auto R2>
+    requires std::constructible_from<value_type, quantity<R2, uncertain<T>>>
+  // NOLINTNEXTLINE(google-explicit-constructor, hicpp-explicit-conversions)
+  explicit(!std::convertible_to<quantity<R2, uncertain<T>>, value_type>)
+    uncertain_array(const uncertain_array<R2, T>& other) :
+      uncertain_array(other.size())
+  {
+    const uncertain<T> factor = value_type(uncertain<T>{T{1}} * R2).numerical_value_in(value_type::unit);
+    const T k = factor.value();
+    const T uk = factor.uncertainty();
+    const T* v = other.numerical_values().data();
+    const T* u = other.uncertainties().data();
+    T* const out_v = values_.data();
+    T* const out_u = uncertainties_.data();
+    const size_type count = size();
+    using std::abs;
+    for (size_type i = 0; i < count; ++i) out_v[i] = k * v[i];
+    if (uk == T{0}) {
+      const T abs_k = abs(k);
+      for (size_type i = 0; i < count; ++i) out_u[i] = abs_k * u[i];
+    } else {
+      for (size_type first = 0; first < count; first += detail::soa_block_size) {
+        const size_type n = std::min(detail::soa_block_size, count - first);
+        T x[detail::soa_block_size];
+        T y[detail::soa_block_size];
+        for (size_type i = 0; i < n; ++i) {
+          x[i] = k * u[first + i];
+          y[i] = uk * v[first + i];
+        }
+        detail::uncertain_quadrature(x, y, n);
+        std::copy_n(x, n, out_u + first);
+      }
+    }
+  }
+
+  /**
+   * @brief Returns a copy of the container with all elements converted to `u`
+   */
+  template<Unit U>
+    requires requires(const value_type& q, U u) { q.in(u); }
+  [[nodiscard]] auto in(U u) const
+  {
+    using converted = decltype(std::declval<const value_type&>().in(u));
+    return uncertain_array<converted::reference, T>(*this);
+  }
+
+  [[nodiscard]] size_type size() const noexcept { return values_.size(); }
+  [[nodiscard]] bool empty() const noexcept { return values_.empty(); }
+
+  void reserve(size_type count)
+  {
+    values_.reserve(count);
+    uncertainties_.reserve(count);
+  }
+
+  void resize(size_type count)
+  {
+    values_.resize(count, T{});
+    uncertainties_.resize(count, T{});
+  }
+
+  void clear() noexcept
+  {
+    values_.clear();
+    uncertainties_.clear();
+  }
+
+  void push_back(const value_type& q)
+  {
+    const uncertain<T>& v = q.numerical_value_ref_in(value_type::unit);
+    values_.push_back(v.value());
+    uncertainties_.push_back(v.uncertainty());
+  }
+
+  [[nodiscard]] reference operator[](size_type index)
+  {
+    MP_UNITS_EXPECTS_DEBUG(index < size());
+    return reference(*this, index);
+  }
+
+  [[nodiscard]] const_reference operator[](size_type index) const
+  {
+    MP_UNITS_EXPECTS_DEBUG(index < size());
+    return uncertain<T>{values_[index], uncertainties_[index]} * R;
+  }
+
+  /**
+   * @brief The contiguous central values (in `get_unit(R)`)
+   */
+  [[nodiscard]] std::span<T> numerical_values() { return values_; }
+  [[nodiscard]] std::span<const T> numerical_values() const { return values_; }
+
+  /**
+   * @brief The contiguous absolute uncertainties (in `get_unit(R)`)
+   *
+   * @note Writing a negative uncertainty through this span breaks the precondition of `uncertain`.
+   */
+  [[nodiscard]] std::span<T> uncertainties() { return uncertainties_; }
+  [[nodiscard]] std::span<const T> uncertainties() const { return uncertainties_; }
+};
+
+namespace detail {
+
+// Runs `kernel(first, n, value, x, y)` over the blocks of `count` elements. The kernel stages the
+// central values and the two partial terms whose quadrature sum is the uncertainty in the local
+// arrays, and the results are then stored to `out`.
+template<auto R, typename T, typename Kernel>
+void uncertain_binary_apply(uncertain_array<R, T>& out, Kernel kernel)
+{
+  const std::size_t count = out.size();
+  T* const value = out.numerical_values().data();
+  T* const uncertainty = out.uncertainties().data();
+  for (std::size_t first = 0; first < count; first += soa_block_size) {
+    const std::size_t n = std::min(soa_block_size, count - first);
+    T v[soa_block_size];
+    T x[soa_block_size];
+    T y[soa_block_size];
+    kernel(first, n, v, x, y);
+    uncertain_quadrature(x, y, n);
+    std::copy_n(v, n, value + first);
+    std::copy_n(x, n, uncertainty + first);
+  }
+}
+
+// The factor converting a numerical value in `get_unit(R)` to one in `U`.
+template<auto R, Unit auto U, typename T>
+[[nodiscard]] T uncertain_array_factor()
+{
+  return (T{1} * R).numerical_value_in(U);
+}
+
+}  // namespace detail
+
+/**
+ * @brief Element-wise sum of two containers
+ * @note Assumes independent values. Formula: σ² = σ_x² + σ_y²
+ */
+MP_UNITS_EXPORT template<auto R, typename T>
+[[nodiscard]] uncertain_array<R, T> operator+(const uncertain_array<R, T>& lhs, const uncertain_array<R, T>& rhs)
+{
+  MP_UNITS_PRECONDITION(lhs.size() == rhs.size());
+  uncertain_array<R, T> res(lhs.size());
+  const T* a = lhs.numerical_values().data();
+  const T* ua = lhs.uncertainties().data();
+  const T* b = rhs.numerical_values().data();
+  const T* ub = rhs.uncertainties().data();
+  detail::uncertain_binary_apply(res, [&](std::size_t first, std::size_t n, auto& v, auto& x, auto& y) {
+    for (std::size_t i = 0; i < n; ++i) {
+      v[i] = a[first + i] + b[first + i];
+      x[i] = ua[first + i];
+      y[i] = ub[first + i];
+    }
+  });
+  return res;
+}
+
+/**
+ * @brief Element-wise difference of two containers
+ * @note Assumes independent values. Formula: σ² = σ_x² + σ_y²
+ */
+MP_UNITS_EXPORT template<auto R, typename T>
+[[nodiscard]] uncertain_array<R, T> operator-(const uncertain_array<R, T>& lhs, const uncertain_array<R, T>& rhs)
+{
+  MP_UNITS_PRECONDITION(lhs.size() == rhs.size());
+  uncertain_array<R, T> res(lhs.size());
+  const T* a = lhs.numerical_values().data();
+  const T* ua = lhs.uncertainties().data();
+  const T* b = rhs.numerical_values().data();
+  const T* ub = rhs.uncertainties().data();
+  detail::uncertain_binary_apply(res, [&](std::size_t first, std::size_t n, auto& v, auto& x, auto& y) {
+    for (std::size_t i = 0; i < n; ++i) {
+      v[i] = a[first + i] - b[first + i];
+      x[i] = ua[first + i];
+      y[i] = ub[first + i];
+    }
+  });
+  return res;
+}
+
+/**
+ * @brief Element-wise product of two containers
+ * @note Assumes independent values. Formula: σ_f² = (y·σ_x)² + (x·σ_y)²
+ */
+MP_UNITS_EXPORT template<auto R1, auto R2, typename T>
+[[nodiscard]] uncertain_array<R1 * R2, T> operator*(const uncertain_array<R1, T>& lhs,
+                                                    const uncertain_array<R2, T>& rhs)
+{
+  MP_UNITS_PRECONDITION(lhs.size() == rhs.size());
+  uncertain_array<R1 * R2, T> res(lhs.size());
+  const T* a = lhs.numerical_values().data();
+  const T* ua = lhs.uncertainties().data();
+  const T* b = rhs.numerical_values().data();
+  const T* ub = rhs.uncertainties().data();
+  detail::uncertain_binary_apply(res, [&](std::size_t first, std::size_t n, auto& v, auto& x, auto& y) {
+    for (std::size_t i = 0; i < n; ++i) {
+      v[i] = a[first + i] * b[first + i];
+      x[i] = b[first + i] * ua[first + i];
+      y[i] = a[first + i] * ub[first + i];
+    }
+  });
+  return res;
+}
+
+/**
+ * @brief Element-wise quotient of two containers
+ * @note Assumes independent values. Formula: σ_f² = (σ_x/y)² + (f·σ_y/y)²
+ */
+MP_UNITS_EXPORT template<auto R1, auto R2, typename T>
+[[nodiscard]] uncertain_array<R1 / R2, T> operator/(const uncertain_array<R1, T>& lhs,
+                                                    const uncertain_array<R2, T>& rhs)
+{
+  MP_UNITS_PRECONDITION(lhs.size() == rhs.size());
+  uncertain_array<R1 / R2, T> res(lhs.size());
+  const T* a = lhs.numerical_values().data();
+  const T* ua = lhs.uncertainties().data();
+  const T* b = rhs.numerical_values().data();
+  const T* ub = rhs.uncertainties().data();
+  detail::uncertain_binary_apply(res, [&](std::size_t first, std::size_t n, auto& v, auto& x, auto& y) {
+    for (std::size_t i = 0; i < n; ++i) {
+      const T inv = T{1} / b[first + i];
+      v[i] = a[first + i] * inv;
+      x[i] = ua[first + i] * inv;
+      y[i] = v[i] * ub[first + i] * inv;
+    }
+  });
+  return res;
+}
+
+/**
+ * @brief Multiplication of all elements by an exact scalar
+ * @note Formula: σ_f = |k| × σ_x
+ */
+MP_UNITS_EXPORT template<auto R, typename T>
+[[nodiscard]] uncertain_array<R, T> operator*(const uncertain_array<R, T>& lhs, const std::type_identity_t<T>& k)
+{
+  using std::abs;
+  uncertain_array<R, T> res(lhs.size());
+  const T abs_k = abs(k);
+  std::ranges::transform(lhs.numerical_values(), res.numerical_values().begin(), [k](T v) { return k * v; });
+  std::ranges::transform(lhs.uncertainties(), res.uncertainties().begin(), [abs_k](T u) { return abs_k * u; });
+  return res;
+}
+
+/// @brief Multiplication of all elements by an exact scalar (commutative)
+MP_UNITS_EXPORT template<auto R, typename T>
+[[nodiscard]] uncertain_array<R, T> operator*(const std::type_identity_t<T>& k, const uncertain_array<R, T>& rhs)
+{
+  return rhs * k;
+}
+
+/**
+ * @brief Division of all elements by an exact scalar
+ * @note Formula: σ_f = σ_x / |k|
+ */
+MP_UNITS_EXPORT template<auto R, typename T>
+[[nodiscard]] uncertain_array<R, T> operator/(const uncertain_array<R, T>& lhs, const std::type_identity_t<T>& k)
+{
+  return lhs * (T{1} / k);
+}
+
+/**
+ * @brief Element-wise square root
+ * @note Formula: σ_f = σ_x / (2√x)
+ */
+MP_UNITS_EXPORT template<auto R, typename T>
+[[nodiscard]] uncertain_array<sqrt(R), T> sqrt(const uncertain_array<R, T>& in)
+{
+  using std::sqrt;
+  const std::size_t count = in.size();
+  uncertain_array<sqrt(R), T> res(count);
+  const T* a = in.numerical_values().data();
+  const T* ua = in.uncertainties().data();
+  T* v = res.numerical_values().data();
+  T* u = res.uncertainties().data();
+  for (std::size_t i = 0; i < count; ++i) {
+    v[i] = sqrt(a[i]);
+    u[i] = ua[i] / (T{2} * v[i]);
+  }
+  return res;
+}
+
+/**
+ * @brief Element-wise exponential of a dimensionless container
+ *
+ * The result is expressed in `one`.
+ *
+ * @note Formula: σ_f = |f × σ_x|
+ */
+MP_UNITS_EXPORT template<ReferenceOf<dimensionless> auto R, typename T>
+[[nodiscard]] uncertain_array<one, T> exp(const uncertain_array<R, T>& in)
+{
+  using std::abs;
+  using std::exp;
+  const std::size_t count = in.size();
+  uncertain_array<one, T> res(count);
+  const T k = detail::uncertain_array_factor<R, one, T>();
+  const T* a = in.numerical_values().data();
+  const T* ua = in.uncertainties().data();
+  T* v = res.numerical_values().data();
+  T* u = res.uncertainties().data();
+  for (std::size_t i = 0; i < count; ++i) {
+    v[i] = exp(k * a[i]);
+    u[i] = abs(v[i] * k * ua[i]);
+  }
+  return res;
+}
+
+/**
+ * @brief Element-wise natural logarithm of a dimensionless container
+ *
+ * The result is expressed in `one`.
+ *
+ * @note Formula: σ_f = |σ_x / x|
+ */
+MP_UNITS_EXPORT template<ReferenceOf<dimensionless> auto R, typename T>
+[[nodiscard]] uncertain_array<one, T> log(const uncertain_array<R, T>& in)
+{
+  using std::abs;
+  using std::log;
+  const std::size_t count = in.size();
+  uncertain_array<one, T> res(count);
+  const T k = detail::uncertain_array_factor<R, one, T>();
+  const T* a = in.numerical_values().data();
+  const T* ua = in.uncertainties().data();
+  T* v = res.numerical_values().data();
+  T* u = res.uncertainties().data();
+  for (std::size_t i = 0; i < count; ++i) {
+    v[i] = log(k * a[i]);
+    u[i] = abs(ua[i] / a[i]);
+  }
+  return res;
+}
+
+namespace detail {
+
+// The sine and cosine of a container of angles with the selected accuracy of `si::sincos`, which
+// reduces the angle in its own unit, and the uncertainties `|d·σ|` with the derivative `d` of the
+// selected function in radians scaled to the unit of the angle.
+template<bool Sine, auto R, typename T, MathAccuracy Accuracy>
+[[nodiscard]] uncertain_array<one, T> uncertain_sin_cos(const uncertain_array<R, T>& in, Accuracy acc)
+{
+  using std::abs;
+  const std::size_t count = in.size();
+  uncertain_array<one, T> res(count);
+  const T k = uncertain_array_factor<R, si::radian, T>();
+  const T* a = in.numerical_values().data();
+  const T* ua = in.uncertainties().data();
+  T* v = res.numerical_values().data();
+  T* u = res.uncertainties().data();
+  for (std::size_t i = 0; i < count; ++i) {
+    const auto [s, c] = si::sincos(quantity<R, T>{a[i], R}, acc);
+    v[i] = (Sine ? s : c).numerical_value_in(one);
+    u[i] = abs((Sine ? c : s).numerical_value_in(one) * k * ua[i]);
+  }
+  return res;
+}
+
+}  // namespace detail
+
+/**
+ * @brief Element-wise sine of a container of angles, with a selected accuracy
+ *
+ * The angles are reduced in their own unit (see `MathAccuracy`), and the result is expressed in
+ * `one`.
+ *
+ * @note Formula: σ_f = |cos(x)| × σ_x (with x and σ_x in radians)
+ */
+MP_UNITS_EXPORT template<ReferenceOf<isq::angular_measure> auto R, typename T,
+                         MathAccuracy Accuracy = libm_accuracy_t>
+[[nodiscard]] uncertain_array<one, T> sin(const uncertain_array<R, T>& in, Accuracy acc = Accuracy{})
+{
+  return detail::uncertain_sin_cos<true>(in, acc);
+}
+
+/**
+ * @brief Element-wise cosine of a container of angles, with a selected accuracy
+ *
+ * @note Formula: σ_f = |sin(x)| × σ_x (with x and σ_x in radians)
+ */
+MP_UNITS_EXPORT template<ReferenceOf<isq::angular_measure> auto R, typename T,
+                         MathAccuracy Accuracy = libm_accuracy_t>
+[[nodiscard]] uncertain_array<one, T> cos(const uncertain_array<R, T>& in, Accuracy acc = Accuracy{})
+{
+  return detail::uncertain_sin_cos<false>(in, acc);
+}
+
+/**
+ * @brief Element-wise two-argument arc tangent, with a selected accuracy
+ *
+ * The result is expressed in `si::radian`.
+ *
+ * @note Assumes independent values. Formula: σ_f² = ((x·σ_y)² + (y·σ_x)²) / (x² + y²)²
+ */
+MP_UNITS_EXPORT template<auto R, typename T, MathAccuracy Accuracy = libm_accuracy_t>
+  requires requires(T v) { si::atan2(v * R, v * R, Accuracy{}); }
+[[nodiscard]] uncertain_array<si::radian, T> atan2(const uncertain_array<R, T>& y, const uncertain_array<R, T>& x,
+                                                   Accuracy acc = Accuracy{})
+{
+  MP_UNITS_PRECONDITION(y.size() == x.size());
+  uncertain_array<si::radian, T> res(y.size());
+  const T* a = y.numerical_values().data();
+  const T* ua = y.uncertainties().data();
+  const T* b = x.numerical_values().data();
+  const T* ub = x.uncertainties().data();
+  detail::uncertain_binary_apply(res, [&](std::size_t first, std::size_t n, auto& v, auto& tx, auto& ty) {
+    for (std::size_t i = 0; i < n; ++i)
+      v[i] = si::atan2(quantity<R, T>{a[first + i], R}, quantity<R, T>{b[first + i], R}, acc)
+               .numerical_value_in(si::radian);
+    for (std::size_t i = 0; i < n; ++i) {
+      const T inv = T{1} / (a[first + i] * a[first + i] + b[first + i] * b[first + i]);
+      tx[i] = b[first + i] * ua[first + i] * inv;
+      ty[i] = a[first + i] * ub[first + i] * inv;
+    }
+  });
+  return res;
+}
+
+}  // namespace mp_units::utility
@@ -0,0 +1,375 @@
+// The MIT License (MIT)
+//
+// Copyright (c) 2018 Mateusz Pusz
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+
+#pragma once
+
+#include <mp-units/bits/requires_hosted.h>
+//
+#include <mp-units/bits/module_macros.h>
+#include <mp-units/ext/contracts.h>
+#include <mp-units/utility/cartesian_vector.h>
+
+#ifndef MP_UNITS_IN_MODULE_INTERFACE
+#include <mp-units/framework/quantity.h>
+#include <mp-units/framework/reference.h>
+#include <mp-units/framework/representation_concepts.h>
+#include <mp-units/framework/unit.h>
+#ifdef MP_UNITS_IMPORT_STD
+import std;
+#else
+#include <algorithm>
+#include <array>
+#include <cmath>
+#include <cstddef>
+#include <limits>
+#include <span>
+#include <utility>
+#include <vector>
+#endif
+#endif
+
+namespace mp_units::utility {
+
+/**
+ * @brief A structure-of-arrays container of vector quantities
+ *
+ * A `std::vector<quantity<R, cartesian_vector<T, N>>>` interleaves the coordinates of its elements
+ * (x0 y0 z0 x1 y1 z1 ...), so a loop over one coordinate of many vectors has to gather it with a
+ * stride. `vector_quantity_soa` stores one contiguous array of numerical values (in `get_unit(R)`)
+ * per axis instead, which lets the batch `scalar_product()`, `vector_product()`, `magnitude()`, and
+ * `unit_vector()` below run at the full SIMD width of the target.
+ *
+ * Elements are read as `quantity<R, cartesian_vector<T, N>>` values, and written through the proxy
+ * `reference` returned by the non-const `operator[]`, so every access stays unit-safe; the raw
+ * per-axis arrays are available through `numerical_values()`.
+ *
+ * @code
+ * vector_quantity_soa<isq::velocity[m / s]> v(1000);
+ * v[0] = cartesian_vector{1., 2., 3.} * isq::velocity[km / h];
+ * std::vector<quantity<m / s>> speed(v.size());
+ * magnitude(v, std::span{speed});
+ * @endcode
+ *
+ * @tparam R the reference of every element
+ * @tparam T the type of a coordinate
+ * @tparam N the dimension of the space (2 or 3)
+ */
+MP_UNITS_EXPORT template<Reference auto R, typename T = double, std::size_t N = 3>
+  requires(N == 2 || N == 3) && RepresentationOf<cartesian_vector<T, N>, get_quantity_spec(R)>
+class vector_quantity_soa {
+  std::array<std::vector<T>, N> components_;
+
+public:
+  using value_type = quantity<R, cartesian_vector<T, N>>;
+  using size_type = std::size_t;
+
+  /**
+   * @brief A proxy to one element of the container
+   *
+   * Converts to `value_type` and can be assigned (or `+=`/`-=`) any quantity implicitly
+   * convertible to it; the coordinates are scattered to (or gathered from) the per-axis arrays.
+   */
+  class reference {
+    vector_quantity_soa* soa_;
+    size_type index_;
+
+    friend vector_quantity_soa;
+    constexpr reference(vector_quantity_soa& soa, size_type index) : soa_(&soa), index_(index) {}
+
+    // not spelled `static_cast<value_type>(*this)`, which for a dimensionless `R` would select the
+    // (deleted) converting constructor of `quantity` from a raw value instead of our conversion
+    [[nodiscard]] value_type get() const { return std::as_const(*soa_)[index_]; }
+
+  public:
+    reference(const reference&) = default;
+
+    // NOLINTNEXTLINE(google-explicit-constructor, hicpp-explicit-conversions)
+    [[nodiscard]] operator value_type() const { return get(); }
+
+    reference& operator=(const value_type& q)
+    {
+      const cartesian_vector<T, N>& v = q.numerical_value_ref_in(value_type::unit);
+      for (std::size_t axis = 0; axis < N; ++axis) soa_->components_[axis][index_] = v[axis];
+      return *this;
+    }
+
+    // NOLINTNEXTLINE(cert-oop54-cpp)
+    reference& operator=(const reference& other) { return *this = other.get(); }
+
+    reference& operator+=(const value_type& q) { return *this = get() + q; }
+    reference& operator-=(const value_type& q) { return *this = get() - q; }
+
+    [[nodiscard]] auto magnitude() const { return get().magnitude(); }
+
+    [[nodiscard]] friend bool operator==(const reference& lhs, const value_type& rhs)
+    {
+      return lhs.get() == rhs;
+    }
+  };
+
+  using const_reference = value_type;
+
+  vector_quantity_soa() = default;
+
+  /**
+   * @brief Creates a container of `count` zero vectors
+   */
+  explicit vector_quantity_soa(size_type count)
+  {
+    for (std::vector<T>& c : components_) c.assign(count, T{});
+  }
+
+  [[nodiscard]] size_type size() const noexcept { return components_[0].size(); }
+  [[nodiscard]] bool empty() const noexcept { return components_[0].empty(); }
+
+  void reserve(size_type count)
+  {
+    for (std::vector<T>& c : components_) c.reserve(count);
+  }
+
+  void resize(size_type count)
+  {
+    for (std::vector<T>& c : components_) c.resize(count, T{});
+  }
+
+  void clear() noexcept
+  {
+    for (std::vector<T>& c : components_) c.clear();
+  }
+
+  void push_back(const value_type& q)
+  {
+    const cartesian_vector<T, N>& v = q.numerical_value_ref_in(value_type::unit);
+    for (std::size_t axis = 0; axis < N; ++axis) components_[axis].push_back(v[axis]);
+  }
+
+  [[nodiscard]] reference operator[](size_type index)
+  {
+    MP_UNITS_EXPECTS_DEBUG(index < size());
+    return reference(*this, index);
+  }
+
+  [[nodiscard]] const_reference operator[](size_type index) const
+  {
+    MP_UNITS_EXPECTS_DEBUG(index < size());
+    return [&]<std::size_t... Is>(std::index_sequence<Is...>) {
+      return cartesian_vector<T, N>{components_[Is][index]...} * R;
+    }(std::make_index_sequence<N>{});
+  }
+
+  /**
+   * @brief The contiguous numerical values (in `get_unit(R)`) of the coordinate along `axis`
+   */
+  [[nodiscard]] std::span<T> numerical_values(std::size_t axis)
+  {
+    MP_UNITS_EXPECTS_DEBUG(axis < N);
+    return components_[axis];
+  }
+
+  [[nodiscard]] std::span<const T> numerical_values(std::size_t axis) const
+  {
+    MP_UNITS_EXPECTS_DEBUG(axis < N);
+    return components_[axis];
+  }
+};
+
+namespace detail {
+
+// The batch kernels below work through blocks of this many elements, staging the per-element
+// results in local arrays. Writing only local arrays in the arithmetic loop spares the vectorizer a
+// runtime aliasing check between every input and output array (the 9 arrays of a vector product are
+// already past GCC's default limit of 10 checks), and makes an output that is also an input safe.
+inline constexpr std::size_t soa_block_size = 64;
+
+// Whether the square root of a sum of squared coordinates is as accurate as `hypot`, i.e. the sum
+// neither overflowed nor lost precision to underflow (and is not NaN).
+template<typename T>
+[[nodiscard]] constexpr bool sqrt_of_sum_of_squares_is_accurate(T sum)
+{
+  return (sum >= std::numeric_limits<T>::min() / std::numeric_limits<T>::epsilon()) &
+         (sum <= std::numeric_limits<T>::max());
+}
+
+template<typename T, std::size_t N>
+[[nodiscard]] T soa_hypot(const std::array<const T*, N>& c, std::size_t i)
+{
+  using std::hypot;
+  if constexpr (N == 2)
+    return hypot(c[0][i], c[1][i]);
+  else
+    return hypot(c[0][i], c[1][i], c[2][i]);
+}
+
+template<auto R, typename T, std::size_t N>
+[[nodiscard]] std::array<const T*, N> soa_data(const vector_quantity_soa<R, T, N>& soa)
+{
+  std::array<const T*, N> res{};
+  for (std::size_t axis = 0; axis < N; ++axis) res[axis] = soa.numerical_values(axis).data();
+  return res;
+}
+
+template<auto R, typename T, std::size_t N>
+[[nodiscard]] std::array<T*, N> soa_data(vector_quantity_soa<R, T, N>& soa)
+{
+  std::array<T*, N> res{};
+  for (std::size_t axis = 0; axis < N; ++axis) res[axis] = soa.numerical_values(axis).data();
+  return res;
+}
+
+// Stores the sums of the squared coordinates of the `n` elements starting at `first` in `sums` and
+// returns the number of them whose square root is not accurate.
+template<typename T, std::size_t N>
+[[nodiscard]] std::size_t soa_sums_of_squares(const std::array<const T*, N>& c, std::size_t first, std::size_t n,
+                                              T (&sums)[soa_block_size])
+{
+  std::size_t inaccurate = 0;
+  for (std::size_t i = 0; i < n; ++i) {
+    T sum = c[0][first + i] * c[0][first + i];
+    for (std::size_t axis = 1; axis < N; ++axis) sum += c[axis][first + i] * c[axis][first + i];
+    sums[i] = sum;
+    inaccurate += !sqrt_of_sum_of_squares_is_accurate(sum);
+  }
+  return inaccurate;
+}
+
+// The magnitudes of the `n` elements starting at `first`: the square roots of `sums`, with the
+// inaccurate ones recomputed with `hypot`.
+template<typename T, std::size_t N>
+void soa_magnitudes(const std::array<const T*, N>& c, std::size_t first, std::size_t n, T (&sums)[soa_block_size])
+{
+  using std::sqrt;
+  const std::size_t inaccurate = soa_sums_of_squares(c, first, n, sums);
+  for (std::size_t i = 0; i < n; ++i) sums[i] = sqrt(sums[i]);
+  if (inaccurate == 0) return;
+  // the classification thresholds are far from the edges of the range, so the squared root
+  // classifies an element just like its original sum did
+  for (std::size_t i = 0; i < n; ++i)
+    if (!sqrt_of_sum_of_squares_is_accurate(sums[i] * sums[i])) sums[i] = soa_hypot(c, first + i);
+}
+
+}  // namespace detail
+
+/**
+ * @brief Computes the scalar products `lhs[i] ⋅ rhs[i]` for all elements of the containers
+ *
+ * The result is expressed in `get_unit(R1) * get_unit(R2)`, which `out` has to be assignable from.
+ */
+MP_UNITS_EXPORT template<auto R1, typename T, std::size_t N, auto R2, typename To, std::size_t M>
+  requires requires(To& out, T v) { out = v * (get_unit(R1) * get_unit(R2)); }
+void scalar_product(const vector_quantity_soa<R1, T, N>& lhs, const vector_quantity_soa<R2, T, N>& rhs,
+                    std::span<To, M> out)
+{
+  MP_UNITS_PRECONDITION(lhs.size() == rhs.size());
+  MP_UNITS_PRECONDITION(lhs.size() <= out.size());
+  constexpr auto u = get_unit(R1) * get_unit(R2);
+  const auto a = detail::soa_data(lhs);
+  const auto b = detail::soa_data(rhs);
+  for (std::size_t i = 0; i < lhs.size(); ++i) {
+    T sum = a[0][i] * b[0][i];
+    for (std::size_t axis = 1; axis < N; ++axis) sum += a[axis][i] * b[axis][i];
+    out[i] = sum * u;
+  }
+}
+
+/**
+ * @brief Computes the vector products `lhs[i] × rhs[i]` for all elements of the containers
+ *
+ * `out` is resized to the size of the operands and may be one of them; its reference has to be
+ * convertible from `get_unit(R1) * get_unit(R2)`.
+ */
+MP_UNITS_EXPORT template<auto R1, typename T, auto R2, auto ROut>
+  requires requires(T v) { (v * (get_unit(R1) * get_unit(R2))).numerical_value_in(get_unit(ROut)); }
+void vector_product(const vector_quantity_soa<R1, T, 3>& lhs, const vector_quantity_soa<R2, T, 3>& rhs,
+                    vector_quantity_soa<ROut, T, 3>& out)
+{
+  MP_UNITS_PRECONDITION(lhs.size() == rhs.size());
+  constexpr auto u = get_unit(R1) * get_unit(R2);
+  const std::size_t count = lhs.size();
+  out.resize(count);
+  const auto a = detail::soa_data(lhs);
+  const auto b = detail::soa_data(rhs);
+  const auto c = detail::soa_data(out);
+  for (std::size_t first = 0; first < count; first += detail::soa_block_size) {
+    const std::size_t n = std::min(detail::soa_block_size, count - first);
+    T res[3][detail::soa_block_size];
+    for (std::size_t i = 0; i < n; ++i) {
+      const std::size_t j = first + i;
+      res[0][i] = a[1][j] * b[2][j] - a[2][j] * b[1][j];
+      res[1][i] = a[2][j] * b[0][j] - a[0][j] * b[2][j];
+      res[2][i] = a[0][j] * b[1][j] - a[1][j] * b[0][j];
+    }
+    for (std::size_t axis = 0; axis < 3; ++axis)
+      for (std::size_t i = 0; i < n; ++i)
+        c[axis][first + i] = (res[axis][i] * u).numerical_value_in(get_unit(ROut));
+  }
+}
+
+/**
+ * @brief Computes the magnitudes `|in[i]|` for all elements of the container
+ *
+ * The magnitudes are computed as the square roots of the sums of the squared coordinates; only the
+ * elements for which that sum overflows or underflows are recomputed with `hypot`.
+ *
+ * @note The core `magnitude` customization point object hides this overload from an unqualified
+ *       call made under `using namespace mp_units;`, so call it as `utility::magnitude(in, out)`.
+ */
+MP_UNITS_EXPORT template<auto R, typename T, std::size_t N, typename To, std::size_t M>
+  requires requires(To& out, T v) { out = v * get_unit(R); }
+void magnitude(const vector_quantity_soa<R, T, N>& in, std::span<To, M> out)
+{
+  MP_UNITS_PRECONDITION(in.size() <= out.size());
+  const std::size_t count = in.size();
+  const auto c = detail::soa_data(in);
+  for (std::size_t first = 0; first < count; first += detail::soa_block_size) {
+    const std::size_t n = std::min(detail::soa_block_size, count - first);
+    T norms[detail::soa_block_size];
+    detail::soa_magnitudes(c, first, n, norms);
+    for (std::size_t i = 0; i < n; ++i) out[first + i] = norms[i] * get_unit(R);
+  }
+}
+
+/**
+ * @brief Computes the unit vectors `in[i] / |in[i]|` for all elements of the container
+ *
+ * `out` is resized to the size of `in` and may be `in` itself; its reference has to be
+ * dimensionless (e.g. `one`). The magnitudes are computed as in `magnitude()`.
+ */
+MP_UNITS_EXPORT template<auto R, typename T, std::size_t N, auto ROut>
+  requires requires(T v) { (v * one).numerical_value_in(get_unit(ROut)); }
+void unit_vector(const vector_quantity_soa<R, T, N>& in, vector_quantity_soa<ROut, T, N>& out)
+{
+  const std::size_t count = in.size();
+  out.resize(count);
+  const auto a = detail::soa_data(in);
+  const auto c = detail::soa_data(out);
+  for (std::size_t first = 0; first < count; first += detail::soa_block_size) {
+    const std::size_t n = std::min(detail::soa_block_size, count - first);
+    T inv[detail::soa_block_size];
+    detail::soa_magnitudes(a, first, n, inv);
+    for (std::size_t i = 0; i < n; ++i) inv[i] = T{1} / inv[i];
+    for (std::size_t axis = 0; axis < N; ++axis)
+      for (std::size_t i = 0; i < n; ++i)
+        c[axis][first + i] = (a[axis][first + i] * inv[i] * one).numerical_value_in(get_unit(ROut));
+  }
+}
+
+}  // namespace mp_units::utility
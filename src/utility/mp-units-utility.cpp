@@ -23,10 +23,15 @@
 module;
 
 #include <mp-units/bits/core_gmf.h>
-// Needed only by this component (utility/random.h); keeping it out of the shared GMF keeps every
-// other component's BMI from serializing a library it never uses.
+// Needed only by this component (utility/monte_carlo.h, utility/random.h, utility/sharded_counter.h,
+// utility/vector_quantity_soa.h); keeping them out of the shared GMF keeps every other component's
+// BMI from serializing a library it never uses.
 #if MP_UNITS_HOSTED && !defined(MP_UNITS_IMPORT_STD)
+#include <algorithm>
+#include <exception>
 #include <random>
+#include <thread>
+#include <vector>
 #endif
 
 export module mp_units.utility;
@@ -42,8 +47,17 @@ import std;
 #if MP_UNITS_HOSTED
 #include <mp-units/utility/cartesian_tensor.h>
 #include <mp-units/utility/cartesian_vector.h>
+#include <mp-units/utility/correlated_uncertain.h>
+#include <mp-units/utility/diagonal_cartesian_tensor.h>
+#include <mp-units/utility/dimensioned_matrix.h>
+#include <mp-units/utility/lazy_quantity.h>
+#include <mp-units/utility/monte_carlo.h>
 #include <mp-units/utility/polar_vector.h>
 #include <mp-units/utility/random.h>
+#include <mp-units/utility/sharded_counter.h>
 #include <mp-units/utility/spherical_vector.h>
+#include <mp-units/utility/symmetric_cartesian_tensor.h>
 #include <mp-units/utility/uncertain.h>
+#include <mp-units/utility/uncertain_array.h>
+#include <mp-units/utility/vector_quantity_soa.h>
 #endif
@@ -25,6 +25,9 @@
 import std;
 #else
 #include <atomic>
+#include <cstdint>
+#include <thread>
+#include <vector>
 #endif
 #ifdef MP_UNITS_MODULES
 import mp_units;
@@ -42,3 +45,98 @@ TEST_CASE("std::atomic works with dimensioned types", "[atomic][assignment]")
   const std::atomic<quantity<isq::area[m2]>> a2 = 3.0 * isq::area[m2];
   REQUIRE(a1.load() == a2.load());
 }
+
+static_assert(std::atomic<quantity<si::metre, int>>::is_always_lock_free == std::atomic<int>::is_always_lock_free);
+static_assert(std::atomic<quantity<si::metre>>::is_always_lock_free == std::atomic<double>::is_always_lock_free);
+static_assert(sizeof(std::atomic<quantity<si::metre, std::int64_t>>) == sizeof(std::atomic<std::int64_t>));
+
+// only quantities implicitly convertible to the stored one are accepted
+template<typename A, typename Q>
+concept FetchAddable = requires(A& a, Q q) { a.fetch_add(q); };
+static_assert(FetchAddable<std::atomic<quantity<si::metre, int>>, quantity<si::kilo<si::metre>, int>>);
+static_assert(!FetchAddable<std::atomic<quantity<si::kilo<si::metre>, int>>, quantity<si::metre, int>>);
+static_assert(!FetchAddable<std::atomic<quantity<si::metre, int>>, quantity<si::second, int>>);
+static_assert(!FetchAddable<std::atomic<quantity<si::metre, int>>, int>);
+
+TEST_CASE("std::atomic<quantity> arithmetic", "[atomic][arithmetic]")
+{
+  SECTION("integral representation")
+  {
+    std::atomic<quantity<si::metre, int>> a = 10 * m;
+    REQUIRE(a.fetch_add(5 * m) == 10 * m);
+    REQUIRE(a.load() == 15 * m);
+    REQUIRE(a.fetch_sub(3 * m) == 15 * m);
+    REQUIRE(a.load() == 12 * m);
+    REQUIRE((a += 2 * km) == 2012 * m);
+    REQUIRE((a -= 12 * m) == 2000 * m);
+    REQUIRE(a.exchange(1 * m) == 2 * km);
+    REQUIRE(a.load() == 1 * m);
+  }
+
+  SECTION("floating-point representation")
+  {
+    std::atomic<quantity<isq::time[s]>> a = 1.5 * isq::time[s];
+    REQUIRE(a.fetch_add(500. * isq::time[ms]) == 1.5 * isq::time[s]);
+    REQUIRE(a.load() == 2. * isq::time[s]);
+    REQUIRE(a.fetch_sub(0.5 * isq::time[s]) == 2. * isq::time[s]);
+    REQUIRE((a += 1. * isq::time[s]) == 2.5 * isq::time[s]);
+    REQUIRE((a -= 2.5 * isq::time[s]) == 0. * isq::time[s]);
+  }
+
+  SECTION("compare_exchange")
+  {
+    std::atomic<quantity<si::metre, int>> a = 1 * m;
+    quantity expected = 2 * m;
+    REQUIRE_FALSE(a.compare_exchange_strong(expected, 3 * m));
+    REQUIRE(expected == 1 * m);
+    REQUIRE(a.compare_exchange_strong(expected, 3 * m));
+    REQUIRE(a.load() == 3 * m);
+  }
+}
+
+TEST_CASE("std::atomic<quantity> concurrent accumulation", "[atomic][threads]")
+{
+  constexpr int threads = 4;
+  constexpr int iterations = 10'000;
+  std::atomic<quantity<si::milli<si::second>, std::int64_t>> total{};
+  std::atomic<quantity<si::joule>> energy{};
+
+  std::vector<std::thread> workers;
+  for (int t = 0; t < threads; ++t)
+    workers.emplace_back([&] {
+      for (int i = 0; i < iterations; ++i) {
+        total.fetch_add(std::int64_t{1} * s, std::memory_order_relaxed);
+        energy += 0.5 * J;
+      }
+    });
+  for (auto& w : workers) w.join();
+
+  REQUIRE(total.load() == std::int64_t{threads * iterations} * s);
+  REQUIRE(energy.load() == threads * iterations * 0.5 * J);
+}
+
+#if __cpp_lib_atomic_ref
+
+TEST_CASE("std::atomic_ref<quantity> arithmetic", "[atomic][atomic_ref]")
+{
+  std::vector<quantity<si::metre, int>> distances(3, 0 * m);
+  const std::atomic_ref<quantity<si::metre, int>> ref(distances[1]);
+  REQUIRE(ref.fetch_add(1 * km) == 0 * m);
+  REQUIRE((ref += 20 * m) == 1020 * m);
+  REQUIRE(ref.fetch_sub(20 * m) == 1020 * m);
+  REQUIRE(distances[1] == 1 * km);
+  REQUIRE(distances[0] == 0 * m);
+  REQUIRE(distances[2] == 0 * m);
+
+  std::vector<quantity<si::second>> durations(1, 0. * s);
+  std::vector<std::thread> workers;
+  for (int t = 0; t < 4; ++t)
+    workers.emplace_back([&] {
+      const std::atomic_ref<quantity<si::second>> d(durations[0]);
+      for (int i = 0; i < 1000; ++i) d += 1. * s;
+    });
+  for (auto& w : workers) w.join();
+  REQUIRE(durations[0] == 4000. * s);
+}
+
+#endif
@@ -28,7 +28,10 @@
 #ifdef MP_UNITS_IMPORT_STD
 import std;
 #else
+#include <cstddef>
+#include <span>
 #include <stdexcept>
+#include <vector>
 #endif
 
 using namespace mp_units;
@@ -159,4 +162,171 @@ TEST_CASE("check_non_negative propagates through relative_point_origin - mutatin
   }
 }
 
+// ============================================================================
+// Batch enforcement over spans — the floating-point kernels used at runtime must
+// agree with the per-element policies.
+// ============================================================================
+
+TEST_CASE("batch wrap_to_range matches the scalar policy", "[bounded][batch]")
+{
+  const wrap_to_range policy{-180.0 * deg, 180.0 * deg};
+  std::vector<quantity<deg, double>> values;
+  for (int i = -1000; i <= 1000; ++i) values.push_back(0.5 * i * deg);
+  std::vector<quantity<deg, double>> expected;
+  for (auto v : values) expected.push_back(policy(v));
+
+  policy(std::span{values});
+  for (std::size_t i = 0; i < values.size(); ++i) {
+    CHECK(values[i] >= -180.0 * deg);
+    CHECK(values[i] < 180.0 * deg);
+    CHECK(values[i] == expected[i]);
+  }
+}
+
+TEST_CASE("batch reflect_in_range matches the scalar policy", "[bounded][batch]")
+{
+  const reflect_in_range policy{-90.0 * deg, 90.0 * deg};
+  std::vector<double> raw;
+  for (int i = -1000; i <= 1000; ++i) raw.push_back(0.5 * i);
+  std::vector<quantity<deg, double>> expected;
+  for (double v : raw) expected.push_back(policy(v * deg));
+
+  policy(std::span{raw}, deg);
+  for (std::size_t i = 0; i < raw.size(); ++i) CHECK(raw[i] * deg == expected[i]);
+}
+
+TEST_CASE("batch check_in_range reports the first violating element", "[bounded][batch][check]")
+{
+  using safe_double = constrained<double, throw_policy>;
+  std::vector<quantity<test_angle_check[deg], safe_double>> values(8, safe_double{0.0} * test_angle_check[deg]);
+
+  CHECK(enforce_bounds<check_origin>(std::span{values}) == values.size());
+
+  values[5] = safe_double{95.0} * test_angle_check[deg];
+  values[6] = safe_double{-95.0} * test_angle_check[deg];
+  CHECK_THROWS_AS(enforce_bounds<check_origin>(std::span{values}), std::domain_error);
+
+  std::vector<double> raw = {0.0, 10.0, 91.0, -91.0};
+  CHECK(check_in_range{-90.0 * deg, 90.0 * deg}.operator()(std::span<const double>{raw}, deg) == 2);
+}
+
+TEST_CASE("batch enforcement through a relative origin", "[bounded][batch][non_negative]")
+{
+  std::vector<quantity<avg_height_qs[m], constrained<double, throw_policy>>> heights = {
+    -1700.0 * avg_height_qs[m], 0.0 * avg_height_qs[m], 250.0 * avg_height_qs[m]};
+  CHECK(enforce_bounds<average_height_origin>(std::span{heights}) == heights.size());
+  CHECK(heights[0].numerical_value_in(m) == -1700.0);
+
+  heights[1] = -1800.0 * avg_height_qs[m];
+  CHECK_THROWS_AS(enforce_bounds<average_height_origin>(std::span{heights}), std::domain_error);
+}
+
+// ============================================================================
+// deferred_bounds — enforcement happens on reads, the violation count on materialization
+// ============================================================================
+
+namespace {
+
+QUANTITY_SPEC(test_angle_deferred, isq::angular_measure);
+
+inline constexpr struct deferred_check_origin final :
+    absolute_point_origin<test_angle_deferred, deferred_bounds{check_in_range{-90 * deg, 90 * deg}}> {
+} deferred_check_origin;
+
+inline constexpr struct deferred_wrap_origin final :
+    absolute_point_origin<test_angle_deferred, deferred_bounds{wrap_to_range{-180 * deg, 180 * deg}}> {
+} deferred_wrap_origin;
+
+using qp_deferred_check = quantity_point<test_angle_deferred[deg], deferred_check_origin, safe_double>;
+using qp_deferred_wrap = quantity_point<test_angle_deferred[deg], deferred_wrap_origin, double>;
+
+}  // namespace
+
+TEST_CASE("deferred check_in_range throws when the value is read", "[bounded][deferred][check]")
+{
+  deferred_bounds_stats<deferred_check_origin>::reset();
+
+  qp_deferred_check pt(safe_double{80.0} * test_angle_deferred[deg], deferred_check_origin);
+  CHECK_NOTHROW(pt += safe_double{20.0} * test_angle_deferred[deg]);
+  CHECK_NOTHROW(pt -= safe_double{5.0} * test_angle_deferred[deg]);
+  CHECK(deferred_bounds_stats<deferred_check_origin>::violations() == 0);
+
+  CHECK_THROWS_AS((void)pt.quantity_from(deferred_check_origin), std::domain_error);
+  CHECK_THROWS_AS((void)(pt == pt), std::domain_error);
+  CHECK(deferred_bounds_stats<deferred_check_origin>::violations() == 0);
+  CHECK_THROWS_AS(enforce_bounds(pt), std::domain_error);
+  CHECK(deferred_bounds_stats<deferred_check_origin>::violations() == 1);
+
+  pt -= safe_double{10.0} * test_angle_deferred[deg];
+  CHECK(pt.quantity_from(deferred_check_origin).numerical_value_in(deg) == 85.0);
+  CHECK_NOTHROW(enforce_bounds(pt));
+  CHECK(deferred_bounds_stats<deferred_check_origin>::violations() == 1);
+}
+
+TEST_CASE("deferred wrap_to_range counts the values it had to wrap", "[bounded][deferred]")
+{
+  deferred_bounds_stats<deferred_wrap_origin>::reset();
+
+  qp_deferred_wrap pt(0.0 * deg, deferred_wrap_origin);
+  for (int i = 0; i < 100; ++i) pt += 10.0 * deg;
+  CHECK(pt.quantity_ref_from(deferred_wrap_origin) == 1000.0 * deg);
+  CHECK(deferred_bounds_stats<deferred_wrap_origin>::violations() == 0);
+
+  CHECK(pt.quantity_from(deferred_wrap_origin) == -80.0 * deg);
+  CHECK(enforce_bounds(pt).quantity_ref_from(deferred_wrap_origin) == -80.0 * deg);
+  qp_deferred_wrap at_max(180.0 * deg, deferred_wrap_origin);
+  CHECK(enforce_bounds(at_max).quantity_ref_from(deferred_wrap_origin) == -180.0 * deg);
+  qp_deferred_wrap inside(90.0 * deg, deferred_wrap_origin);
+  CHECK(enforce_bounds(inside).quantity_ref_from(deferred_wrap_origin) == 90.0 * deg);
+  CHECK(deferred_bounds_stats<deferred_wrap_origin>::violations() == 2);
+
+#if MP_UNITS_API_BOUNDS_AUDIT
+  CHECK(deferred_bounds_stats<deferred_wrap_origin>::elided_checks() == 103);
+#else
+  CHECK(deferred_bounds_stats<deferred_wrap_origin>::elided_checks() == 0);
+#endif
+}
+
+TEST_CASE("deferred violations are counted once per materialization, not per read", "[bounded][deferred]")
+{
+  deferred_bounds_stats<deferred_wrap_origin>::reset();
+
+  qp_deferred_wrap pt(190.0 * deg, deferred_wrap_origin);
+  const qp_deferred_wrap other(0.0 * deg, deferred_wrap_origin);
+  for (int i = 0; i < 3; ++i) {
+    CHECK(pt.quantity_from(deferred_wrap_origin) == -170.0 * deg);
+    CHECK(pt < other);
+    CHECK(pt - other == -170.0 * deg);
+    CHECK(pt.in(rad).quantity_from(deferred_wrap_origin) < 0.0 * rad);
+    const qp_deferred_wrap copy = pt;
+    CHECK(copy == pt);
+  }
+  CHECK(deferred_bounds_stats<deferred_wrap_origin>::violations() == 0);
+
+  enforce_bounds(pt);
+  CHECK(deferred_bounds_stats<deferred_wrap_origin>::violations() == 1);
+  enforce_bounds(pt);
+  CHECK(pt.quantity_from(deferred_wrap_origin) == -170.0 * deg);
+  CHECK(deferred_bounds_stats<deferred_wrap_origin>::violations() == 1);
+}
+
+TEST_CASE("batch enforcement counts the violations of deferred bounds", "[bounded][deferred][batch]")
+{
+  deferred_bounds_stats<deferred_wrap_origin>::reset();
+
+  // more than one block of the batch kernel
+  std::vector<quantity<test_angle_deferred[deg], double>> values(150, 0.0 * test_angle_deferred[deg]);
+  values[3] = 370.0 * test_angle_deferred[deg];
+  values[70] = 180.0 * test_angle_deferred[deg];
+  values[149] = -190.0 * test_angle_deferred[deg];
+  enforce_bounds<deferred_wrap_origin>(std::span{values});
+  CHECK(values[3] == 10.0 * test_angle_deferred[deg]);
+  CHECK(values[70] == -180.0 * test_angle_deferred[deg]);
+  CHECK(values[149] == 170.0 * test_angle_deferred[deg]);
+  CHECK(deferred_bounds_stats<deferred_wrap_origin>::violations() == 3);
+
+  enforce_bounds<deferred_wrap_origin>(std::span{values});
+  CHECK(deferred_bounds_stats<deferred_wrap_origin>::violations() == 3);
+}
+
 #endif  // MP_UNITS_HOSTED
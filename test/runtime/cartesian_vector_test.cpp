@@ -29,6 +29,7 @@
 import std;
 #else
 #include <complex>
+#include <limits>
 #include <sstream>
 #endif
 #ifdef MP_UNITS_MODULES
@@ -599,3 +600,43 @@ TEST_CASE("cartesian_vector embed/project between 2D and 3D", "[vector]")
     REQUIRE(project(embed(utility::cartesian_vector{1.0, 2.0})) == utility::cartesian_vector{1.0, 2.0});
   }
 }
+
+// `float`/`double` vectors are stored in whole, aligned SIMD lanes; the padding lane is always `+0`
+static_assert(sizeof(utility::cartesian_vector<double, 3>) == 4 * sizeof(double));
+static_assert(alignof(utility::cartesian_vector<double, 3>) == 4 * sizeof(double));
+static_assert(alignof(utility::cartesian_vector<float, 2>) == 2 * sizeof(float));
+static_assert(sizeof(utility::cartesian_vector<int, 3>) == 3 * sizeof(int));
+
+TEST_CASE("cartesian_vector SIMD lanes", "[vector]")
+{
+  using v3 = utility::cartesian_vector<double, 3>;
+  constexpr double inf = std::numeric_limits<double>::infinity();
+
+  SECTION("padding lane stays zero")
+  {
+    const v3 v{1.0, -2.0, 3.0};
+    REQUIRE(v._coordinates_[3] == 0.0);
+    REQUIRE((-v)._coordinates_[3] == 0.0);
+    REQUIRE((v * inf)._coordinates_[3] == 0.0);
+    REQUIRE((v / 0.0)._coordinates_[3] == 0.0);
+    REQUIRE(vector_product(v, v3{4.0, 5.0, 6.0})._coordinates_[3] == 0.0);
+    v3 w = v;
+    w += v;
+    w -= v3{0.5, 0.5, 0.5};
+    REQUIRE(w._coordinates_[3] == 0.0);
+    REQUIRE(w == v3{1.5, -4.5, 5.5});
+  }
+
+  SECTION("scalar product ignores the padding")
+  {
+    REQUIRE(scalar_product(v3{0.0, 0.0, inf}, v3{1.0, 2.0, 3.0}) == inf);
+    REQUIRE(scalar_product(utility::cartesian_vector{1.f, 2.f}, utility::cartesian_vector{3.f, 4.f}) == 11.f);
+  }
+
+  SECTION("norm does not overflow or underflow")
+  {
+    REQUIRE_THAT(v3(3e200, 4e200, 0.0).norm(), WithinULP(5e200, 1));
+    REQUIRE_THAT(v3(3e-200, 4e-200, 0.0).norm(), WithinULP(5e-200, 1));
+    REQUIRE(v3{}.norm() == 0.0);
+  }
+}
@@ -0,0 +1,253 @@
+// The MIT License (MIT)
+//
+// Copyright (c) 2018 Mateusz Pusz
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+
+#include <catch2/catch_test_macros.hpp>
+#include <catch2/matchers/catch_matchers_floating_point.hpp>
+#include <mp-units/compat_macros.h>
+#include <mp-units/ext/format.h>
+#ifdef MP_UNITS_IMPORT_STD
+import std;
+#else
+#include <cmath>
+#include <cstddef>
+#include <numbers>
+#include <sstream>
+#include <type_traits>
+#include <vector>
+#endif
+#ifdef MP_UNITS_MODULES
+import mp_units;
+#else
+#include <mp-units/systems/iau.h>
+#include <mp-units/systems/si.h>
+#include <mp-units/utility/correlated_uncertain.h>
+#endif
+
+using namespace mp_units;
+using namespace mp_units::si::unit_symbols;
+using namespace Catch::Matchers;
+using mp_units::utility::correlated_uncertain;
+using mp_units::utility::uncertain;
+using mp_units::utility::uncertainty_source;
+
+TEST_CASE("correlated_uncertain observers", "[correlated_uncertain]")
+{
+  const correlated_uncertain val{10.0, 0.1};
+  CHECK(val.value() == 10.0);
+  CHECK(val.uncertainty() == 0.1);
+  CHECK_THAT(val.variance(), WithinRel(0.01));
+  CHECK_THAT(val.relative_uncertainty(), WithinRel(0.01));
+  CHECK_THAT(val.lower_bound(), WithinRel(9.9));
+  CHECK_THAT(val.upper_bound(), WithinRel(10.1));
+  REQUIRE(val.components().size() == 1);
+  CHECK(val.component_of(val.components()[0].source) == 0.1);
+  CHECK(val.component_of(uncertainty_source{42}) == 0.0);
+
+  const correlated_uncertain<double> exact = 5.0;
+  CHECK(exact.uncertainty() == 0.0);
+  CHECK(exact.components().empty());
+
+  const auto collapsed = static_cast<uncertain<double>>(val);
+  CHECK(collapsed.value() == 10.0);
+  CHECK(collapsed.uncertainty() == 0.1);
+}
+
+TEST_CASE("uncertainty sources", "[correlated_uncertain]")
+{
+  CHECK(uncertainty_source{} == uncertainty_source{0});
+  CHECK(uncertainty_source{7} != uncertainty_source{8});
+
+  const uncertainty_source first = uncertainty_source::unique();
+  const uncertainty_source second = uncertainty_source::unique();
+  CHECK(first != second);
+  CHECK(first.id() > uncertainty_source::max_named_id);
+  CHECK(second.id() > uncertainty_source::max_named_id);
+}
+
+TEST_CASE("correlated_uncertain matches uncertain for independent values", "[correlated_uncertain]")
+{
+  const correlated_uncertain lhs{3.0, 0.3};
+  const correlated_uncertain rhs{4.0, 0.4};
+  const uncertain ulhs{3.0, 0.3};
+  const uncertain urhs{4.0, 0.4};
+
+  CHECK_THAT((lhs + rhs).uncertainty(), WithinRel((ulhs + urhs).uncertainty()));
+  CHECK_THAT((lhs - rhs).uncertainty(), WithinRel((ulhs - urhs).uncertainty()));
+  CHECK_THAT((lhs * rhs).uncertainty(), WithinRel((ulhs * urhs).uncertainty()));
+  CHECK_THAT((lhs / rhs).uncertainty(), WithinRel((ulhs / urhs).uncertainty()));
+  CHECK_THAT(atan2(lhs, rhs).uncertainty(), WithinRel(atan2(ulhs, urhs).uncertainty()));
+  CHECK_THAT((lhs * 2.0).uncertainty(), WithinRel(0.6));
+  CHECK_THAT((2.0 * lhs).uncertainty(), WithinRel(0.6));
+  CHECK_THAT((lhs / 2.0).uncertainty(), WithinRel(0.15));
+  CHECK_THAT((12.0 / rhs).uncertainty(), WithinRel((12.0 / urhs).uncertainty()));
+  CHECK(covariance(lhs, rhs) == 0.0);
+}
+
+TEST_CASE("correlated_uncertain tracks correlations", "[correlated_uncertain]")
+{
+  const correlated_uncertain x{3.0, 0.3};
+
+  SECTION("a value minus itself is exact")
+  {
+    const auto res = x - x;
+    CHECK(res.value() == 0.0);
+    CHECK(res.uncertainty() == 0.0);
+    CHECK(res.components().empty());
+  }
+
+  SECTION("a value divided by itself is exact")
+  {
+    const auto res = x / x;
+    CHECK(res.value() == 1.0);
+    CHECK(res.uncertainty() == 0.0);
+  }
+
+  SECTION("a value plus itself adds linearly")
+  {
+    CHECK_THAT((x + x).uncertainty(), WithinRel(0.6));
+    CHECK_THAT((x * x).uncertainty(), WithinRel(2.0 * 3.0 * 0.3));
+    CHECK_THAT((x * x).uncertainty(), WithinRel(pow(x, 2.0).uncertainty()));
+  }
+
+  SECTION("a shared source correlates separately constructed values")
+  {
+    // two readings with one calibrated instrument share its calibration error
+    const uncertainty_source calibration{1};
+    const correlated_uncertain a{10.0, 0.2, calibration};
+    const correlated_uncertain b{12.0, 0.2, calibration};
+    CHECK_THAT((b - a).value(), WithinRel(2.0));
+    CHECK((b - a).uncertainty() == 0.0);
+    CHECK_THAT(correlation(a, b), WithinRel(1.0));
+
+    const auto readings_a = a + correlated_uncertain{0.0, 0.1};
+    const auto readings_b = b + correlated_uncertain{0.0, 0.1};
+    CHECK_THAT((readings_b - readings_a).uncertainty(), WithinRel(std::hypot(0.1, 0.1)));
+    CHECK_THAT(covariance(readings_a, readings_b), WithinRel(0.04));
+    CHECK_THAT(correlation(readings_a, readings_b), WithinRel(0.04 / 0.05));
+  }
+
+  SECTION("math functions keep the sign of the derivative")
+  {
+    CHECK_THAT((tan(x) - sin(x) / cos(x)).uncertainty(), WithinAbs(0.0, 1e-15));
+    CHECK_THAT((exp(log(x)) - x).uncertainty(), WithinAbs(0.0, 1e-15));
+    CHECK_THAT((sqrt(x) * sqrt(x) - x).uncertainty(), WithinAbs(0.0, 1e-15));
+    CHECK_THAT((cbrt(x) * cbrt(x) * cbrt(x) - x).uncertainty(), WithinAbs(0.0, 1e-15));
+    CHECK_THAT((abs(-x) - x).uncertainty(), WithinAbs(0.0, 1e-15));
+
+    const correlated_uncertain s{0.5, 0.01};
+    CHECK_THAT((asin(s) + acos(s)).uncertainty(), WithinAbs(0.0, 1e-15));
+    CHECK_THAT((asin(s) + acos(s)).value(), WithinRel(std::numbers::pi / 2));
+    CHECK_THAT((sin(x) * sin(x) + cos(x) * cos(x)).uncertainty(), WithinAbs(0.0, 1e-15));
+    CHECK_THAT((log10(x) - log(x) / std::numbers::ln10).uncertainty(), WithinAbs(0.0, 1e-15));
+    CHECK_THAT((log2(x) - log(x) / std::numbers::ln2).uncertainty(), WithinAbs(0.0, 1e-15));
+    CHECK_THAT((atan(x) - atan2(x, correlated_uncertain<double>{1.0})).uncertainty(), WithinAbs(0.0, 1e-15));
+  }
+
+  SECTION("a ratio of correlated values is derived from its components")
+  {
+    // y = 2x + e with an independent error e: y/x depends on x only through the independent part
+    const correlated_uncertain e{0.0, 0.1};
+    const auto y = 2.0 * x + e;
+    const auto ratio = y / x;
+    CHECK_THAT(ratio.value(), WithinRel(2.0));
+    CHECK_THAT(ratio.uncertainty(), WithinRel(0.1 / 3.0));
+  }
+}
+
+TEST_CASE("correlated_uncertain storage", "[correlated_uncertain]")
+{
+  constexpr std::size_t capacity = correlated_uncertain<double>::inline_capacity;
+
+  std::vector<correlated_uncertain<double>> inputs;
+  for (std::size_t i = 0; i < 2 * capacity; ++i) inputs.emplace_back(1.0, 0.1);
+
+  correlated_uncertain<double> sum;
+  for (const auto& in : inputs) sum = sum + in;
+  CHECK(sum.components().size() == 2 * capacity);
+  CHECK_THAT(sum.uncertainty(), WithinRel(0.1 * std::sqrt(2.0 * capacity)));
+
+  // the components stay ordered by source, so lookups and merges work past the inline capacity
+  for (std::size_t i = 1; i < sum.components().size(); ++i)
+    CHECK(sum.components()[i - 1].source < sum.components()[i].source);
+  CHECK(sum.component_of(inputs.back().components()[0].source) == 0.1);
+
+  // cancelling back below the inline capacity drops the cancelled components
+  correlated_uncertain<double> rest = sum;
+  for (std::size_t i = 0; i < capacity + 1; ++i) rest = rest - inputs[i];
+  CHECK(rest.components().size() == capacity - 1);
+  CHECK_THAT(rest.uncertainty(), WithinRel(0.1 * std::sqrt(capacity - 1.0)));
+
+  const correlated_uncertain<double> copy = sum;
+  CHECK(copy == sum);
+  CHECK((sum - copy).uncertainty() == 0.0);
+}
+
+TEST_CASE("correlated_uncertain as a quantity representation type", "[correlated_uncertain]")
+{
+  const quantity length = correlated_uncertain{10.0, 0.1} * m;
+  const quantity width = correlated_uncertain{5.0, 0.05} * m;
+
+  SECTION("arithmetic propagates through quantities")
+  {
+    const quantity area = length * width;
+    CHECK(area.numerical_value_in(m2).value() == 50.0);
+    CHECK_THAT(area.numerical_value_in(m2).uncertainty(), WithinRel(50.0 * std::hypot(0.01, 0.01)));
+
+    const quantity perimeter = 2 * length + 2 * width;
+    CHECK_THAT(perimeter.numerical_value_in(m).uncertainty(), WithinRel(2.0 * std::hypot(0.1, 0.05)));
+    CHECK((length - length).numerical_value_in(m).uncertainty() == 0.0);
+  }
+
+  SECTION("unit conversion scales the components and keeps the correlation")
+  {
+    const quantity in_mm = length.in(mm);
+    CHECK(in_mm.numerical_value_in(mm).value() == 10'000.0);
+    CHECK_THAT(in_mm.numerical_value_in(mm).uncertainty(), WithinRel(100.0));
+    CHECK_THAT((in_mm - length).numerical_value_in(mm).uncertainty(), WithinAbs(0.0, 1e-9));
+  }
+
+  SECTION("an exact quantity joins propagation as value ± 0")
+  {
+    const quantity total = length + 5.0 * m;
+    CHECK(total.numerical_value_in(m).value() == 15.0);
+    CHECK_THAT(total.numerical_value_in(m).uncertainty(), WithinRel(0.1));
+  }
+
+  SECTION("a measured conversion factor is folded in as a new source")
+  {
+    const quantity mass = correlated_uncertain{2.0, 0.1} * iau::solar_mass;
+    const auto in_kg = mass.in(kg).numerical_value_in(kg);
+    CHECK(in_kg.components().size() == 2);
+    CHECK_THAT(in_kg.relative_uncertainty(), WithinRel(std::hypot(0.05, 1.5e-15 / 6.6743e-11)));
+  }
+}
+
+TEST_CASE("correlated_uncertain text output", "[correlated_uncertain]")
+{
+  std::ostringstream os;
+  os << correlated_uncertain{2.5, 0.25};
+  CHECK(os.str() == "2.5 ± 0.25");
+
+  CHECK(MP_UNITS_STD_FMT::format("{}", correlated_uncertain{2.5, 0.25}) == "2.5 ± 0.25");
+  CHECK(MP_UNITS_STD_FMT::format("{}", correlated_uncertain{2.5, 0.25} * m) == "2.5 ± 0.25 m");
+  CHECK(MP_UNITS_STD_FMT::format("{:~}", correlated_uncertain{23.4782, 0.0032}) == "23.4782(32)");
+}
@@ -0,0 +1,121 @@
+// The MIT License (MIT)
+//
+// Copyright (c) 2018 Mateusz Pusz
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+
+#include <catch2/catch_test_macros.hpp>
+#include <mp-units/compat_macros.h>
+#include <mp-units/ext/format.h>
+#ifdef MP_UNITS_IMPORT_STD
+import std;
+#else
+#include <cmath>
+#include <limits>
+#include <sstream>
+#endif
+#ifdef MP_UNITS_MODULES
+import mp_units;
+#else
+#include <mp-units/utility/diagonal_cartesian_tensor.h>
+#endif
+
+using namespace mp_units;
+using utility::cartesian_tensor;
+using utility::cartesian_vector;
+using utility::diagonal_cartesian_tensor;
+
+static_assert(sizeof(diagonal_cartesian_tensor<double>) == 3 * sizeof(double));
+static_assert(sizeof(diagonal_cartesian_tensor<double, 2>) == 2 * sizeof(double));
+static_assert(std::is_same_v<decltype(diagonal_cartesian_tensor{1., 2.}), diagonal_cartesian_tensor<double, 2>>);
+static_assert(std::is_same_v<decltype(diagonal_cartesian_tensor{1, 2, 3}), diagonal_cartesian_tensor<int, 3>>);
+static_assert(diagonal_cartesian_tensor<double>::extent == 3);
+
+// lossless conversion to the dense tensor is implicit; there is no conversion back
+static_assert(std::convertible_to<diagonal_cartesian_tensor<double>, cartesian_tensor<double>>);
+static_assert(std::convertible_to<diagonal_cartesian_tensor<int>, cartesian_tensor<double>>);
+static_assert(!std::convertible_to<diagonal_cartesian_tensor<double>, cartesian_tensor<int>>);
+static_assert(!std::constructible_from<diagonal_cartesian_tensor<double>, cartesian_tensor<double>>);
+
+TEST_CASE("diagonal_cartesian_tensor operations", "[tensor]")
+{
+  constexpr diagonal_cartesian_tensor d{1., 2., 3.};
+  constexpr cartesian_tensor dense = d;
+  constexpr cartesian_tensor a{1., 2., 3., 4., 5., 6., 7., 8., 9.};
+
+  SECTION("access")
+  {
+    static_assert(d(1, 1) == 2.);
+    static_assert(d(0, 2) == 0.);
+    REQUIRE(dense == cartesian_tensor{1., 0., 0., 0., 2., 0., 0., 0., 3.});
+
+    diagonal_cartesian_tensor<double> m = d;
+    m.diagonal(2) = 4.;
+    REQUIRE(m(2, 2) == 4.);
+  }
+
+  SECTION("off-diagonal components stay zero for infinite ones")
+  {
+    constexpr double inf = std::numeric_limits<double>::infinity();
+    REQUIRE(diagonal_cartesian_tensor{inf, 1., 1.}(0, 1) == 0.);
+  }
+
+  SECTION("arithmetic")
+  {
+    REQUIRE(d + d == diagonal_cartesian_tensor{2., 4., 6.});
+    REQUIRE(d - d == diagonal_cartesian_tensor{0., 0., 0.});
+    REQUIRE(2. * d == diagonal_cartesian_tensor{2., 4., 6.});
+    REQUIRE(d / 2. == diagonal_cartesian_tensor{0.5, 1., 1.5});
+    REQUIRE(-d == diagonal_cartesian_tensor{-1., -2., -3.});
+    diagonal_cartesian_tensor<double> m = d;
+    m += d;
+    m *= 2.;
+    REQUIRE(m == diagonal_cartesian_tensor{4., 8., 12.});
+  }
+
+  SECTION("inner products match the dense ones")
+  {
+    const cartesian_vector v{1., -1., 2.};
+    REQUIRE(inner_product(d, v) == inner_product(dense, v));
+    REQUIRE(inner_product(d, d) == diagonal_cartesian_tensor{1., 4., 9.});
+    REQUIRE(inner_product(d, a) == inner_product(dense, a));
+    REQUIRE(inner_product(a, d) == inner_product(a, dense));
+  }
+
+  SECTION("scalar products match the dense ones")
+  {
+    REQUIRE(scalar_product(d, d) == scalar_product(dense, dense));
+    REQUIRE(scalar_product(d, a) == scalar_product(dense, a));
+    REQUIRE(scalar_product(a, d) == scalar_product(a, dense));
+  }
+
+  SECTION("norm")
+  {
+    REQUIRE(d.norm() == dense.norm());
+    REQUIRE(magnitude(diagonal_cartesian_tensor{3., 4.}) == 5.);
+  }
+
+  SECTION("text output")
+  {
+    std::ostringstream os;
+    os << diagonal_cartesian_tensor{1, 2};
+    REQUIRE(os.str() == "[[1, 0], [0, 2]]");
+    REQUIRE(MP_UNITS_STD_FMT::format("{}", diagonal_cartesian_tensor{1, 2}) == "[[1, 0], [0, 2]]");
+  }
+}
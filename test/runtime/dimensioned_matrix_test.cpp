@@ -0,0 +1,260 @@
+// The MIT License (MIT)
+//
+// Copyright (c) 2018 Mateusz Pusz
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+
+// The build compiles this file once with the built-in array storage only and, when the Eigen
+// integration is available, once more as `dimensioned_matrix_test-eigen` with `MP_UNITS_DM_EIGEN`
+// defined, which adds the test cases of the Eigen storage.
+#ifdef MP_UNITS_DM_EIGEN
+#include <Eigen/Dense>
+#endif
+
+#include <catch2/catch_test_macros.hpp>
+#include <catch2/matchers/catch_matchers_floating_point.hpp>
+#include <mp-units/compat_macros.h>
+#ifdef MP_UNITS_IMPORT_STD
+import std;
+#else
+#include <cstddef>
+#include <type_traits>
+#endif
+#ifdef MP_UNITS_MODULES
+import mp_units;
+#else
+#include <mp-units/systems/isq/space_and_time.h>
+#include <mp-units/systems/si.h>
+#include <mp-units/utility/dimensioned_matrix.h>
+#endif
+
+using namespace mp_units;
+using namespace mp_units::si::unit_symbols;
+using namespace Catch::Matchers;
+using mp_units::utility::dimensioned_matrix;
+using mp_units::utility::dimensioned_vector;
+using mp_units::utility::inverse_typed_index_t;
+using mp_units::utility::typed_index;
+
+namespace {
+
+// a position-velocity state
+using state = typed_index<si::metre, si::metre / si::second>;
+using transition = dimensioned_matrix<state, state>;
+using covariance = dimensioned_matrix<state, inverse_typed_index_t<state>>;
+
+// the entries are derived from the rows and the columns
+static_assert(get_unit(transition::reference<0, 0>) == one);
+static_assert(get_unit(transition::reference<0, 1>) == s);
+static_assert(get_unit(transition::reference<1, 0>) == one / s);
+static_assert(get_unit(covariance::reference<0, 0>) == m * m);
+static_assert(get_unit(covariance::reference<0, 1>) == m * m / s);
+static_assert(get_unit(covariance::reference<1, 1>) == m * m / (s * s));
+
+// the storage is a plain array of numbers
+static_assert(sizeof(covariance) == sizeof(double[2][2]));
+static_assert(std::is_same_v<covariance::storage_type, double[2][2]>);
+static_assert(std::is_trivially_copyable_v<covariance>);
+
+// the results of the operations have the right typed indices
+static_assert(std::is_same_v<decltype(std::declval<transition>() * std::declval<covariance>()), covariance>);
+static_assert(std::is_same_v<decltype(transpose(std::declval<transition>())),
+                             dimensioned_matrix<inverse_typed_index_t<state>, inverse_typed_index_t<state>>>);
+static_assert(std::is_same_v<decltype(std::declval<covariance>() * transpose(std::declval<transition>())), covariance>);
+static_assert(std::is_same_v<decltype(inverse(std::declval<covariance>())),
+                             dimensioned_matrix<inverse_typed_index_t<state>, state>>);
+static_assert(std::is_same_v<decltype(std::declval<transition>() * std::declval<dimensioned_vector<state>>()),
+                             dimensioned_vector<state>>);
+
+// only the matching typed indices can be multiplied or added
+template<typename A, typename B>
+concept multipliable = requires(A a, B b) { a * b; };
+template<typename A, typename B>
+concept addable = requires(A a, B b) { a + b; };
+static_assert(multipliable<transition, covariance>);
+static_assert(!multipliable<covariance, transition>);
+static_assert(!addable<transition, covariance>);
+
+constexpr transition make_transition(quantity<si::second> dt)
+{
+  transition f = transition::identity();
+  f.set<0, 1>(dt);
+  return f;
+}
+
+constexpr covariance make_covariance()
+{
+  covariance p;
+  p.set<0, 0>(4. * m * m);
+  p.set<0, 1>(1. * m * m / s);
+  p.set<1, 0>(1. * m * m / s);
+  p.set<1, 1>(9. * m * m / (s * s));
+  return p;
+}
+
+// everything is usable at compile time
+static_assert((make_transition(2. * s) * make_covariance() * transpose(make_transition(2. * s))).get<0, 0>() ==
+              44. * m * m);
+
+}  // namespace
+
+TEST_CASE("dimensioned_matrix", "[dimensioned_matrix]")
+{
+  SECTION("default construction gives zeros")
+  {
+    const covariance p;
+    CHECK(p.get<0, 1>() == 0. * m * m / s);
+    CHECK(p == covariance{});
+  }
+
+  SECTION("set converts to the unit of the entry")
+  {
+    transition f;
+    f.set<0, 1>(2. * min);
+    f.set<1, 0>(1. / h);
+    CHECK(f(0, 1) == 120.);
+    CHECK_THAT(f(1, 0), WithinRel(1. / 3600.));
+    CHECK(f.get<0, 1>() == 120. * s);
+  }
+
+  SECTION("identity")
+  {
+    const transition i = transition::identity();
+    CHECK(i.get<0, 0>() == 1. * one);
+    CHECK(i.get<1, 1>() == 1. * one);
+    CHECK(i.get<0, 1>() == 0. * s);
+  }
+
+  SECTION("identity with different units of the rows and the columns")
+  {
+    using mixed = dimensioned_matrix<typed_index<isq::length[m], isq::speed[m / s]>,
+                                     typed_index<isq::length[km], isq::speed[km / h]>>;
+    const mixed i = mixed::identity();
+    CHECK(i(0, 0) == 1000.);
+    CHECK(i.get<0, 0>().numerical_value_in(one) == 1.);
+    const double speed_ratio = i.get<1, 1>().numerical_value_in(one);
+    CHECK_THAT(speed_ratio, WithinRel(1.));
+    CHECK(i(0, 1) == 0.);
+  }
+
+  SECTION("covariance extrapolation F·P·Fᵀ")
+  {
+    const transition f = make_transition(2. * s);
+    const covariance p = make_covariance();
+    const covariance next = f * p * transpose(f);
+    // [[1, 2], [0, 1]] · [[4, 1], [1, 9]] · [[1, 0], [2, 1]]
+    CHECK(next.get<0, 0>() == 44. * m * m);
+    CHECK(next.get<0, 1>() == 19. * m * m / s);
+    CHECK(next.get<1, 0>() == 19. * m * m / s);
+    CHECK(next.get<1, 1>() == 9. * m * m / (s * s));
+  }
+
+  SECTION("matrix times a vector")
+  {
+    dimensioned_vector<state> x;
+    x.set<0, 0>(10. * m);
+    x.set<1, 0>(3. * m / s);
+    const dimensioned_vector<state> next = make_transition(2. * s) * x;
+    CHECK(next.get<0, 0>() == 16. * m);
+    CHECK(next.get<1, 0>() == 3. * m / s);
+  }
+
+  SECTION("addition and subtraction")
+  {
+    const covariance p = make_covariance();
+    const covariance sum = p + p;
+    CHECK(sum.get<1, 1>() == 18. * m * m / (s * s));
+    CHECK(sum - p == p);
+  }
+
+  SECTION("inverse")
+  {
+    const covariance p = make_covariance();
+    const auto p_inv = inverse(p);
+    CHECK_THAT((p_inv.get<0, 0>().numerical_value_in(one / (m * m))), WithinRel(9. / 35.));
+    CHECK_THAT((p_inv.get<0, 1>().numerical_value_in(s / (m * m))), WithinRel(-1. / 35.));
+    const auto i = p * p_inv;
+    CHECK_THAT(i(0, 0), WithinAbs(1., 1e-15));
+    CHECK_THAT(i(0, 1), WithinAbs(0., 1e-15));
+    CHECK_THAT(i(1, 0), WithinAbs(0., 1e-15));
+    CHECK_THAT(i(1, 1), WithinAbs(1., 1e-15));
+  }
+
+  SECTION("inverse pivots on zero diagonal entries")
+  {
+    dimensioned_matrix<state, state> a;
+    a.set<0, 1>(2. * s);
+    a.set<1, 0>(4. / s);
+    const auto a_inv = inverse(a);
+    CHECK(a_inv.get<0, 1>() == 0.25 * s);
+    CHECK(a_inv.get<1, 0>() == 0.5 / s);
+    CHECK(a_inv.get<0, 0>() == 0. * one);
+  }
+}
+
+#ifdef MP_UNITS_DM_EIGEN
+
+namespace {
+
+using eigen_transition = dimensioned_matrix<state, state, Eigen::Matrix2d>;
+using eigen_covariance = dimensioned_matrix<state, inverse_typed_index_t<state>, Eigen::Matrix2d>;
+
+static_assert(std::is_same_v<eigen_covariance::rep, double>);
+static_assert(std::is_same_v<decltype(std::declval<eigen_transition>() * std::declval<eigen_covariance>()),
+                             eigen_covariance>);
+static_assert(std::is_same_v<decltype(inverse(std::declval<eigen_covariance>())),
+                             dimensioned_matrix<inverse_typed_index_t<state>, state, Eigen::Matrix2d>>);
+using eigen_vector = dimensioned_vector<state, Eigen::Vector2d>;
+static_assert(std::is_same_v<decltype(std::declval<eigen_transition>() * std::declval<eigen_vector>()), eigen_vector>);
+static_assert(!multipliable<eigen_transition, covariance>);
+
+template<typename Eigen, typename Array>
+void check_same_numbers(const Eigen& e, const Array& a)
+{
+  for (std::size_t i = 0; i < Array::rows; ++i)
+    for (std::size_t j = 0; j < Array::cols; ++j) CHECK_THAT(e(i, j), WithinRel(a(i, j), 1e-14));
+}
+
+}  // namespace
+
+TEST_CASE("dimensioned_matrix with Eigen storage", "[dimensioned_matrix][eigen]")
+{
+  const transition f = make_transition(2. * s);
+  const covariance p = make_covariance();
+  eigen_transition ef;
+  ef.numerical_values() << 1., 2., 0., 1.;
+  eigen_covariance ep;
+  ep.set<0, 0>(4. * m * m);
+  ep.set<0, 1>(1. * m * m / s);
+  ep.set<1, 0>(1. * m * m / s);
+  ep.set<1, 1>(9. * m * m / (s * s));
+
+  SECTION("default construction gives zeros") { CHECK(eigen_covariance{}.numerical_values().isZero()); }
+
+  SECTION("the operations give the same numbers as the array storage")
+  {
+    check_same_numbers(ef, f);
+    check_same_numbers(ef * ep * transpose(ef), f * p * transpose(f));
+    check_same_numbers(ep + ep, p + p);
+    check_same_numbers(inverse(ep), inverse(p));
+    CHECK((ef * ep * transpose(ef)).get<0, 1>() == 19. * m * m / s);
+  }
+}
+
+#endif
@@ -21,14 +21,18 @@
 // SOFTWARE.
 
 #include <catch2/catch_test_macros.hpp>
+#include <catch2/matchers/catch_matchers_floating_point.hpp>
 #ifdef MP_UNITS_IMPORT_STD
 import std;
 #else
+#include <algorithm>
 #include <array>
+#include <cmath>
 #include <cstddef>
 #include <cstdint>
 #include <initializer_list>
 #include <random>
+#include <span>
 #include <vector>
 #endif
 #ifdef MP_UNITS_MODULES
@@ -660,3 +664,274 @@ TEST_CASE("distributions", "[random][distribution]")
     }
   }
 }
+
+namespace {
+
+struct sample_moments {
+  double mean = 0.;
+  double stddev = 0.;
+};
+
+template<typename Q>
+sample_moments moments_of(const std::vector<Q>& samples)
+{
+  double sum = 0.;
+  for (const Q& q : samples) sum += static_cast<double>(q.numerical_value_in(Q::unit));
+  const double mean = sum / static_cast<double>(samples.size());
+  double m2 = 0.;
+  for (const Q& q : samples) {
+    const double d = static_cast<double>(q.numerical_value_in(Q::unit)) - mean;
+    m2 += d * d;
+  }
+  return {mean, std::sqrt(m2 / static_cast<double>(samples.size() - 1))};
+}
+
+template<typename Q, typename Pred>
+double fraction_of(const std::vector<Q>& samples, Pred pred)
+{
+  return static_cast<double>(std::count_if(samples.begin(), samples.end(), pred)) /
+         static_cast<double>(samples.size());
+}
+
+}  // namespace
+
+TEST_CASE("xoshiro256pp", "[random]")
+{
+  using mp_units::utility::xoshiro256pp;
+
+  SECTION("reference sequence")
+  {
+    xoshiro256pp g(0x5eed);
+    CHECK(g() == 0x8eb2871b24ae0c00);
+    CHECK(g() == 0xfdd2c14d7560f757);
+    CHECK(g() == 0x17460bdf1e7c3333);
+    CHECK(xoshiro256pp{} == xoshiro256pp{xoshiro256pp::default_seed});
+  }
+
+  SECTION("discard and jumps")
+  {
+    xoshiro256pp a(42), b(42);
+    for (int i = 0; i < 10; ++i) (void)a();
+    b.discard(10);
+    CHECK(a == b);
+    b.jump();
+    CHECK(a != b);
+    a.jump();
+    CHECK(a() == b());
+    a.long_jump();
+    CHECK(a != b);
+  }
+
+  SECTION("seed sequence")
+  {
+    std::seed_seq seq{1, 2, 3};
+    xoshiro256pp a(seq);
+    xoshiro256pp b;
+    b.seed(seq);
+    CHECK(a == b);
+    CHECK(a != xoshiro256pp{});
+  }
+
+  SECTION("works with the distributions")
+  {
+    xoshiro256pp g;
+    auto dist = mp_units::utility::uniform_int_distribution(1 * si::metre, 6 * si::metre);
+    for (int i = 0; i < 100; ++i) {
+      const auto q = dist(g);
+      CHECK(q >= 1 * si::metre);
+      CHECK(q <= 6 * si::metre);
+    }
+  }
+}
+
+TEST_CASE("generate", "[random][distribution]")
+{
+  using namespace Catch::Matchers;
+  using mp_units::utility::generate;
+  using mp_units::utility::xoshiro256pp;
+  using q = quantity<isq::length[si::metre]>;
+  constexpr std::size_t n = 1'000'000;
+
+  SECTION("other generators draw the samples one by one")
+  {
+    auto dist = mp_units::utility::normal_distribution<q>(1. * si::metre, 2. * si::metre);
+    std::mt19937_64 g1, g2;
+    std::vector<q> samples(100);
+    generate(dist, g1, samples);
+    for (const q& sample : samples) CHECK(sample == dist(g2));
+
+    auto int_dist = mp_units::utility::poisson_distribution<quantity<si::metre, int>>(4.);
+    std::vector<quantity<si::metre, int>> counts(100);
+    generate(int_dist, g1, counts);
+    CHECK(std::ranges::all_of(counts, [](auto c) { return c >= 0 * si::metre; }));
+  }
+
+  SECTION("uniform_real_distribution")
+  {
+    auto dist = mp_units::utility::uniform_real_distribution<q>(-1. * si::metre, 3. * si::metre);
+    xoshiro256pp g;
+    std::vector<q> samples(n);
+    generate(dist, g, samples);
+    const auto [mean, stddev] = moments_of(samples);
+    CHECK_THAT(mean, WithinAbs(1., 0.01));
+    CHECK_THAT(stddev, WithinRel(4. / std::sqrt(12.), 0.01));
+    CHECK(std::ranges::min(samples) >= -1. * si::metre);
+    CHECK(std::ranges::max(samples) < 3. * si::metre);
+  }
+
+  SECTION("normal_distribution")
+  {
+    auto dist = mp_units::utility::normal_distribution<q>(10. * si::metre, 2. * si::metre);
+    xoshiro256pp g;
+    std::vector<q> samples(n);
+    generate(dist, g, samples);
+    const auto [mean, stddev] = moments_of(samples);
+    CHECK_THAT(mean, WithinAbs(10., 0.01));
+    CHECK_THAT(stddev, WithinRel(2., 0.005));
+
+    const auto beyond = [&](double k) {
+      const q low = (10. - 2. * k) * si::metre;
+      const q high = (10. + 2. * k) * si::metre;
+      return fraction_of(samples, [=](q x) { return x < low || x > high; });
+    };
+    CHECK_THAT(beyond(1.), WithinAbs(0.3173, 0.002));
+    CHECK_THAT(beyond(2.), WithinAbs(0.0455, 0.001));
+    // the tail of the ziggurat starts at 3.654σ
+    CHECK_THAT(beyond(4.), WithinAbs(6.33e-5, 3e-5));
+  }
+
+  SECTION("exponential_distribution")
+  {
+    using t = quantity<isq::duration[si::second]>;
+    auto dist = mp_units::utility::exponential_distribution<t>(0.5);
+    xoshiro256pp g;
+    std::vector<t> samples(n);
+    generate(dist, g, samples);
+    const auto [mean, stddev] = moments_of(samples);
+    CHECK_THAT(mean, WithinRel(2., 0.005));
+    CHECK_THAT(stddev, WithinRel(2., 0.01));
+    CHECK(std::ranges::min(samples) >= 0. * si::second);
+    CHECK_THAT(fraction_of(samples, [](t x) { return x > 2. * si::second; }), WithinAbs(std::exp(-1.), 0.002));
+    // the tail of the ziggurat starts at 7.697 / λ
+    CHECK_THAT(fraction_of(samples, [](t x) { return x > 18. * si::second; }), WithinAbs(std::exp(-9.), 5e-5));
+  }
+
+  SECTION("short spans and float representations")
+  {
+    auto dist = mp_units::utility::normal_distribution<quantity<si::metre, float>>(0.f * si::metre, 1.f * si::metre);
+    xoshiro256pp g;
+    std::vector<quantity<si::metre, float>> samples(10'000);
+    for (std::size_t offset = 0; offset < samples.size(); offset += 100)
+      generate(dist, g, std::span{samples}.subspan(offset, 100));
+    const auto [mean, stddev] = moments_of(samples);
+    CHECK_THAT(mean, WithinAbs(0., 0.05));
+    CHECK_THAT(stddev, WithinRel(1., 0.05));
+  }
+
+  SECTION("reproducible for a given seed")
+  {
+    auto dist = mp_units::utility::normal_distribution<q>(0. * si::metre, 1. * si::metre);
+    xoshiro256pp g1(7), g2(7);
+    std::vector<q> a(5000), b(5000);
+    generate(dist, g1, a);
+    generate(dist, g2, b);
+    CHECK(a == b);
+    CHECK(g1 == g2);
+  }
+}
+
+TEST_CASE("counter-based engines", "[random]")
+{
+  using mp_units::utility::philox4x32;
+  using mp_units::utility::threefry4x64;
+
+  SECTION("known-answer tests")
+  {
+    // the test vectors of the reference implementation, Random123
+    philox4x32 zero(0);
+    CHECK(zero() == 0x6627e8d5);
+    CHECK(zero() == 0xe169c58d);
+    CHECK(zero() == 0xbc57ac4c);
+    CHECK(zero() == 0x9b00dbd8);
+
+    philox4x32 ones(0xffffffffffffffff, 0xffffffffffffffff, 0xffffffffffffffff);
+    CHECK(ones() == 0x408f276d);
+    CHECK(ones() == 0x41c83b0e);
+    CHECK(ones() == 0xa20bc7c6);
+    CHECK(ones() == 0x6d5451fd);
+
+    philox4x32 pi(0x299f31d0a4093822, 0x0370734413198a2e, 0x85a308d3243f6a88);
+    CHECK(pi() == 0xd16cfe09);
+    CHECK(pi() == 0x94fdcceb);
+    CHECK(pi() == 0x5001e420);
+    CHECK(pi() == 0x24126ea1);
+
+    threefry4x64 tf(0);
+    CHECK(tf() == 0x09218ebde6c85537);
+    CHECK(tf() == 0x55941f5266d86105);
+    CHECK(tf() == 0x4bd25e16282434dc);
+    CHECK(tf() == 0xee29ec846bd2e40b);
+  }
+
+  SECTION("random access")
+  {
+    philox4x32 a(42, 7);
+    philox4x32 b(42, 7);
+    for (int i = 0; i < 6; ++i) (void)a();
+    b.discard(3);
+    b.discard(3);
+    CHECK(a == b);
+    CHECK(a() == b());
+    CHECK(a.counter() == 2);
+
+    // 8 results in, the sequence is at the start of block 2
+    philox4x32 c(42, 7, 2);
+    b.discard(1);
+    CHECK(b.counter() == 2);
+    CHECK(b() == c());
+
+    // streams are independent sequences
+    CHECK(philox4x32(42, 7)() != philox4x32(42, 8)());
+    CHECK(threefry4x64(42, 7)() != threefry4x64(42, 8)());
+  }
+
+  SECTION("works with the distributions")
+  {
+    philox4x32 g;
+    auto dist = mp_units::utility::normal_distribution<quantity<si::metre>>(0. * si::metre, 1. * si::metre);
+    std::vector<quantity<si::metre>> samples(100'000);
+    mp_units::utility::generate(dist, g, samples);
+    const auto [mean, stddev] = moments_of(samples);
+    CHECK(std::abs(mean) < 0.02);
+    CHECK(std::abs(stddev - 1.) < 0.02);
+  }
+}
+
+TEST_CASE("parallel_generate", "[random][distribution]")
+{
+  using mp_units::utility::parallel_generate;
+  using mp_units::utility::philox4x32;
+  using q = quantity<isq::length[si::metre]>;
+  auto dist = mp_units::utility::normal_distribution<q>(1. * si::metre, 0.5 * si::metre);
+
+  std::vector<q> reference(100'000);
+  philox4x32 g1(11, 3);
+  parallel_generate(dist, g1, reference, 1);
+
+  for (const std::size_t threads : {2U, 5U, 64U}) {
+    std::vector<q> samples(reference.size());
+    philox4x32 g(11, 3);
+    parallel_generate(dist, g, samples, threads);
+    CHECK(samples == reference);
+    CHECK(g == g1);
+  }
+
+  // the generator continues after the used counters
+  std::vector<q> more(reference.size());
+  parallel_generate(dist, g1, more);
+  CHECK(more != reference);
+
+  const auto [mean, stddev] = moments_of(reference);
+  CHECK(std::abs(mean - 1.) < 0.01);
+  CHECK(std::abs(stddev - 0.5) < 0.01);
+}
@@ -54,6 +54,11 @@
 //    All textual includes above stay before the import, which is the order libstdc++ requires.
 #ifdef MP_UNITS_IMPORT_STD
 import std;
+#else
+#include <array>
+#include <span>
+#include <utility>
+#include <vector>
 #endif
 
 // 3. mp-units and the matching integration adapter. The test is header-mode only (module-mode
@@ -62,6 +67,7 @@ import std;
 #include <mp-units/systems/isq/mechanics.h>
 #include <mp-units/systems/isq/space_and_time.h>
 #include <mp-units/systems/si.h>
+#include <mp-units/utility/lazy_quantity.h>
 #if defined(MP_UNITS_LA_EIGEN)
 #include <mp-units/integrations/eigen.h>
 #elif defined(MP_UNITS_LA_GLM)
@@ -291,6 +297,21 @@ TEST_CASE("linear algebra type as a quantity representation")
     CHECK_THAT(speed.numerical_value_in(km / h), Catch::Matchers::WithinAbs(50.0, 1e-9));
   }
 
+  SECTION("a lazy expression is evaluated once with the units checked at compile time")
+  {
+    const quantity v1 = make_vec3(1, 2, 3) * isq::velocity[m / s];
+    const quantity v2 = make_vec3(36, 72, 108) * isq::velocity[km / h];
+    const quantity dt = 2. * isq::duration[s];
+    const quantity<isq::velocity[m / s], vec3> v = 2. * utility::lazy(v1) + utility::lazy(v2) - utility::lazy(v1) / 2.;
+    CHECK(v == make_vec3(11.5, 23, 34.5) * isq::velocity[m / s]);
+
+    const auto displacement = (utility::lazy(v1) * dt - utility::lazy(v2) * dt).eval();
+    static_assert(std::same_as<decltype(displacement)::rep, vec3>);
+    static_assert(std::convertible_to<decltype(displacement), quantity<isq::displacement[m], vec3>>);
+    CHECK(displacement.numerical_value_in(m) == make_vec3(-18, -36, -54));
+    CHECK((-utility::lazy(v1)).eval() == make_vec3(-1, -2, -3) * isq::velocity[m / s]);
+  }
+
   SECTION("equality of vector quantities")
   {
     const quantity lhs = make_vec3(1, 2, 3) * isq::displacement[km];
@@ -359,3 +380,81 @@ static_assert(cross(make_vec3i(3, 0, 0) * isq::position_vector[m], make_vec3i(0,
                 .numerical_value_in(N * m) == vec3i{0, 0, 30});
 
 #endif  // MP_UNITS_LA_CARTESIAN
+
+#if defined(MP_UNITS_LA_EIGEN)
+
+// `as_eigen_map()` and `as_quantity_span()` view contiguous storage across the quantity/Eigen
+// boundary without copying. They are specific to the Eigen integration.
+
+TEST_CASE("zero-copy views between quantities and Eigen")
+{
+  SECTION("a span of quantities is mapped in place")
+  {
+    std::vector<quantity<si::metre>> d{1. * m, 4. * m, 9. * m};
+    eigen_quantity_view map = as_eigen_map(std::span{d});
+    static_assert(map.reference == si::metre);
+    static_assert(decltype(map)::eigen_type::SizeAtCompileTime == Eigen::Dynamic);
+    CHECK(map.eigen().data() == &d[0].numerical_value_ref_in(m));
+    CHECK(map.size() == 3);
+    CHECK(map[2] == 9. * m);
+
+    map.eigen() *= 2.;
+    CHECK(d[1] == 8. * m);
+  }
+
+  SECTION("a static extent and constness are preserved")
+  {
+    const std::array t{1. * s, 2. * s, 4. * s};
+    const eigen_quantity_view map = as_eigen_map(std::span{t});
+    static_assert(std::same_as<decltype(map)::eigen_type, Eigen::Map<const Eigen::Vector3d>>);
+    CHECK(map.eigen().sum() == 7.);
+  }
+
+  SECTION("an Eigen result is reattached with the reference computed from the operands")
+  {
+    std::vector<quantity<si::metre>> d{2. * m, 4. * m, 9. * m};
+    const std::vector<quantity<si::second>> t{1. * s, 2. * s, 3. * s};
+    const eigen_quantity_view dm = as_eigen_map(std::span{d});
+    const eigen_quantity_view tm = as_eigen_map(std::span{t});
+    const eigen_quantity_view v{dm.eigen().cwiseQuotient(tm.eigen()), dm.reference / tm.reference};
+    static_assert(std::same_as<decltype(v)::value_type, quantity<si::metre / si::second>>);
+    CHECK(v[2] == 3. * (m / s));
+
+    Eigen::VectorXd result = v.eigen();
+    const std::span speeds = as_quantity_span<v.reference>(result);
+    static_assert(std::same_as<decltype(speeds)::element_type, quantity<si::metre / si::second>>);
+    CHECK(speeds.data() == static_cast<void*>(result.data()));
+    CHECK(speeds[1].in(km / h) == 7.2 * (km / h));
+  }
+
+  SECTION("a lazy expression keeps the Eigen proxy until it is evaluated")
+  {
+    using vec = Eigen::VectorXd;
+    const quantity<isq::velocity[m / s], vec> a{vec::Constant(100, 1.), isq::velocity[m / s]};
+    const quantity<isq::velocity[km / h], vec> b{vec::Constant(100, 3.6), isq::velocity[km / h]};
+    const auto expr = 2. * utility::lazy(a) + utility::lazy(b);
+    static_assert(!std::same_as<std::remove_cvref_t<decltype(expr.expression())>, vec>);
+    static_assert(std::same_as<decltype(expr)::rep, vec>);
+    const quantity<isq::velocity[m / s], vec> sum = expr;
+    CHECK(sum.numerical_value_in(m / s) == vec::Constant(100, 3.));
+  }
+
+  SECTION("the views are inverse to each other")
+  {
+    Eigen::Vector3d storage{1., 2., 3.};
+    const std::span q = as_quantity_span<isq::height[m]>(storage);
+    static_assert(decltype(q)::extent == 3);
+    q[0] = 5. * isq::height[m];
+    CHECK(storage[0] == 5.);
+
+    eigen_quantity_view map = as_eigen_map(q);
+    static_assert(map.reference == isq::height[m]);
+    const std::span back = as_quantity_span(map);
+    CHECK(back.data() == q.data());
+
+    const Eigen::Vector2d c{1., 2.};
+    static_assert(std::same_as<decltype(as_quantity_span<si::metre>(c))::element_type, const quantity<si::metre>>);
+  }
+}
+
+#endif  // MP_UNITS_LA_EIGEN
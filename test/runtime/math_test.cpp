@@ -26,7 +26,10 @@
 #ifdef MP_UNITS_IMPORT_STD
 import std;
 #else
+#include <array>
+#include <cstddef>
 #include <limits>
+#include <span>
 #endif
 #ifdef MP_UNITS_MODULES
 import mp_units;
@@ -738,3 +741,206 @@ TEST_CASE("math operations", "[math]")
     }
   }
 }
+
+TEST_CASE("math functions with a selected accuracy", "[math][accuracy]")
+{
+  using namespace mp_units::angular;
+  using namespace mp_units::angular::unit_symbols;
+  using mp_units::angular::unit_symbols::deg;
+  using mp_units::angular::unit_symbols::rad;
+
+  SECTION("libm_accuracy calls the standard library")
+  {
+    CHECK(sin(1. * rad, libm_accuracy) == sin(1. * rad));
+    CHECK(cos(1. * rad, libm_accuracy) == cos(1. * rad));
+    CHECK(atan2(1. * m, 2. * m, libm_accuracy) == atan2(1. * m, 2. * m));
+    CHECK(hypot(3. * m, 4. * m, libm_accuracy) == hypot(3. * m, 4. * m));
+  }
+
+  SECTION("ulp_accuracy matches the standard library within its error")
+  {
+    for (int i = -400; i <= 400; ++i) {
+      const quantity a = i * 0.0123 * rad;
+      REQUIRE_THAT(sin(a, ulp_accuracy), AlmostEquals(sin(a), 2));
+      REQUIRE_THAT(cos(a, ulp_accuracy), AlmostEquals(cos(a), 2));
+      const quantity y = i * 0.25 * m;
+      REQUIRE_THAT(atan2(y, 10. * m, ulp_accuracy), AlmostEquals(atan2(y, 10. * m), 3));
+      REQUIRE_THAT(atan2(y, -10. * m, ulp_accuracy), AlmostEquals(atan2(y, -10. * m), 3));
+      REQUIRE_THAT(hypot(y, 10. * m, ulp_accuracy), AlmostEquals(hypot(y, 10. * m), 2));
+    }
+  }
+
+  SECTION("fast_accuracy is within 1e-7")
+  {
+    const auto near = [](auto q1, auto q2) { return abs(q1 - q2) <= 2e-7 * one; };
+    for (int i = -400; i <= 400; ++i) {
+      const quantity a = i * 0.0123 * rad;
+      CHECK(near(sin(a, fast_accuracy), sin(a)));
+      CHECK(near(cos(a, fast_accuracy), cos(a)));
+      CHECK(near(atan2(i * 0.25 * m, -10. * m, fast_accuracy) / rad, atan2(i * 0.25 * m, -10. * m) / rad));
+      const float f = static_cast<float>(i) * 1.1f;
+      CHECK(near(sin(f * deg, fast_accuracy), sin(static_cast<double>(f) * deg)));
+    }
+  }
+
+  SECTION("angles in degrees are reduced exactly")
+  {
+    CHECK(sin(30. * deg, ulp_accuracy) == 0.5 * one);
+    CHECK(sin(180. * deg, ulp_accuracy) == 0. * one);
+    CHECK(cos(90. * deg, ulp_accuracy) == 0. * one);
+    CHECK(cos(-270. * deg, ulp_accuracy) == 0. * one);
+    CHECK(sin(360'000'030. * deg, ulp_accuracy) == 0.5 * one);
+    CHECK(sin(100 * grad, ulp_accuracy) == 1. * one);
+    CHECK(cos(0.5 * rev, ulp_accuracy) == -1. * one);
+    CHECK(sin(0.5 * rev, fast_accuracy) == 0. * one);
+  }
+
+  SECTION("representation types")
+  {
+    CHECK(sin(30 * deg, ulp_accuracy) == 0.5 * one);
+    CHECK(sin(30.f * deg, ulp_accuracy) == 0.5f * one);
+    CHECK(sin(1.L * rad, ulp_accuracy) == sin(1.L * rad));
+    CHECK(hypot(3 * m, 4000 * mm, ulp_accuracy) == 5. * m);
+  }
+
+  SECTION("sincos")
+  {
+    const auto [s1, c1] = sincos(1. * rad);
+    CHECK(s1 == sin(1. * rad));
+    CHECK(c1 == cos(1. * rad));
+    const auto [s2, c2] = sincos(60. * deg, ulp_accuracy);
+    CHECK(s2 == sin(60. * deg, ulp_accuracy));
+    CHECK(c2 == cos(60. * deg, ulp_accuracy));
+  }
+
+  SECTION("SI angular functions")
+  {
+    CHECK(si::sin(30. * si::degree, ulp_accuracy) == 0.5 * one);
+    CHECK(si::cos(90. * si::degree, fast_accuracy) == 0. * one);
+    REQUIRE_THAT(si::atan2(1. * km, 1000. * m, ulp_accuracy), AlmostEquals(45. * si::degree));
+  }
+
+  SECTION("batch forms")
+  {
+    const std::array in{0. * deg, 30. * deg, 90. * deg, 135. * deg, 180. * deg};
+    std::array<quantity<one, double>, 5> s{};
+    std::array<quantity<one, double>, 5> c{};
+    std::array<quantity<rad, double>, 5> a{};
+    std::array<quantity<m, double>, 5> h{};
+
+    sin(std::span{in}, std::span{s}, fast_accuracy);
+    for (std::size_t i = 0; i < in.size(); ++i) CHECK(s[i] == sin(in[i], fast_accuracy));
+    cos(std::span{in}, std::span{c});
+    for (std::size_t i = 0; i < in.size(); ++i) CHECK(c[i] == cos(in[i]));
+    sincos(std::span{in}, std::span{s}, std::span{c}, ulp_accuracy);
+    for (std::size_t i = 0; i < in.size(); ++i) {
+      CHECK(s[i] == sin(in[i], ulp_accuracy));
+      CHECK(c[i] == cos(in[i], ulp_accuracy));
+    }
+    atan2(std::span{s}, std::span{c}, std::span{a}, ulp_accuracy);
+    for (std::size_t i = 0; i < in.size(); ++i) REQUIRE_THAT(a[i], AlmostEquals(in[i].in(rad), 2));
+
+    const std::array x{3. * m, 6. * m, 0. * m, 1000. * m, 5. * m};
+    const std::array y{4. * m, 8. * m, 0. * m, 0. * m, 12. * m};
+    hypot(std::span{x}, std::span{y}, std::span{h}, ulp_accuracy);
+    CHECK(h == std::array{5. * m, 10. * m, 0. * m, 1000. * m, 13. * m});
+  }
+}
+
+TEST_CASE("math functions over spans", "[math][batch]")
+{
+  SECTION("unary functions")
+  {
+    const std::array in{1. * m2, 4. * m2, 2.25 * m2, 0. * m2};
+    std::array<quantity<m, double>, 4> r{};
+    std::array<quantity<mm, double>, 4> r_mm{};
+
+    sqrt(std::span{in}, std::span{r});
+    CHECK(r == std::array{1. * m, 2. * m, 1.5 * m, 0. * m});
+    sqrt(std::span{in}, std::span{r_mm});
+    CHECK(r_mm == std::array{1000. * mm, 2000. * mm, 1500. * mm, 0. * mm});
+
+    const std::array v{1. * m3, 8. * m3, -27. * m3};
+    std::array<quantity<m, double>, 3> c{};
+    cbrt(std::span{v}, std::span{c});
+    for (std::size_t i = 0; i < v.size(); ++i) REQUIRE_THAT(c[i], AlmostEquals(cbrt(v[i])));
+
+    const std::array l{1. * m, -2. * m, 3. * m};
+    std::array<quantity<m2, double>, 3> p{};
+    pow<2>(std::span{l}, std::span{p});
+    CHECK(p == std::array{1. * m2, 4. * m2, 9. * m2});
+
+    const std::array e{0. * one, 1. * one, -1. * one};
+    std::array<quantity<one, double>, 3> ex{};
+    exp(std::span{e}, std::span{ex});
+    for (std::size_t i = 0; i < e.size(); ++i) REQUIRE_THAT(ex[i], AlmostEquals(exp(e[i])));
+  }
+
+  SECTION("binary functions")
+  {
+    const std::array x{5. * m, 7.5 * m, -3.5 * m};
+    const std::array y{2. * m, 2. * m, 2. * m};
+    std::array<quantity<m, double>, 3> out{};
+    fmod(std::span{x}, std::span{y}, std::span{out});
+    CHECK(out == std::array{1. * m, 1.5 * m, -1.5 * m});
+  }
+
+  SECTION("floor, ceil, and round with an integral representation")
+  {
+    std::array<quantity<mm, int>, 601> in_mm{};
+    std::array<quantity<usc::foot, int>, 601> in_ft{};
+    for (std::size_t i = 0; i < in_mm.size(); ++i) {
+      in_mm[i] = (static_cast<int>(i) * 10 - 3000) * mm;
+      in_ft[i] = (static_cast<int>(i) - 300) * usc::foot;
+    }
+    std::array<quantity<m, int>, 601> out{};
+
+    floor<si::metre>(std::span{in_mm}, std::span{out});
+    for (std::size_t i = 0; i < in_mm.size(); ++i) REQUIRE(out[i] == floor<si::metre>(in_mm[i]));
+    ceil<si::metre>(std::span{in_mm}, std::span{out});
+    for (std::size_t i = 0; i < in_mm.size(); ++i) REQUIRE(out[i] == ceil<si::metre>(in_mm[i]));
+    round<si::metre>(std::span{in_mm}, std::span{out});
+    for (std::size_t i = 0; i < in_mm.size(); ++i) REQUIRE(out[i] == round<si::metre>(in_mm[i]));
+
+    floor<si::metre>(std::span{in_ft}, std::span{out});
+    for (std::size_t i = 0; i < in_ft.size(); ++i) REQUIRE(out[i] == floor<si::metre>(in_ft[i]));
+    ceil<si::metre>(std::span{in_ft}, std::span{out});
+    for (std::size_t i = 0; i < in_ft.size(); ++i) REQUIRE(out[i] == ceil<si::metre>(in_ft[i]));
+    round<si::metre>(std::span{in_ft}, std::span{out});
+    for (std::size_t i = 0; i < in_ft.size(); ++i) REQUIRE(out[i] == round<si::metre>(in_ft[i]));
+  }
+
+  SECTION("floor, ceil, and round with a floating-point representation")
+  {
+    const std::array in{1001. * ms, 1500. * ms, 2500. * ms, -999. * ms, -1500. * ms};
+    std::array<quantity<s, double>, 5> out{};
+
+    floor<si::second>(std::span{in}, std::span{out});
+    CHECK(out == std::array{1. * s, 1. * s, 2. * s, -1. * s, -2. * s});
+    ceil<si::second>(std::span{in}, std::span{out});
+    CHECK(out == std::array{2. * s, 2. * s, 3. * s, 0. * s, -1. * s});
+    round<si::second>(std::span{in}, std::span{out});
+    CHECK(out == std::array{1. * s, 2. * s, 2. * s, -1. * s, -2. * s});
+  }
+
+  SECTION("quantity points")
+  {
+    const std::array in{point<ms>(1001), point<ms>(1500), point<ms>(-999), point<ms>(-2500)};
+    std::array<decltype(point<s>(0)), 4> out{};
+
+    floor<si::second>(std::span{in}, std::span{out});
+    CHECK(out == std::array{point<s>(1), point<s>(1), point<s>(-1), point<s>(-3)});
+    ceil<si::second>(std::span{in}, std::span{out});
+    CHECK(out == std::array{point<s>(2), point<s>(2), point<s>(0), point<s>(-2)});
+    round<si::second>(std::span{in}, std::span{out});
+    CHECK(out == std::array{point<s>(1), point<s>(2), point<s>(-1), point<s>(-2)});
+
+    const std::array a{point<m>(0.), point<m>(10.), point<m>(-4.)};
+    const std::array b{point<m>(10.), point<m>(20.), point<m>(4.)};
+    std::array<decltype(point<m>(0.)), 3> res{};
+    lerp(std::span{a}, std::span{b}, 0.25, std::span{res});
+    CHECK(res == std::array{point<m>(2.5), point<m>(12.5), point<m>(-2.)});
+    midpoint(std::span{a}, std::span{b}, std::span{res});
+    CHECK(res == std::array{point<m>(5.), point<m>(15.), point<m>(0.)});
+  }
+}
@@ -0,0 +1,176 @@
+// The MIT License (MIT)
+//
+// Copyright (c) 2018 Mateusz Pusz
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+
+#include <catch2/catch_test_macros.hpp>
+#include <catch2/matchers/catch_matchers_floating_point.hpp>
+#include <mp-units/compat_macros.h>
+#ifdef MP_UNITS_IMPORT_STD
+import std;
+#else
+#include <cmath>
+#include <cstddef>
+#include <span>
+#include <stdexcept>
+#include <tuple>
+#include <type_traits>
+#endif
+#ifdef MP_UNITS_MODULES
+import mp_units;
+#else
+#include <mp-units/math.h>
+#include <mp-units/systems/isq.h>
+#include <mp-units/systems/si.h>
+#include <mp-units/utility/monte_carlo.h>
+#endif
+
+using namespace mp_units;
+using namespace mp_units::si::unit_symbols;
+using namespace Catch::Matchers;
+using mp_units::utility::mc_policy;
+using mp_units::utility::propagate_mc;
+using mp_units::utility::propagate_mc_batched;
+using mp_units::utility::uncertain;
+
+TEST_CASE("propagate_mc agrees with first-order propagation for a linear model", "[monte_carlo]")
+{
+  const quantity x = uncertain{3.0, 0.3} * isq::length[m];
+  const quantity y = uncertain{4.0, 0.4} * isq::length[m];
+  const auto res = propagate_mc([](auto a, auto b) { return a + b; }, std::tuple{x, y}, 200'000);
+  static_assert(std::is_same_v<decltype(res.mean()), quantity<isq::length[m]>>);
+
+  CHECK(res.sample_count() == 200'000);
+  CHECK_THAT(res.mean().numerical_value_in(m), WithinAbs(7.0, 0.01));
+  CHECK_THAT(res.stddev().numerical_value_in(m), WithinRel(0.5, 0.02));
+  CHECK_THAT(res.value().numerical_value_in(m).value(), WithinAbs(7.0, 0.01));
+  CHECK_THAT(res.value().numerical_value_in(m).uncertainty(), WithinRel(0.5, 0.02));
+
+  // the 95 % coverage interval of a normal distribution is ±1.96σ around the mean
+  const auto [low, high] = res.coverage_interval(0.95);
+  CHECK_THAT(low.numerical_value_in(m), WithinAbs(7.0 - 1.96 * 0.5, 0.02));
+  CHECK_THAT(high.numerical_value_in(m), WithinAbs(7.0 + 1.96 * 0.5, 0.02));
+  CHECK_THAT(res.quantile(0.5).numerical_value_in(m), WithinAbs(7.0, 0.01));
+  CHECK(res.quantile(0.) == res.min());
+  CHECK(res.quantile(1.) == res.max());
+}
+
+TEST_CASE("propagate_mc captures what first-order propagation misses", "[monte_carlo]")
+{
+  // x² for x = 0 ± 1 has a zero derivative at the mean, so the linear approximation reports
+  // 0 ± 0, while x² follows a chi-squared distribution with a mean of 1 and a variance of 2
+  const quantity x = uncertain{0.0, 1.0} * one;
+  const auto linear = x * x;
+  CHECK(linear.numerical_value_in(one).uncertainty() == 0.0);
+
+  const auto res = propagate_mc([](auto v) { return v * v; }, std::tuple{x}, 200'000);
+  CHECK_THAT(res.mean().numerical_value_in(one), WithinRel(1.0, 0.02));
+  CHECK_THAT(res.stddev().numerical_value_in(one), WithinRel(std::sqrt(2.0), 0.03));
+  CHECK(res.min().numerical_value_in(one) >= 0.0);
+  // the median of a chi-squared distribution with one degree of freedom is 0.4549
+  CHECK_THAT(res.quantile(0.5).numerical_value_in(one), WithinAbs(0.4549, 0.01));
+}
+
+TEST_CASE("propagate_mc input kinds", "[monte_carlo]")
+{
+  using length = quantity<isq::length[m]>;
+  const utility::uniform_real_distribution<length> side(1.0 * isq::length[m], 3.0 * isq::length[m]);
+  const quantity height = 2.0 * isq::length[m];
+  const quantity exact = uncertain<double>{5.0} * isq::length[m];
+
+  const auto res = propagate_mc([](auto a, auto h, auto e) { return a * h + e * e; }, std::tuple{side, height, exact},
+                                100'000);
+  static_assert(std::is_same_v<decltype(res.mean()), quantity<isq::length[m] * isq::length[m]>>);
+  // 2 · U(1, 3) + 25 has a mean of 29 and a standard deviation of 2 · 2/√12
+  CHECK_THAT(res.mean().numerical_value_in(m2), WithinRel(29.0, 0.002));
+  CHECK_THAT(res.stddev().numerical_value_in(m2), WithinRel(4.0 / std::sqrt(12.0), 0.02));
+  CHECK(res.min().numerical_value_in(m2) >= 27.0);
+  CHECK(res.max().numerical_value_in(m2) <= 31.0);
+}
+
+TEST_CASE("propagate_mc is reproducible for any number of threads", "[monte_carlo]")
+{
+  const quantity g = uncertain{9.81, 0.02} * isq::acceleration[m / s2];
+  const quantity t = uncertain{1.2, 0.1} * isq::duration[s];
+  const auto model = [](auto acc, auto dur) { return acc * dur * dur / 2; };
+  constexpr std::size_t n = 20'000;
+
+  const auto reference = propagate_mc(model, std::tuple{g, t}, n, {.seed = 42, .threads = 1, .block_size = 512});
+  for (const std::size_t threads : {2U, 3U, 8U}) {
+    const auto res = propagate_mc(model, std::tuple{g, t}, n, {.seed = 42, .threads = threads, .block_size = 512});
+    CHECK(res.mean() == reference.mean());
+    CHECK(res.stddev() == reference.stddev());
+    CHECK(res.quantile(0.025) == reference.quantile(0.025));
+    CHECK(res.quantile(0.975) == reference.quantile(0.975));
+  }
+
+  const auto other_seed = propagate_mc(model, std::tuple{g, t}, n, {.seed = 43, .threads = 1, .block_size = 512});
+  CHECK(other_seed.mean() != reference.mean());
+}
+
+TEST_CASE("propagate_mc quantiles in bounded memory", "[monte_carlo]")
+{
+  const quantity x = uncertain{10.0, 2.0} * isq::length[m];
+  const auto id = [](auto v) { return v; };
+
+  // below the summary capacity (up to one sample fewer) the quantiles are exact order statistics,
+  // so they agree with a larger summary of the same samples
+  const auto exact = propagate_mc(id, std::tuple{x}, 1023, {.seed = 7, .quantile_accuracy = 1024});
+  const auto large = propagate_mc(id, std::tuple{x}, 1023, {.seed = 7, .quantile_accuracy = 4096});
+  CHECK(exact.quantile(0.1) == large.quantile(0.1));
+  CHECK(exact.quantile(0.9) == large.quantile(0.9));
+
+  // a summary much smaller than the sample count still estimates the quantiles closely
+  const auto small = propagate_mc(id, std::tuple{x}, 200'000, {.seed = 7, .quantile_accuracy = 256});
+  CHECK_THAT(small.quantile(0.5).numerical_value_in(m), WithinAbs(10.0, 0.1));
+  CHECK_THAT(small.quantile(0.8413).numerical_value_in(m), WithinAbs(12.0, 0.1));
+}
+
+TEST_CASE("propagate_mc_batched evaluates whole sample blocks", "[monte_carlo]")
+{
+  const quantity x = uncertain{3.0, 0.3} * isq::length[m];
+  const quantity y = uncertain{4.0, 0.4} * isq::length[m];
+  using length = quantity<isq::length[m]>;
+  using area = quantity<isq::length[m] * isq::length[m]>;
+
+  std::size_t largest_block = 0;
+  const auto batched = propagate_mc_batched<area>(
+    [&](std::span<area> out, std::span<const length> a, std::span<const length> b) {
+      largest_block = std::max(largest_block, out.size());
+      for (std::size_t i = 0; i < out.size(); ++i) out[i] = a[i] * b[i];
+    },
+    std::tuple{x, y}, 10'000, {.seed = 1, .threads = 1, .block_size = 1000});
+  const auto scalar = propagate_mc([](auto a, auto b) { return a * b; }, std::tuple{x, y}, 10'000,
+                                   {.seed = 1, .threads = 1, .block_size = 1000});
+
+  CHECK(largest_block == 1000);
+  CHECK(batched.mean() == scalar.mean());
+  CHECK(batched.stddev() == scalar.stddev());
+}
+
+TEST_CASE("propagate_mc rethrows the exceptions of the model", "[monte_carlo]")
+{
+  const quantity x = uncertain{3.0, 0.3} * isq::length[m];
+  const auto throwing = [](auto v) -> quantity<isq::length[m]> {
+    if (v > 3.5 * isq::length[m]) throw std::domain_error("out of range");
+    return v;
+  };
+  CHECK_THROWS_AS(propagate_mc(throwing, std::tuple{x}, 10'000, {.threads = 4, .block_size = 100}), std::domain_error);
+}
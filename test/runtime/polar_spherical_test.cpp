@@ -27,7 +27,11 @@
 import std;
 #else
 #include <cmath>
+#include <cstddef>
 #include <numbers>
+#include <span>
+#include <utility>
+#include <vector>
 #endif
 #ifdef MP_UNITS_MODULES
 import mp_units;
@@ -37,6 +41,7 @@ import mp_units;
 #include <mp-units/systems/si.h>
 #include <mp-units/utility/polar_vector.h>
 #include <mp-units/utility/spherical_vector.h>
+#include <mp-units/utility/vector_quantity_soa.h>
 #endif
 
 using namespace mp_units;
@@ -399,3 +404,119 @@ TEST_CASE("angle unit is an extension point via radian_of", "[polar][spherical][
     CHECK(sph == sph.tilted_by(360.0 * degree));
   }
 }
+
+TEST_CASE("batch conversions between facades and vector_quantity_soa", "[polar][spherical][batch]")
+{
+  // more elements than one block of the kernels, with angles spread over several turns
+  constexpr std::size_t count = 150;
+
+  SECTION("polar_vector in degrees")
+  {
+    std::vector<polar_vector<si::metre, si::degree>> in;
+    for (std::size_t i = 0; i < count; ++i)
+      in.emplace_back((0.5 + static_cast<double>(i)) * m, (-700.0 + 9.5 * static_cast<double>(i)) * deg);
+
+    vector_quantity_soa<si::metre, double, 2> xy;
+    utility::to_cartesian(std::span{std::as_const(in)}, xy);
+    REQUIRE(xy.size() == count);
+    for (std::size_t i = 0; i < count; ++i) {
+      const quantity expected = in[i].to_cartesian();
+      CHECK_THAT(xy.numerical_values(0)[i], WithinAbs(expected.numerical_value_in(m)[0], 1e-12 * count));
+      CHECK_THAT(xy.numerical_values(1)[i], WithinAbs(expected.numerical_value_in(m)[1], 1e-12 * count));
+    }
+
+    vector_quantity_soa<si::metre, double, 2> fast;
+    utility::to_cartesian(std::span{in}, fast, fast_accuracy);
+    for (std::size_t i = 0; i < count; ++i) {
+      CHECK_THAT(fast.numerical_values(0)[i], WithinAbs(xy.numerical_values(0)[i], 1e-6 * count));
+      CHECK_THAT(fast.numerical_values(1)[i], WithinAbs(xy.numerical_values(1)[i], 1e-6 * count));
+    }
+
+    std::vector<polar_vector<si::metre, si::degree>> back(count);
+    utility::to_polar(xy, std::span{back}, ulp_accuracy);
+    for (std::size_t i = 0; i < count; ++i) {
+      CHECK_THAT(back[i].radius().numerical_value_in(m), WithinRel(in[i].radius().numerical_value_in(m), tol));
+      CHECK_THAT(back[i].theta().numerical_value_in(deg), WithinAbs(in[i].theta().numerical_value_in(deg), 1e-9));
+    }
+  }
+
+  SECTION("the radius is converted to the unit of the output")
+  {
+    const std::vector in{polar_vector{1.5 * km, 0.0 * rad}, polar_vector{2.0 * km, kpi / 2 * rad}};
+    vector_quantity_soa<si::metre, double, 2> xy;
+    utility::to_cartesian(std::span{in}, xy, ulp_accuracy);
+    CHECK(xy[0] == cartesian_vector{1500.0, 0.0} * m);
+    CHECK_THAT(xy.numerical_values(1)[1], WithinRel(2000.0, tol));
+
+    std::vector<polar_vector<si::kilo<si::metre>, si::degree>> back(2);
+    utility::to_polar(xy, std::span{back});
+    CHECK(back[0] == polar_vector<si::kilo<si::metre>, si::degree>{1.5 * km, 0.0 * deg});
+    CHECK_THAT(back[1].theta().numerical_value_in(deg), WithinAbs(90.0, tol));
+  }
+
+  SECTION("to_polar yields the canonical azimuth like the constructor")
+  {
+    vector_quantity_soa<si::metre, double, 2> xy;
+    xy.push_back(cartesian_vector{-1.0, 0.0} * m);
+    xy.push_back(cartesian_vector{0.0, -2.0} * m);
+    std::vector<polar_vector<si::metre, si::degree>> back(2);
+    utility::to_polar(xy, std::span{back}, fast_accuracy);
+    CHECK(back[0] == polar_vector<si::metre, si::degree>{std::as_const(xy)[0]});
+    CHECK_THAT(back[1].theta().numerical_value_in(deg), WithinAbs(-90.0, 1e-5));
+  }
+
+  SECTION("spherical_vector in degrees")
+  {
+    std::vector<spherical_vector<si::metre, si::degree>> in;
+    for (std::size_t i = 0; i < count; ++i)
+      in.emplace_back((1.0 + static_cast<double>(i)) * m, (1.0 + 1.1 * static_cast<double>(i)) * deg,
+                      (-500.0 + 7.0 * static_cast<double>(i)) * deg);
+
+    vector_quantity_soa<si::metre, double, 3> xyz;
+    utility::to_cartesian(std::span{in}, xyz, ulp_accuracy);
+    REQUIRE(xyz.size() == count);
+    for (std::size_t i = 0; i < count; ++i) {
+      const quantity expected = in[i].to_cartesian();
+      for (std::size_t axis = 0; axis < 3; ++axis)
+        CHECK_THAT(xyz.numerical_values(axis)[i], WithinAbs(expected.numerical_value_in(m)[axis], 1e-12 * count));
+    }
+
+    std::vector<spherical_vector<si::metre, si::degree>> back(count);
+    utility::to_spherical(xyz, std::span{back}, ulp_accuracy);
+    for (std::size_t i = 0; i < count; ++i) {
+      CHECK_THAT(back[i].radius().numerical_value_in(m), WithinRel(in[i].radius().numerical_value_in(m), tol));
+      CHECK_THAT(back[i].theta().numerical_value_in(deg), WithinAbs(in[i].theta().numerical_value_in(deg), 1e-9));
+      CHECK_THAT(back[i].phi().numerical_value_in(deg), WithinAbs(in[i].phi().numerical_value_in(deg), 1e-9));
+    }
+  }
+
+  SECTION("to_spherical of a zero vector has zero angles like the constructor")
+  {
+    vector_quantity_soa<si::metre, double, 3> xyz;
+    xyz.push_back(cartesian_vector{0.0, 0.0, -0.0} * m);
+    std::vector<spherical_vector<si::metre, si::radian>> back(1);
+    utility::to_spherical(xyz, std::span{back}, fast_accuracy);
+    CHECK(back[0] == spherical_vector<si::metre, si::radian>{});
+  }
+
+  SECTION("strong and user-defined angle systems")
+  {
+    using angular::unit_symbols::deg;
+    const std::vector in{spherical_vector{2.0f * m, 90.0f * deg, 180.0f * deg}};
+    vector_quantity_soa<si::metre, float, 3> xyz;
+    utility::to_cartesian(std::span{in}, xyz, fast_accuracy);
+    CHECK_THAT(xyz.numerical_values(0)[0], WithinAbs(-2.0f, 1e-6f));
+    CHECK_THAT(xyz.numerical_values(1)[0], WithinAbs(0.0f, 1e-6f));
+    CHECK_THAT(xyz.numerical_values(2)[0], WithinAbs(0.0f, 1e-6f));
+
+    std::vector<polar_vector<si::metre, test_angle::degree>> back(1);
+    vector_quantity_soa<si::metre, double, 2> xy;
+    xy.push_back(cartesian_vector{0.0, 3.0} * m);
+    utility::to_polar(xy, std::span{back});
+    CHECK_THAT(back[0].theta().numerical_value_in(test_angle::degree), WithinAbs(90.0, tol));
+    vector_quantity_soa<si::metre, double, 2> again;
+    utility::to_cartesian(std::span{back}, again);
+    CHECK_THAT(again.numerical_values(0)[0], WithinAbs(0.0, tol));
+    CHECK_THAT(again.numerical_values(1)[0], WithinAbs(3.0, tol));
+  }
+}
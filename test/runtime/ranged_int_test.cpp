@@ -0,0 +1,123 @@
+// The MIT License (MIT)
+//
+// Copyright (c) 2018 Mateusz Pusz
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+
+#include <catch2/catch_test_macros.hpp>
+#include <mp-units/bits/hacks.h>
+#include <mp-units/systems/si.h>
+#include <mp-units/utility/ranged_int.h>
+#ifdef MP_UNITS_IMPORT_STD
+import std;
+#else
+#include <cstdint>
+#include <limits>
+#include <stdexcept>
+#include <string>
+#include <type_traits>
+#endif
+
+using namespace mp_units;
+using namespace mp_units::utility;
+using namespace mp_units::si::unit_symbols;
+
+TEST_CASE("ranged_int arithmetic", "[ranged_int]")
+{
+  using adc12 = ranged_int<std::uint16_t, 0, 4095>;
+
+  SECTION("results within a proven range are exact")
+  {
+    for (int i : {0, 1, 2048, 4095}) {
+      const adc12 a{i};
+      REQUIRE(static_cast<int>((a * ranged_c<100>).value()) == i * 100);
+      REQUIRE((a - adc12{4095}).value() == i - 4095);
+      REQUIRE((a / ranged_c<-3>).value() == i / -3);
+    }
+  }
+
+  SECTION("construction from a value out of range throws")
+  {
+    REQUIRE_THROWS_AS(adc12{4096}, std::overflow_error);
+    REQUIRE_THROWS_AS(adc12{-1}, std::overflow_error);
+    REQUIRE_THROWS_AS((adc12{ranged_int<int, -10, 10>{-1}}), std::overflow_error);
+    REQUIRE(adc12{ranged_int<int, -10, 10>{10}}.value() == 10);
+  }
+
+  SECTION("compound assignment checks narrowing back into the range")
+  {
+    adc12 a{4000};
+    REQUIRE_THROWS_AS(a += ranged_c<100>, std::overflow_error);
+    a = adc12{0};
+    REQUIRE_THROWS_AS(--a, std::overflow_error);
+    a = adc12{4094};
+    REQUIRE((++a).value() == 4095);
+    REQUIRE_THROWS_AS(++a, std::overflow_error);
+  }
+
+  SECTION("division by a range containing zero is checked")
+  {
+    const ranged_int<int, -1, 1> d{0};
+    REQUIRE_THROWS_AS(adc12{1} / d, std::overflow_error);
+    REQUIRE((adc12{10} / ranged_int<int, -1, 1>{-1}).value() == -10);
+  }
+
+  SECTION("results beyond the 64-bit range are checked")
+  {
+    using big = ranged_int<std::int64_t, 0, std::numeric_limits<std::int64_t>::max()>;
+    REQUIRE((big{1'000'000} * ranged_c<2>).value() == 2'000'000);
+    REQUIRE_THROWS_AS(big{std::numeric_limits<std::int64_t>::max()} * ranged_c<2>, std::overflow_error);
+    REQUIRE_THROWS_AS(big{std::numeric_limits<std::int64_t>::max()} + big{1}, std::overflow_error);
+  }
+}
+
+TEST_CASE("ranged_int as quantity representation", "[ranged_int][quantity]")
+{
+  using adc12 = ranged_int<std::uint16_t, 0, 4095>;
+
+  SECTION("unit scaling scales the range")
+  {
+    const quantity q = adc12{4095} * mV;
+    const quantity q_uV = q.in(uV);
+    STATIC_REQUIRE(std::is_same_v<decltype(q_uV.numerical_value_in(uV)), ranged_int<std::uint32_t, 0, 4'095'000>>);
+    REQUIRE(q_uV.numerical_value_in(uV).value() == 4'095'000);
+    REQUIRE(q.in(V, truncated).numerical_value_in(V).value() == 4);
+  }
+
+  SECTION("unit scaling beyond the 64-bit range is checked")
+  {
+    using big = ranged_int<std::int64_t, 0, std::numeric_limits<std::int64_t>::max()>;
+    REQUIRE((big{5} * km).numerical_value_in(m).value() == 5000);
+    REQUIRE_THROWS_AS((big{std::numeric_limits<std::int64_t>::max()} * km).in(m), std::overflow_error);
+  }
+
+  SECTION("arithmetic on quantities")
+  {
+    const quantity a = adc12{4000} * mV;
+    const quantity b = ranged_int<std::int8_t, -8, 7>{-8} * mV;
+    REQUIRE((a + b).numerical_value_in(mV).value() == 3992);
+    REQUIRE((a * (ranged_c<25> * mA)).numerical_value_in(mV * mA).value() == 100'000);
+  }
+}
+
+TEST_CASE("ranged_int formatting", "[ranged_int][fmt]")
+{
+  REQUIRE(MP_UNITS_STD_FMT::format("{}", ranged_int<std::uint8_t, 0, 200>{42}) == "42");
+  REQUIRE(MP_UNITS_STD_FMT::format("{}", ranged_int<std::int8_t, -8, 7>{-8} * mV) == "-8 mV");
+}
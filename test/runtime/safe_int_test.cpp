@@ -30,6 +30,7 @@
 #ifdef MP_UNITS_IMPORT_STD
 import std;
 #else
+#include <array>
 #include <cstdint>
 #include <limits>
 #include <stdexcept>
@@ -391,3 +392,44 @@ TEST_CASE("safe_int * constrained operations", "[safe_int][cross-wrapper][throw]
     REQUIRE_THROWS_AS(S{10} % C{0}, std::overflow_error);
   }
 }
+
+// ============================================================================
+// Poisoning policy: overflow in a batch is detected once, after the loop
+// ============================================================================
+
+TEST_CASE("safe_int with poison_policy", "[safe_int][poison]")
+{
+  using T = safe_int<int, safe_int_poison_policy>;
+  const auto int_max = std::numeric_limits<int>::max();
+
+  SECTION("a clean batch stays unpoisoned")
+  {
+    std::array<quantity<si::milli<si::metre>, T>, 4> lengths{};
+    const std::array<quantity<si::metre, T>, 4> input = {T{1} * m, T{2} * m, T{3} * m, T{4} * m};
+    for (std::size_t i = 0; i < input.size(); ++i) lengths[i] = input[i] + T{5} * mm;
+
+    bool poisoned = false;
+    for (const auto& l : lengths) poisoned |= l.numerical_value_in(mm).is_poisoned();
+    REQUIRE_FALSE(poisoned);
+    REQUIRE(lengths[3] == T{4005} * mm);
+  }
+
+  SECTION("an overflowing element is poisoned without affecting its neighbours")
+  {
+    const std::array<quantity<si::metre, T>, 3> input = {T{1} * m, T{int_max / 10} * m, T{3} * m};
+    std::array<quantity<si::milli<si::metre>, T>, 3> lengths{};
+    for (std::size_t i = 0; i < input.size(); ++i) lengths[i] = input[i];
+
+    REQUIRE_FALSE(lengths[0].numerical_value_in(mm).is_poisoned());
+    REQUIRE(lengths[1].numerical_value_in(mm).is_poisoned());
+    REQUIRE(lengths[2] == T{3000} * mm);
+  }
+
+  SECTION("the poison survives further arithmetic")
+  {
+    T acc{int_max - 1};
+    for (int i = 0; i < 4; ++i) acc += T{1};
+    acc -= T{100};
+    REQUIRE(acc.is_poisoned());
+  }
+}
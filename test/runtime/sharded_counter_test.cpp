@@ -0,0 +1,94 @@
+// The MIT License (MIT)
+//
+// Copyright (c) 2018 Mateusz Pusz
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+
+
+#include <catch2/catch_test_macros.hpp>
+#ifdef MP_UNITS_IMPORT_STD
+import std;
+#else
+#include <cstdint>
+#include <thread>
+#include <vector>
+#endif
+#ifdef MP_UNITS_MODULES
+import mp_units;
+#else
+#include <mp-units/systems/iec.h>
+#include <mp-units/systems/si.h>
+#include <mp-units/utility/sharded_counter.h>
+#endif
+
+using namespace mp_units;
+using namespace mp_units::si::unit_symbols;
+using mp_units::utility::sharded_counter;
+
+TEST_CASE("sharded_counter", "[sharded_counter]")
+{
+  SECTION("shard count is a power of two")
+  {
+    REQUIRE(sharded_counter<quantity<si::metre, int>>(1).shard_count() == 1);
+    REQUIRE(sharded_counter<quantity<si::metre, int>>(5).shard_count() == 8);
+    REQUIRE(sharded_counter<quantity<si::metre, int>>(0).shard_count() == 1);
+    REQUIRE(sharded_counter<quantity<si::metre, int>>{}.shard_count() >= 1);
+  }
+
+  SECTION("starts at zero and aggregates increments")
+  {
+    sharded_counter<quantity<iec::byte, std::uint64_t>> bytes;
+    REQUIRE(bytes.read() == std::uint64_t{0} * iec::byte);
+    bytes += std::uint64_t{1} * iec::unit_symbols::KiB;
+    bytes.add(std::uint64_t{24} * iec::byte);
+    bytes -= std::uint64_t{48} * iec::byte;
+    REQUIRE(bytes.read() == std::uint64_t{1000} * iec::byte);
+    bytes.reset();
+    REQUIRE(bytes.read() == std::uint64_t{0} * iec::byte);
+  }
+
+  SECTION("floating-point representation")
+  {
+    sharded_counter<quantity<si::joule>> energy(4);
+    energy += 1.5 * kJ;
+    energy += 500. * J;
+    REQUIRE(energy.read() == 2. * kJ);
+  }
+}
+
+TEST_CASE("sharded_counter aggregates across threads", "[sharded_counter][threads]")
+{
+  constexpr int threads = 8;
+  constexpr int iterations = 10'000;
+  sharded_counter<quantity<iec::byte, std::uint64_t>> bytes(4);  // fewer shards than threads
+  sharded_counter<quantity<si::nano<si::second>, std::int64_t>> busy;
+
+  std::vector<std::thread> workers;
+  for (int t = 0; t < threads; ++t)
+    workers.emplace_back([&] {
+      for (int i = 0; i < iterations; ++i) {
+        bytes += std::uint64_t{64} * iec::byte;
+        busy += std::int64_t{2} * us;
+      }
+    });
+  for (auto& w : workers) w.join();
+
+  REQUIRE(bytes.read() == std::uint64_t{threads * iterations * 64} * iec::byte);
+  REQUIRE(busy.read() == std::int64_t{threads * iterations * 2} * us);
+}
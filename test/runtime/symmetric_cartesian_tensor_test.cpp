@@ -0,0 +1,153 @@
+// The MIT License (MIT)
+//
+// Copyright (c) 2018 Mateusz Pusz
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+
+#include <catch2/catch_test_macros.hpp>
+#include <mp-units/compat_macros.h>
+#include <mp-units/ext/format.h>
+#ifdef MP_UNITS_IMPORT_STD
+import std;
+#else
+#include <complex>
+#include <sstream>
+#endif
+#ifdef MP_UNITS_MODULES
+import mp_units;
+#else
+#include <mp-units/systems/isq.h>
+#include <mp-units/systems/si.h>
+#include <mp-units/utility/symmetric_cartesian_tensor.h>
+#endif
+
+using namespace mp_units;
+using namespace std::complex_literals;
+using utility::cartesian_tensor;
+using utility::cartesian_vector;
+using utility::diagonal_cartesian_tensor;
+using utility::symmetric_cartesian_tensor;
+
+static_assert(sizeof(symmetric_cartesian_tensor<double>) == 6 * sizeof(double));
+static_assert(sizeof(symmetric_cartesian_tensor<double, 2>) == 3 * sizeof(double));
+static_assert(std::is_same_v<decltype(symmetric_cartesian_tensor{1., 2., 3.}), symmetric_cartesian_tensor<double, 2>>);
+static_assert(
+  std::is_same_v<decltype(symmetric_cartesian_tensor{1., 2., 3., 4., 5., 6.}), symmetric_cartesian_tensor<double, 3>>);
+
+// widening conversions (diagonal -> symmetric -> dense) are implicit; narrowing ones do not exist
+static_assert(std::convertible_to<symmetric_cartesian_tensor<double>, cartesian_tensor<double>>);
+static_assert(std::convertible_to<diagonal_cartesian_tensor<double>, symmetric_cartesian_tensor<double>>);
+static_assert(!std::constructible_from<symmetric_cartesian_tensor<double>, cartesian_tensor<double>>);
+static_assert(!std::constructible_from<diagonal_cartesian_tensor<double>, symmetric_cartesian_tensor<double>>);
+static_assert(!std::convertible_to<symmetric_cartesian_tensor<double, 2>, cartesian_tensor<double, 3>>);
+
+// like the dense tensor, the symmetric and the diagonal ones back tensor quantities
+static_assert(RepresentationOf<symmetric_cartesian_tensor<double>, quantity_tensor_order::tensor>);
+static_assert(!RepresentationOf<symmetric_cartesian_tensor<double>, quantity_tensor_order::vector>);
+static_assert(RepresentationOf<diagonal_cartesian_tensor<double>, quantity_tensor_order::tensor>);
+static_assert(RepresentationOf<symmetric_cartesian_tensor<std::complex<double>>, quantity_field::complex>);
+
+TEST_CASE("symmetric_cartesian_tensor operations", "[tensor]")
+{
+  // Voigt order: xx, yy, zz, yz, xz, xy
+  constexpr symmetric_cartesian_tensor s{1., 2., 3., 4., 5., 6.};
+  constexpr cartesian_tensor dense = s;
+  constexpr symmetric_cartesian_tensor s2{-1., 0.5, 2., 1., -3., 0.25};
+  constexpr cartesian_tensor dense2 = s2;
+  constexpr cartesian_tensor a{1., 2., 3., 4., 5., 6., 7., 8., 9.};
+  constexpr diagonal_cartesian_tensor d{1., 2., 3.};
+
+  SECTION("access")
+  {
+    REQUIRE(dense == cartesian_tensor{1., 6., 5., 6., 2., 4., 5., 4., 3.});
+    for (std::size_t i = 0; i < 3; ++i)
+      for (std::size_t j = 0; j < 3; ++j) REQUIRE(s(i, j) == s(j, i));
+
+    symmetric_cartesian_tensor<double> m = s;
+    m(2, 0) = 10.;
+    REQUIRE(m(0, 2) == 10.);
+
+    REQUIRE(symmetric_cartesian_tensor<double>(d) == symmetric_cartesian_tensor{1., 2., 3., 0., 0., 0.});
+    REQUIRE(cartesian_tensor<double, 2>(symmetric_cartesian_tensor{1., 2., 3.}) == cartesian_tensor{1., 3., 3., 2.});
+  }
+
+  SECTION("arithmetic")
+  {
+    REQUIRE(cartesian_tensor<double>(s + s2) == dense + dense2);
+    REQUIRE(cartesian_tensor<double>(s - s2) == dense - dense2);
+    REQUIRE(cartesian_tensor<double>(2. * s) == 2. * dense);
+    REQUIRE(cartesian_tensor<double>(s / 2.) == dense / 2.);
+    REQUIRE(cartesian_tensor<double>(-s) == -dense);
+    symmetric_cartesian_tensor<double> m = s;
+    m += s2;
+    m -= s;
+    REQUIRE(m == s2);
+  }
+
+  SECTION("inner products match the dense ones")
+  {
+    const cartesian_vector v{1., -1., 2.};
+    REQUIRE(inner_product(s, v) == inner_product(dense, v));
+    REQUIRE(inner_product(s, s2) == inner_product(dense, dense2));
+    REQUIRE(inner_product(s, a) == inner_product(dense, a));
+    REQUIRE(inner_product(a, s) == inner_product(a, dense));
+    REQUIRE(inner_product(s, d) == inner_product(dense, cartesian_tensor<double>(d)));
+    REQUIRE(inner_product(d, s) == inner_product(cartesian_tensor<double>(d), dense));
+  }
+
+  SECTION("scalar products match the dense ones")
+  {
+    REQUIRE(scalar_product(s, s2) == scalar_product(dense, dense2));
+    REQUIRE(scalar_product(s, a) == scalar_product(dense, a));
+    REQUIRE(scalar_product(a, s) == scalar_product(a, dense));
+    REQUIRE(scalar_product(s, d) == scalar_product(dense, cartesian_tensor<double>(d)));
+    REQUIRE(scalar_product(d, s) == scalar_product(cartesian_tensor<double>(d), dense));
+  }
+
+  SECTION("norm")
+  {
+    REQUIRE(s.norm() == dense.norm());
+    REQUIRE(magnitude(symmetric_cartesian_tensor{0., 0., 1.}) == std::sqrt(2.));
+  }
+
+  SECTION("complex elements")
+  {
+    const symmetric_cartesian_tensor c{1. + 1.i, 2. + 0.i, 0. - 1.i};
+    const cartesian_tensor<std::complex<double>, 2> cd = c;
+    REQUIRE(scalar_product(c, c) == scalar_product(cd, cd));
+    REQUIRE(c.norm() == cd.norm());
+  }
+
+  SECTION("as a quantity representation")
+  {
+    using namespace mp_units::si::unit_symbols;
+    quantity sigma = s * isq::stress[Pa];
+    quantity sigma_kpa = sigma.in(kPa);
+    REQUIRE(sigma_kpa.numerical_value_in(kPa) == s / 1000.);
+    REQUIRE(magnitude(sigma) == s.norm() * Pa);
+  }
+
+  SECTION("text output")
+  {
+    std::ostringstream os;
+    os << symmetric_cartesian_tensor{1, 2, 3};
+    REQUIRE(os.str() == "[[1, 3], [3, 2]]");
+    REQUIRE(MP_UNITS_STD_FMT::format("{}", symmetric_cartesian_tensor{1, 2, 3}) == "[[1, 3], [3, 2]]");
+  }
+}
@@ -0,0 +1,212 @@
+// The MIT License (MIT)
+//
+// Copyright (c) 2018 Mateusz Pusz
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+
+#include <catch2/catch_test_macros.hpp>
+#include <catch2/matchers/catch_matchers_floating_point.hpp>
+#include <mp-units/compat_macros.h>
+#ifdef MP_UNITS_IMPORT_STD
+import std;
+#else
+#include <cmath>
+#include <cstddef>
+#include <limits>
+#include <numbers>
+#include <type_traits>
+#include <utility>
+#endif
+#ifdef MP_UNITS_MODULES
+import mp_units;
+#else
+#include <mp-units/math.h>
+#include <mp-units/systems/iau.h>
+#include <mp-units/systems/isq.h>
+#include <mp-units/systems/si.h>
+#include <mp-units/utility/uncertain_array.h>
+#endif
+
+using namespace mp_units;
+using namespace mp_units::si::unit_symbols;
+using namespace Catch::Matchers;
+using mp_units::utility::uncertain;
+using mp_units::utility::uncertain_array;
+
+namespace {
+
+// more elements than a single block, with a partial last one
+constexpr std::size_t count = 150;
+
+template<auto R>
+uncertain_array<R> make_array(double offset, double relative)
+{
+  uncertain_array<R> res;
+  for (std::size_t i = 0; i < count; ++i) {
+    const double v = offset + 0.1 * static_cast<double>(i);
+    res.push_back(uncertain{v, relative * v} * R);
+  }
+  return res;
+}
+
+template<auto R1, auto R2>
+void check_elements(const uncertain_array<R1>& batch, const auto& expected)
+{
+  REQUIRE(batch.size() == count);
+  for (std::size_t i = 0; i < count; ++i) {
+    const quantity<R2, uncertain<double>> exp = expected(i);
+    const uncertain<double> res = batch[i].numerical_value_in(get_unit(R2));
+    CHECK_THAT(res.value(), WithinRel(exp.numerical_value_in(get_unit(R2)).value(), 1e-12));
+    CHECK_THAT(res.uncertainty(), WithinRel(exp.numerical_value_in(get_unit(R2)).uncertainty(), 1e-12));
+  }
+}
+
+}  // namespace
+
+TEST_CASE("uncertain_array element access", "[uncertain_array]")
+{
+  uncertain_array<isq::length[m]> arr(3);
+  CHECK(arr.size() == 3);
+  CHECK(std::as_const(arr)[0] == uncertain<double>{0.0} * isq::length[m]);
+
+  arr[1] = uncertain{2.0, 0.5} * isq::length[km];
+  CHECK(arr.numerical_values()[1] == 2000.0);
+  CHECK(arr.uncertainties()[1] == 500.0);
+  CHECK(arr[1] == uncertain{2000.0, 500.0} * isq::length[m]);
+
+  arr.push_back(uncertain{1.0, 0.1} * isq::length[m]);
+  CHECK(arr.size() == 4);
+  CHECK(std::as_const(arr)[3].numerical_value_in(m).uncertainty() == 0.1);
+}
+
+TEST_CASE("uncertain_array batch arithmetic matches uncertain", "[uncertain_array]")
+{
+  const auto length = make_array<isq::length[m]>(1.0, 0.01);
+  const auto width = make_array<isq::length[m]>(2.0, 0.02);
+  const auto time = make_array<isq::duration[s]>(0.5, 0.03);
+
+  SECTION("addition and subtraction")
+  {
+    check_elements<isq::length[m], isq::length[m]>(length + width, [&](std::size_t i) { return length[i] + width[i]; });
+    check_elements<isq::length[m], isq::length[m]>(length - width, [&](std::size_t i) { return length[i] - width[i]; });
+  }
+
+  SECTION("multiplication and division")
+  {
+    constexpr auto area = isq::length[m] * isq::length[m];
+    constexpr auto speed = isq::length[m] / isq::duration[s];
+    check_elements<area, area>(length * width, [&](std::size_t i) { return length[i] * width[i]; });
+    check_elements<speed, speed>(length / time, [&](std::size_t i) { return length[i] / time[i]; });
+  }
+
+  SECTION("exact scalars")
+  {
+    check_elements<isq::length[m], isq::length[m]>(length * -3.0, [&](std::size_t i) { return length[i] * -3.0; });
+    check_elements<isq::length[m], isq::length[m]>(2.0 * length, [&](std::size_t i) { return 2.0 * length[i]; });
+    check_elements<isq::length[m], isq::length[m]>(length / 4.0, [&](std::size_t i) { return length[i] / 4.0; });
+  }
+
+  SECTION("huge uncertainties do not overflow in quadrature")
+  {
+    uncertain_array<isq::length[m]> big;
+    big.push_back(uncertain{1.0, 1e200} * isq::length[m]);
+    const auto sum = big + big;
+    CHECK_THAT(sum.uncertainties()[0], WithinRel(std::numbers::sqrt2 * 1e200));
+  }
+}
+
+TEST_CASE("uncertain_array batch math matches uncertain", "[uncertain_array]")
+{
+  SECTION("sqrt")
+  {
+    const auto area = make_array<isq::area[m2]>(1.0, 0.01);
+    check_elements<sqrt(isq::area[m2]), isq::length[m]>(sqrt(area), [&](std::size_t i) { return sqrt(area[i]); });
+  }
+
+  SECTION("exp and log")
+  {
+    const auto ratio = make_array<one>(0.5, 0.01);
+    check_elements<one, one>(exp(ratio), [&](std::size_t i) { return exp(ratio[i]); });
+    check_elements<one, one>(log(ratio), [&](std::size_t i) {
+      const uncertain<double> v = ratio[i].numerical_value_in(one);
+      return log(v) * one;
+    });
+
+    // a dimensionless unit other than `one` is converted first
+    uncertain_array<percent> pct;
+    pct.push_back(uncertain{50.0, 1.0} * percent);
+    const auto e = exp(pct);
+    CHECK_THAT(e.numerical_values()[0], WithinRel(std::exp(0.5)));
+    CHECK_THAT(e.uncertainties()[0], WithinRel(std::exp(0.5) * 0.01));
+  }
+
+  SECTION("sin and cos propagate through the derivative in radians")
+  {
+    const auto angle = make_array<si::degree>(10.0, 0.01);
+    const auto s = utility::sin(angle);
+    const auto c = utility::cos(angle, fast_accuracy);
+    REQUIRE(s.size() == count);
+    for (std::size_t i = 0; i < count; ++i) {
+      const double rad = angle.numerical_values()[i] * std::numbers::pi / 180.0;
+      const double urad = angle.uncertainties()[i] * std::numbers::pi / 180.0;
+      CHECK_THAT(s.numerical_values()[i], WithinAbs(std::sin(rad), 1e-12));
+      CHECK_THAT(s.uncertainties()[i], WithinAbs(std::abs(std::cos(rad)) * urad, 1e-12));
+      // `fast_accuracy` trades a few correct digits for a branch-free kernel
+      CHECK_THAT(c.numerical_values()[i], WithinAbs(std::cos(rad), 1e-8));
+      CHECK_THAT(c.uncertainties()[i], WithinAbs(std::abs(std::sin(rad)) * urad, 1e-8));
+    }
+  }
+
+  SECTION("atan2")
+  {
+    const auto y = make_array<isq::length[m]>(-3.0, 0.01);
+    const auto x = make_array<isq::length[m]>(1.0, 0.02);
+    const auto res = utility::atan2(y, x);
+    REQUIRE(res.size() == count);
+    for (std::size_t i = 0; i < count; ++i) {
+      const uncertain<double> expected = atan2(y[i].numerical_value_in(m), x[i].numerical_value_in(m));
+      CHECK_THAT(res.numerical_values()[i], WithinRel(expected.value(), 1e-12));
+      CHECK_THAT(res.uncertainties()[i], WithinRel(expected.uncertainty(), 1e-12));
+    }
+  }
+}
+
+TEST_CASE("uncertain_array unit conversions", "[uncertain_array]")
+{
+  const auto length = make_array<isq::length[m]>(1.0, 0.01);
+
+  SECTION("an exact factor scales both arrays")
+  {
+    const uncertain_array<isq::length[mm]> in_mm = length;
+    check_elements<isq::length[mm], isq::length[mm]>(in_mm, [&](std::size_t i) { return length[i].in(mm); });
+
+    const auto in_km = length.in(km);
+    static_assert(std::is_same_v<decltype(in_km), const uncertain_array<isq::length[km]>>);
+    CHECK_THAT(in_km.numerical_values()[10], WithinRel(length.numerical_values()[10] / 1000.0));
+  }
+
+  SECTION("the uncertainty of a measured conversion factor is folded in once per batch")
+  {
+    uncertain_array<iau::solar_mass> mass;
+    for (std::size_t i = 0; i < count; ++i)
+      mass.push_back(uncertain{1.0 + static_cast<double>(i), 0.1} * iau::solar_mass);
+    const auto in_kg = mass.in(kg);
+    check_elements<si::kilogram, si::kilogram>(in_kg, [&](std::size_t i) { return std::as_const(mass)[i].in(kg); });
+  }
+}
@@ -0,0 +1,188 @@
+// The MIT License (MIT)
+//
+// Copyright (c) 2018 Mateusz Pusz
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+
+#include <catch2/catch_test_macros.hpp>
+#include <catch2/matchers/catch_matchers_floating_point.hpp>
+#include <mp-units/compat_macros.h>
+#ifdef MP_UNITS_IMPORT_STD
+import std;
+#else
+#include <cstddef>
+#include <span>
+#include <utility>
+#include <vector>
+#endif
+#ifdef MP_UNITS_MODULES
+import mp_units;
+#else
+#include <mp-units/systems/isq.h>
+#include <mp-units/systems/si.h>
+#include <mp-units/utility/vector_quantity_soa.h>
+#endif
+
+using namespace mp_units;
+using namespace mp_units::si::unit_symbols;
+using namespace Catch::Matchers;
+using utility::cartesian_vector;
+using utility::vector_quantity_soa;
+
+namespace {
+
+// more elements than a single block of the batch kernels, with a partial last block
+constexpr std::size_t count = 150;
+
+[[nodiscard]] vector_quantity_soa<isq::velocity[m / s]> make_velocities()
+{
+  vector_quantity_soa<isq::velocity[m / s]> v;
+  v.reserve(count);
+  for (std::size_t i = 0; i < count; ++i) {
+    const auto x = static_cast<double>(i);
+    v.push_back(cartesian_vector{x, 2 * x + 1, 3 - x} * isq::velocity[m / s]);
+  }
+  return v;
+}
+
+}  // namespace
+
+TEST_CASE("vector_quantity_soa", "[vector][soa]")
+{
+  using velocities = vector_quantity_soa<isq::velocity[m / s]>;
+
+  SECTION("elements are stored per axis")
+  {
+    velocities v(2);
+    REQUIRE(v.size() == 2);
+    REQUIRE(v[1] == cartesian_vector{0., 0., 0.} * isq::velocity[m / s]);
+
+    v[1] = cartesian_vector{36., 72., 108.} * isq::velocity[km / h];
+    REQUIRE(v.numerical_values(0)[1] == 10.);
+    REQUIRE(v.numerical_values(1)[1] == 20.);
+    REQUIRE(v.numerical_values(2)[1] == 30.);
+    REQUIRE(v[1] == cartesian_vector{10., 20., 30.} * isq::velocity[m / s]);
+    REQUIRE(v[1].magnitude() == magnitude(cartesian_vector{10., 20., 30.}) * (m / s));
+  }
+
+  SECTION("proxy references read, assign, and update elements")
+  {
+    velocities v;
+    v.push_back(cartesian_vector{1., 2., 3.} * isq::velocity[m / s]);
+    v.push_back(cartesian_vector{4., 5., 6.} * isq::velocity[m / s]);
+    v[0] += cartesian_vector{1., 1., 1.} * isq::velocity[m / s];
+    v[1] -= cartesian_vector{1., 1., 1.} * isq::velocity[m / s];
+    REQUIRE(v[0] == cartesian_vector{2., 3., 4.} * isq::velocity[m / s]);
+    REQUIRE(v[1] == cartesian_vector{3., 4., 5.} * isq::velocity[m / s]);
+
+    v[0] = v[1];
+    quantity<isq::velocity[m / s], cartesian_vector<double>> q = v[0];
+    REQUIRE(q == cartesian_vector{3., 4., 5.} * isq::velocity[m / s]);
+
+    v.clear();
+    REQUIRE(v.empty());
+  }
+
+  SECTION("scalar products")
+  {
+    const velocities v = make_velocities();
+    vector_quantity_soa<isq::force[N]> f(count);
+    for (std::size_t i = 0; i < count; ++i) f[i] = cartesian_vector{1., -1., 2.} * isq::force[N];
+
+    std::vector<quantity<m / s * N>> res(count);
+    scalar_product(v, f, std::span{res});
+    for (std::size_t i = 0; i < count; ++i) {
+      const auto x = static_cast<double>(i);
+      REQUIRE(res[i] == (x - (2 * x + 1) + 2 * (3 - x)) * (m / s * N));
+    }
+  }
+
+  SECTION("vector products")
+  {
+    const velocities v = make_velocities();
+    vector_quantity_soa<isq::force[N]> f(count);
+    for (std::size_t i = 0; i < count; ++i) f[i] = cartesian_vector{1., -1., 2.} * isq::force[N];
+
+    vector_quantity_soa<m / s * N> res;
+    vector_product(v, f, res);
+    REQUIRE(res.size() == count);
+    for (std::size_t i = 0; i < count; ++i) {
+      const cartesian_vector expected = vector_product(v[i].numerical_value_in(m / s), cartesian_vector{1., -1., 2.});
+      REQUIRE(res[i] == expected * (m / s * N));
+    }
+  }
+
+  SECTION("vector products in place")
+  {
+    vector_quantity_soa<one> a(count);
+    const vector_quantity_soa<one> b = [] {
+      vector_quantity_soa<one> res(count);
+      for (std::size_t i = 0; i < count; ++i) res[i] = cartesian_vector{0., 0., 1.} * one;
+      return res;
+    }();
+    for (std::size_t i = 0; i < count; ++i) a[i] = cartesian_vector{1., 0., 0.} * one;
+    vector_product(a, b, a);
+    for (std::size_t i = 0; i < count; ++i) REQUIRE(a[i] == cartesian_vector{0., -1., 0.} * one);
+  }
+
+  SECTION("magnitudes")
+  {
+    const velocities v = make_velocities();
+    std::vector<quantity<km / h>> res(count);
+    utility::magnitude(v, std::span{res});
+    for (std::size_t i = 0; i < count; ++i)
+      REQUIRE_THAT(res[i].numerical_value_in(m / s), WithinULP(v[i].magnitude().numerical_value_in(m / s), 2));
+  }
+
+  SECTION("magnitudes do not overflow or underflow")
+  {
+    velocities v;
+    v.push_back(cartesian_vector{3e200, 4e200, 0.} * isq::velocity[m / s]);
+    v.push_back(cartesian_vector{3., 4., 0.} * isq::velocity[m / s]);
+    v.push_back(cartesian_vector{3e-200, 4e-200, 0.} * isq::velocity[m / s]);
+    std::vector<quantity<m / s>> res(v.size());
+    utility::magnitude(v, std::span{res});
+    REQUIRE_THAT(res[0].numerical_value_in(m / s), WithinULP(5e200, 1));
+    REQUIRE(res[1] == 5. * (m / s));
+    REQUIRE_THAT(res[2].numerical_value_in(m / s), WithinULP(5e-200, 1));
+  }
+
+  SECTION("unit vectors")
+  {
+    velocities v = make_velocities();
+    v.push_back(cartesian_vector{3e200, 0., 4e200} * isq::velocity[m / s]);
+    vector_quantity_soa<one> res;
+    unit_vector(v, res);
+    REQUIRE(res.size() == v.size());
+    for (std::size_t i = 0; i < v.size(); ++i) {
+      const cartesian_vector expected = std::as_const(v)[i].numerical_value_in(m / s).unit();
+      const cartesian_vector actual = std::as_const(res)[i].numerical_value_in(one);
+      for (std::size_t axis = 0; axis < 3; ++axis) REQUIRE_THAT(actual[axis], WithinULP(expected[axis], 2));
+    }
+  }
+
+  SECTION("two dimensions")
+  {
+    vector_quantity_soa<isq::displacement[m], double, 2> d;
+    d.push_back(cartesian_vector{3., 4.} * isq::displacement[m]);
+    std::vector<quantity<m>> len(1);
+    utility::magnitude(d, std::span{len});
+    REQUIRE(len[0] == 5. * m);
+  }
+}
@@ -26,6 +26,14 @@
 #include <mp-units/systems/isq/space_and_time.h>
 #include <mp-units/systems/si.h>
 #include <mp-units/utility/constrained.h>
+#ifdef MP_UNITS_IMPORT_STD
+import std;
+#else
+#include <array>
+#include <cstddef>
+#include <limits>
+#include <span>
+#endif
 
 namespace {
 
@@ -1170,4 +1178,169 @@ static_assert(qp_avg_height(-1500.0 * m, average_height_origin).quantity_from(av
 // Boundary: −1700 m relative = 0 m absolute (natural ground level).
 static_assert(qp_avg_height(-1700.0 * m, average_height_origin).quantity_from(average_height_origin) == -1700.0 * m);
 
+// ============================================================================
+// Batch enforcement over spans
+//
+// Constant evaluation takes the generic paths of the batch kernels; the vectorizable
+// floating-point paths are exercised by the runtime tests.
+// ============================================================================
+
+template<typename T, std::size_t N>
+constexpr bool batch_equal(const std::array<T, N>& lhs, const std::array<T, N>& rhs)
+{
+  for (std::size_t i = 0; i < N; ++i)
+    if (lhs[i] != rhs[i]) return false;
+  return true;
+}
+
+// policies on spans of quantities
+static_assert([] {
+  std::array values = {-100 * deg, -90 * deg, 0 * deg, 90 * deg, 95 * deg};
+  clamp_to_range{-90 * deg, 90 * deg}(std::span{values});
+  return batch_equal(values, std::array{-90 * deg, -90 * deg, 0 * deg, 90 * deg, 90 * deg});
+}());
+static_assert([] {
+  std::array values = {-540 * deg, -190 * deg, -180 * deg, 0 * deg, 180 * deg, 370 * deg, 900 * deg};
+  wrap_to_range{-180 * deg, 180 * deg}(std::span{values});
+  return batch_equal(values,
+                     std::array{-180 * deg, 170 * deg, -180 * deg, 0 * deg, -180 * deg, 10 * deg, -180 * deg});
+}());
+static_assert([] {
+  std::array values = {-270 * deg, -100 * deg, 45 * deg, 91 * deg, 180 * deg, 270 * deg, 450 * deg};
+  reflect_in_range{-90 * deg, 90 * deg}(std::span{values});
+  return batch_equal(values, std::array{90 * deg, -80 * deg, 45 * deg, 89 * deg, 0 * deg, -90 * deg, 90 * deg});
+}());
+static_assert([] {
+  std::array values = {-180.0 * deg, 190.0 * deg, 540.0 * deg};
+  wrap_to_range{-180.0 * deg, 180.0 * deg}(std::span{values});
+  return batch_equal(values, std::array{-180.0 * deg, -170.0 * deg, -180.0 * deg});
+}());
+
+// the checking policy reports the first violating index (or the size when there is none)
+static_assert([] {
+  const std::array values = {0 * deg, 45 * deg, 90 * deg};
+  return check_in_range{-90 * deg, 90 * deg}(std::span{values}) == 3;
+}());
+static_assert([] {
+  const std::array values = {1.0 * m, 0.0 * m, 3.0 * m};
+  return check_non_negative{}(std::span{values}) == 3;
+}());
+
+// raw numerical values together with their reference
+static_assert([] {
+  std::array values = {370, -190, 10};
+  wrap_to_range{-180 * deg, 180 * deg}(std::span{values}, deg);
+  return batch_equal(values, std::array{10, 170, 10});
+}());
+static_assert([] {
+  std::array values = {-2.0, 0.5, 2.0};
+  clamp_to_range{-90.0 * deg, 90.0 * deg}(std::span{values}, rad);
+  return values[0] > -1.5708 && values[0] < -1.5707 && values[1] == 0.5 && values[2] > 1.5707 && values[2] < 1.5708;
+}());
+
+// integral values near the limits of the representation type do not overflow
+static_assert([] {
+  constexpr int max = std::numeric_limits<int>::max();
+  constexpr int min = std::numeric_limits<int>::min();
+  std::array values = {max * deg, min * deg, (max - 1) * deg};
+  wrap_to_range{-180 * deg, 180 * deg}(std::span{values});
+  return batch_equal(values, std::array{127 * deg, -128 * deg, 126 * deg});
+}());
+static_assert([] {
+  std::array values = {std::numeric_limits<int>::max(), std::numeric_limits<int>::min()};
+  reflect_in_range{-90 * deg, 90 * deg}(std::span{values}, deg);
+  return batch_equal(values, std::array{53, -52});
+}());
+
+// enforce_bounds() applies the bounds of a point origin
+static_assert([] {
+  std::array values = {370 * test_angle_wrap[deg], -190 * test_angle_wrap[deg]};
+  enforce_bounds<wrap_origin>(std::span{values});
+  return batch_equal(values, std::array{10 * test_angle_wrap[deg], 170 * test_angle_wrap[deg]});
+}());
+static_assert([] {
+  std::array values = {-100, 0, 100};
+  enforce_bounds<clamp_origin, test_angle_clamp[deg]>(std::span{values});
+  return batch_equal(values, std::array{-90, 0, 90});
+}());
+
+// bounds inherited from an ancestor are applied in the ancestor's frame
+static_assert([] {
+  std::array values = {-50.0 * m, 0.0 * m, 30.0 * m};
+  enforce_bounds<patrol_radius>(std::span{values});
+  return batch_equal(values, std::array{-20.0 * m, 0.0 * m, 20.0 * m});
+}());
+static_assert([] {
+  std::array values = {-1700.0 * m, 0.0 * m, 500.0 * m};
+  return enforce_bounds<average_height_origin>(std::span{values}) == 3 &&
+         batch_equal(values, std::array{-1700.0 * m, 0.0 * m, 500.0 * m});
+}());
+
+
+// ============================================================================
+// deferred_bounds — arithmetic keeps the raw value, readers see it enforced
+// ============================================================================
+
+QUANTITY_SPEC(test_angle_deferred, isq::angular_measure);
+
+inline constexpr struct deferred_wrap_origin final :
+    absolute_point_origin<test_angle_deferred, deferred_bounds{wrap_to_range{-180 * deg, 180 * deg}}> {
+} deferred_wrap_origin;
+
+inline constexpr struct deferred_rel_origin final :
+    relative_point_origin<quantity_point<test_angle_deferred[deg], deferred_wrap_origin, double>{
+      90.0 * deg, deferred_wrap_origin}> {
+} deferred_rel_origin;
+
+using qp_deferred = quantity_point<test_angle_deferred[deg], deferred_wrap_origin, double>;
+using qp_deferred_rel = quantity_point<test_angle_deferred[deg], deferred_rel_origin, double>;
+
+template<PointOrigin auto PO, QuantityPoint QP>
+constexpr Quantity auto raw_value(const QP& qp)
+{
+  return qp.quantity_ref_from(PO);
+}
+
+// the adapter keeps the bounds of the wrapped policy
+static_assert(qp_deferred::min().quantity_from(deferred_wrap_origin) == -180.0 * deg);
+
+// construction stores the value as is; reading it enforces the bounds
+static_assert(raw_value<deferred_wrap_origin>(qp_deferred(200.0 * deg, deferred_wrap_origin)) == 200.0 * deg);
+static_assert(qp_deferred(200.0 * deg, deferred_wrap_origin).quantity_from(deferred_wrap_origin) == -160.0 * deg);
+static_assert(qp_deferred(200.0 * deg, deferred_wrap_origin) == qp_deferred(-160.0 * deg, deferred_wrap_origin));
+static_assert(qp_deferred(170.0 * deg, deferred_wrap_origin) > qp_deferred(190.0 * deg, deferred_wrap_origin));
+static_assert(qp_deferred(190.0 * deg, deferred_wrap_origin) - qp_deferred(0.0 * deg, deferred_wrap_origin) ==
+              -170.0 * deg);
+
+// mutating arithmetic does not enforce either
+static_assert([] {
+  qp_deferred pt(170.0 * deg, deferred_wrap_origin);
+  for (int i = 0; i < 4; ++i) pt += 10.0 * deg;
+  ++pt;
+  return pt.quantity_ref_from(deferred_wrap_origin) == 211.0 * deg &&
+         pt.quantity_from(deferred_wrap_origin) == -149.0 * deg;
+}());
+
+// conversions materialize the value
+static_assert(raw_value<deferred_wrap_origin>(qp_deferred(200.0 * deg, deferred_wrap_origin).in(rad)) < 0.0 * rad);
+static_assert(raw_value<deferred_wrap_origin>(
+                qp_deferred(200.0 * deg, deferred_wrap_origin).point_for(deferred_wrap_origin)) == -160.0 * deg);
+static_assert(raw_value<deferred_wrap_origin>(quantity_point<test_angle_deferred[rad], deferred_wrap_origin, double>(
+                qp_deferred(200.0 * deg, deferred_wrap_origin))) < 0.0 * rad);
+
+// enforce_bounds() materializes a point in place
+static_assert([] {
+  qp_deferred pt(540.0 * deg, deferred_wrap_origin);
+  enforce_bounds(pt);
+  return pt.quantity_ref_from(deferred_wrap_origin) == -180.0 * deg;
+}());
+
+// relative origins defer the bounds inherited from their ancestor
+static_assert(raw_value<deferred_rel_origin>(qp_deferred_rel(100.0 * deg, deferred_rel_origin)) == 100.0 * deg);
+static_assert(qp_deferred_rel(100.0 * deg, deferred_rel_origin).quantity_from(deferred_rel_origin) == -260.0 * deg);
+static_assert(qp_deferred_rel(100.0 * deg, deferred_rel_origin).quantity_from(deferred_wrap_origin) == -170.0 * deg);
+
+// eager origins are unaffected
+static_assert(raw_value<wrap_origin>(qp_wrap(200.0 * deg, wrap_origin)) == -160.0 * deg);
+
 }  // namespace
@@ -26,12 +26,16 @@
 #include <mp-units/systems/isq.h>
 #include <mp-units/systems/si.h>
 #include <mp-units/systems/usc.h>
+#include <mp-units/utility/constrained.h>
+#include <mp-units/utility/safe_int.h>
 #ifdef MP_UNITS_IMPORT_STD
 import std;
 #else
+#include <array>
 #include <concepts>
 #include <cstdint>
 #include <limits>
+#include <span>
 #include <type_traits>
 #include <utility>
 #if MP_UNITS_HOSTED
@@ -1875,6 +1879,9 @@ static_assert(value_cast<quantity_point<isq::height[m]>>(quantity_point{2 * isq:
 static_assert(value_cast<quantity_point<isq::height[km]>>(quantity_point{2000 * isq::height[m]})
                 .quantity_from_origin_is_an_implementation_detail_.numerical_value_in(km) == 2);
 
+// Branches 2-5 below are taken by non-arithmetic representation types; arithmetic ones are converted by
+// the fused affine map tested further down, which yields the same values in these cases. The conversions
+// are repeated with wrapper representation types in `non_arithmetic_rep_tests` to exercise the branches.
 // value_cast which changes only the point origin, same unit (branch 2: no unit scaling, pure origin shift)
 // -- floating-point intermediate (int input, default double output)
 static_assert(value_cast<quantity_point<isq::height[m], mean_sea_level>>(quantity_point{2000 * isq::height[m],
@@ -1923,6 +1930,76 @@ static_assert(value_cast<quantity_point<isq::height[mm], ground_level, std::int1
                 quantity_point{std::int16_t{43} * isq::height[m], mean_sea_level})
                 .quantity_from_origin_is_an_implementation_detail_.numerical_value_in(mm) == 1000);
 
+// the same conversions with non-arithmetic representation types, which still take branches 2-5
+namespace non_arithmetic_rep_tests {
+using utility::safe_int;
+using safe_double = utility::constrained<double, utility::terminate_policy>;
+
+static_assert(!detail::FusableAffinePointConversion<quantity_point<isq::height[m], ground_level, safe_int<int>>,
+                                                    quantity_point<isq::height[m], mean_sea_level, safe_int<int>>>);
+// branch 2
+static_assert(value_cast<quantity_point<isq::height[m], mean_sea_level, safe_int<int>>>(
+                quantity_point{safe_int{2000} * isq::height[m], ground_level})
+                .quantity_from_origin_is_an_implementation_detail_.numerical_value_in(m) == 2042);
+static_assert(value_cast<quantity_point<isq::height[m], ground_level, safe_int<int>>>(
+                quantity_point{safe_int{2042} * isq::height[m], mean_sea_level})
+                .quantity_from_origin_is_an_implementation_detail_.numerical_value_in(m) == 2000);
+static_assert(value_cast<quantity_point<isq::height[m], mean_sea_level, safe_double>>(
+                quantity_point{safe_double{2000.5} * isq::height[m], ground_level})
+                .quantity_from_origin_is_an_implementation_detail_.numerical_value_in(m) == 2042.5);
+// branch 3
+static_assert(value_cast<quantity_point<isq::height[m], mean_sea_level, safe_double>>(
+                quantity_point{safe_double{2.} * isq::height[km], ground_level})
+                .quantity_from_origin_is_an_implementation_detail_.numerical_value_in(m) == 2042);
+static_assert(value_cast<quantity_point<isq::height[km], mean_sea_level, safe_double>>(
+                quantity_point{safe_double{2000.} * isq::height[m], ground_level})
+                .quantity_from_origin_is_an_implementation_detail_.numerical_value_in(km) == 2.042);
+// branch 4
+static_assert(value_cast<quantity_point<isq::height[cm], mean_sea_level, safe_int<int>>>(
+                quantity_point{safe_int<std::int8_t>{std::int8_t{100}} * isq::height[mm], ground_level})
+                .quantity_from_origin_is_an_implementation_detail_.numerical_value_in(cm) == 4210);
+static_assert(value_cast<quantity_point<isq::height[mm], ground_level, safe_int<std::int8_t>>>(
+                quantity_point{safe_int{4210} * isq::height[cm], mean_sea_level})
+                .quantity_from_origin_is_an_implementation_detail_.numerical_value_in(mm) == 100);
+// branch 5
+static_assert(value_cast<quantity_point<isq::height[mm], ground_level, safe_int<std::int16_t>>>(
+                quantity_point{safe_int<std::int16_t>{std::int16_t{43}} * isq::height[m], mean_sea_level})
+                .quantity_from_origin_is_an_implementation_detail_.numerical_value_in(mm) == 1000);
+}  // namespace non_arithmetic_rep_tests
+
+// value_cast with arithmetic representations: the origin offset and the unit scaling fold into one
+// affine map `(x * mul + add) / div`, so the result is rounded once from the exact value
+// -- 40 degF = 4.44 degC: a rounded scaling (22 degC) plus a rounded offset (-17 degC) would give 5 degC
+static_assert(value_cast<quantity_point<deg_C, si::ice_point, int>>(point<deg_F>(40)).quantity_from_zero() ==
+              delta<deg_C>(4));
+static_assert(value_cast<quantity_point<deg_C, si::ice_point, int>>(point<deg_F>(40), rounded).quantity_from_zero() ==
+              delta<deg_C>(4));
+static_assert(value_cast<quantity_point<deg_C, si::ice_point, int>>(point<deg_F>(41), rounded).quantity_from_zero() ==
+              delta<deg_C>(5));
+// -- -300 degC = -26.85 K truncates to -26 K, and not to -300 + 273 = -27 K
+static_assert(value_cast<quantity_point<K, si::absolute_zero, int>>(point<deg_C>(-300)).quantity_from_zero() ==
+              delta<K>(-26));
+static_assert(point<K>(300).in(deg_C, truncated).quantity_from_zero() == delta<deg_C>(26));
+static_assert(point<K>(300).in(deg_C, rounded).quantity_from_zero() == delta<deg_C>(27));
+// -- floating-point chains, such as degF -> degC -> K
+static_assert(point<deg_F>(212.).in(deg_C).quantity_from_zero() == delta<deg_C>(100.));
+static_assert(point<deg_F>(212.).in(deg_C).in(K).quantity_from_zero() == delta<K>(373.15));
+static_assert(point<deg_F>(-459.67).in(K).quantity_from_zero() == delta<K>(0.));
+static_assert(value_cast<quantity_point<isq::height[ft], ground_level, double>>(
+                quantity_point{1.0 * isq::height[m], mean_sea_level})
+                .quantity_from_origin_is_an_implementation_detail_.numerical_value_in(ft) == -41. / 0.3048);
+
+// batch form over spans of points
+constexpr bool batch_value_cast_test()
+{
+  const std::array from{point<deg_F>(32), point<deg_F>(40), point<deg_F>(212)};
+  std::array<quantity_point<deg_C, si::ice_point, int>, 4> to{};
+  value_cast<quantity_point<deg_C, si::ice_point, int>>(std::span{from}, std::span{to}, rounded);
+  return to[0] == point<deg_C>(0) && to[1] == point<deg_C>(4) && to[2] == point<deg_C>(100) &&
+         to[3] == point<deg_C>(0);
+}
+static_assert(batch_value_cast_test());
+
 //////////////////
 // explicit conversion
 //////////////////
@@ -0,0 +1,149 @@
+// The MIT License (MIT)
+//
+// Copyright (c) 2018 Mateusz Pusz
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+
+#include <mp-units/bits/hacks.h>
+#include <mp-units/framework/quantity.h>
+#include <mp-units/framework/representation_concepts.h>
+#include <mp-units/systems/isq.h>
+#include <mp-units/systems/si.h>
+#include <mp-units/utility/ranged_int.h>
+#ifdef MP_UNITS_IMPORT_STD
+import std;
+#else
+#include <concepts>
+#include <cstdint>
+#include <limits>
+#include <type_traits>
+#endif
+
+namespace {
+
+using namespace mp_units;
+using namespace mp_units::utility;
+
+using adc12 = ranged_int<std::uint16_t, 0, 4095>;
+using offset = ranged_int<std::int8_t, -8, 7>;
+
+// ============================================================================
+// Representation
+// ============================================================================
+
+static_assert(RepresentationOf<adc12, quantity_field::real>);
+static_assert(RepresentationOf<offset, quantity_field::real>);
+static_assert(sizeof(adc12) == sizeof(std::uint16_t));
+static_assert(adc12{}.value() == 0);
+static_assert(ranged_int<int, 5, 10>{}.value() == 5);
+static_assert(std::numeric_limits<adc12>::max().value() == 4095);
+static_assert(std::numeric_limits<offset>::lowest().value() == -8);
+
+// ============================================================================
+// Construction
+// ============================================================================
+
+// implicit (and unchecked) when every value of the source fits the range
+static_assert(std::is_convertible_v<std::uint8_t, ranged_int<int, 0, 255>>);
+static_assert(std::is_convertible_v<adc12, ranged_int<std::int32_t, -1, 5000>>);
+// explicit (and checked) otherwise
+static_assert(!std::is_convertible_v<int, adc12>);
+static_assert(std::is_constructible_v<adc12, int>);
+static_assert(!std::is_convertible_v<ranged_int<int, 0, 5000>, adc12>);
+static_assert(std::is_constructible_v<adc12, ranged_int<int, 0, 5000>>);
+static_assert(adc12{4095}.value() == 4095);
+
+// no comparisons with raw integers (the range is the point of the type)
+static_assert(!std::equality_comparable_with<adc12, int>);
+
+// ============================================================================
+// The range of a result is computed at compile time
+// ============================================================================
+
+template<typename R, auto Min, auto Max>
+constexpr bool has_range =
+  R::min_value == static_cast<typename R::value_type>(Min) && R::max_value == static_cast<typename R::value_type>(Max);
+
+static_assert(std::is_same_v<decltype(adc12{} + adc12{}), ranged_int<std::uint16_t, 0, 8190>>);
+static_assert(std::is_same_v<decltype(adc12{} - adc12{}), ranged_int<std::int16_t, -4095, 4095>>);
+static_assert(std::is_same_v<decltype(adc12{} * ranged_c<100>), ranged_int<std::uint32_t, 0, 409'500>>);
+static_assert(std::is_same_v<decltype(adc12{} * adc12{}), ranged_int<std::uint32_t, 0, 16'769'025>>);
+static_assert(std::is_same_v<decltype(adc12{} / ranged_c<16>), ranged_int<std::uint8_t, 0, 255>>);
+static_assert(std::is_same_v<decltype(adc12{} + offset{}), ranged_int<std::int16_t, -8, 4102>>);
+static_assert(std::is_same_v<decltype(-offset{}), ranged_int<std::int8_t, -7, 8>>);
+static_assert(has_range<decltype(offset{} * offset{}), -56, 64>);
+static_assert(std::is_same_v<decltype(adc12{} * offset{}), ranged_int<std::int16_t, -32760, 28665>>);
+static_assert(has_range<decltype(adc12{} / offset{}), -4095, 4095>);
+static_assert(has_range<decltype(ranged_int<int, 10, 20>{} / ranged_int<int, -5, 2>{}), -20, 20>);
+
+// plain integers take part with the range of their type
+static_assert(std::is_same_v<decltype(adc12{} + std::uint8_t{}), ranged_int<std::uint16_t, 0, 4350>>);
+static_assert(has_range<decltype(adc12{} * 3), std::int64_t{-8'793'945'538'560}, std::int64_t{8'793'945'534'465}>);
+
+// results that do not fit in 64 bits are clamped and checked at runtime
+static_assert(has_range<decltype(ranged_int<std::int64_t, 0, std::numeric_limits<std::int64_t>::max()>{} *
+                                 ranged_c<2>),
+                        0, std::numeric_limits<std::int64_t>::max()>);
+
+// values
+static_assert((adc12{4095} * ranged_c<100>).value() == 409'500);
+static_assert((adc12{100} - adc12{4000}).value() == -3900);
+static_assert((offset{-8} / ranged_c<3>).value() == -2);
+static_assert(adc12{10} == ranged_int<int, -5, 10>{10});
+static_assert(offset{7} < adc12{10});
+static_assert(adc12{3} > offset{-3});
+
+constexpr auto compound()
+{
+  ranged_int<int, 0, 100> v{10};
+  v += ranged_c<5>;
+  v *= ranged_c<2>;
+  v -= ranged_c<1>;
+  ++v;
+  --v;
+  v /= ranged_c<3>;
+  return v.value();
+}
+static_assert(compound() == 9);
+
+// common_type spans both ranges
+static_assert(std::is_same_v<std::common_type_t<adc12, offset>, ranged_int<int, -8, 4095>>);
+static_assert(std::is_same_v<std::common_type_t<adc12, ranged_int<std::uint16_t, 10, 5000>>,
+                             ranged_int<std::uint16_t, 0, 5000>>);
+
+// ============================================================================
+// Quantities and unit scaling
+// ============================================================================
+
+static_assert(std::is_same_v<decltype((adc12{} * si::milli<si::volt>).in(si::micro<si::volt>).numerical_value_in(
+                               si::micro<si::volt>)),
+                             ranged_int<std::uint32_t, 0, 4'095'000>>);
+static_assert((adc12{4095} * si::milli<si::volt>).numerical_value_in(si::micro<si::volt>).value() == 4'095'000);
+static_assert(std::is_same_v<
+              decltype((adc12{} * si::milli<si::volt>).in(si::volt, truncated).numerical_value_in(si::volt)),
+              ranged_int<std::uint8_t, 0, 4>>);
+static_assert((adc12{4095} * si::milli<si::volt>).numerical_value_in(si::volt, truncated).value() == 4);
+
+static_assert((adc12{4000} * si::milli<si::volt> + offset{-8} * si::milli<si::volt>).numerical_value_in(
+                si::milli<si::volt>) == ranged_int<int, 3992, 3992>{3992});
+static_assert((adc12{40} * si::milli<si::volt> * (ranged_c<25> * si::milli<si::ampere>))
+                .numerical_value_in(si::milli<si::volt> * si::milli<si::ampere>)
+                .value() == 1000);
+
+}  // namespace
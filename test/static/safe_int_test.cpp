@@ -1144,4 +1144,87 @@ concept lossy_fp_conversion_valid =
 static_assert(lossy_fp_conversion_valid<truncated_t>);
 static_assert(!lossy_fp_conversion_valid<rounded_t>);
 
+// ============================================================================
+// safe_int_poison_policy — overflow yields a sticky poison value
+// ============================================================================
+
+using poison_int = safe_int<int, safe_int_poison_policy>;
+using poison_u8 = safe_int<std::uint8_t, safe_int_poison_policy>;
+using poison_i64 = safe_int<std::int64_t, safe_int_poison_policy>;
+
+static_assert(poison_value<int>() == std::numeric_limits<int>::min());
+static_assert(poison_value<std::int8_t>() == std::numeric_limits<std::int8_t>::min());
+static_assert(poison_value<std::uint8_t>() == std::numeric_limits<std::uint8_t>::max());
+static_assert(poison_value<unsigned long long>() == std::numeric_limits<unsigned long long>::max());
+
+// branch-free overflow detection agrees with the branching one
+static_assert([] {
+  constexpr std::int8_t values[] = {-128, -127, -64, -1, 0, 1, 63, 64, 126, 127};
+  for (std::int8_t a : values)
+    for (std::int8_t b : values) {
+      std::int8_t res{};
+      if (overflowing_arith<arith_op::add>(a, b, res) != add_overflows(a, b)) return false;
+      if (overflowing_arith<arith_op::sub>(a, b, res) != sub_overflows(a, b)) return false;
+      if (overflowing_arith<arith_op::mul>(a, b, res) != mul_overflows(a, b)) return false;
+      if (overflowing_arith<arith_op::div>(a, b, res) != div_overflows(a, b)) return false;
+    }
+  return true;
+}());
+static_assert([] {
+  constexpr std::int64_t max = std::numeric_limits<std::int64_t>::max();
+  constexpr std::int64_t values[] = {-max - 1, -max, -3'037'000'500, -1, 0, 1, 3'037'000'499, 3'037'000'500, max};
+  for (std::int64_t a : values)
+    for (std::int64_t b : values) {
+      std::int64_t res{};
+      if (overflowing_arith<arith_op::mul>(a, b, res) != mul_overflows(a, b)) return false;
+    }
+  return true;
+}());
+
+// regular values are unaffected
+static_assert(poison_int{2} + poison_int{3} == 5);
+static_assert(poison_int{7} % poison_int{4} == 3);
+static_assert(!(poison_int{2} * poison_int{3}).is_poisoned());
+
+// overflow and division by zero poison the result instead of reporting
+static_assert((poison_int{std::numeric_limits<int>::max()} + poison_int{1}).is_poisoned());
+static_assert((poison_int{std::numeric_limits<int>::min() + 1} - poison_int{2}).is_poisoned());
+static_assert((poison_int{1 << 20} * poison_int{1 << 20}).is_poisoned());
+static_assert((poison_int{1} / poison_int{0}).is_poisoned());
+static_assert((poison_int{1} % poison_int{0}).is_poisoned());
+static_assert((poison_i64{std::numeric_limits<std::int64_t>::max()} * 2).is_poisoned());
+static_assert((-poison_int{std::numeric_limits<int>::min()}).is_poisoned());
+static_assert(poison_int{std::numeric_limits<int>::min() + 1} % poison_int{-1} == 0);
+static_assert([] {
+  poison_u8 v{255};
+  ++v;
+  return v.is_poisoned();
+}());
+
+// the poison is sticky across further operations and conversions
+static_assert([] {
+  poison_int v{std::numeric_limits<int>::max()};
+  v += poison_int{1};
+  v -= poison_int{1000};
+  v /= poison_int{2};
+  return v.is_poisoned();
+}());
+static_assert((poison_i64{poison_int{std::numeric_limits<int>::max()} + poison_int{1}}).is_poisoned());
+static_assert(poison_int{poison_i64{std::numeric_limits<std::int64_t>::max()}}.is_poisoned());
+static_assert(poison_int{std::int64_t{1} << 40}.is_poisoned());
+
+// quantities propagate the poison through unit scaling
+static_assert(
+  (quantity<si::metre, poison_int>{poison_int{3'000'000}, si::metre}.in(si::milli<si::metre>)).numerical_value_in(
+    si::milli<si::metre>).is_poisoned());
+static_assert(!(quantity<si::metre, poison_int>{poison_int{3}, si::metre}.in(si::milli<si::metre>))
+                 .numerical_value_in(si::milli<si::metre>)
+                 .is_poisoned());
+
+// `is_poisoned()` is only offered by a poisoning policy
+template<typename T>
+concept has_is_poisoned = requires(T v) { v.is_poisoned(); };
+static_assert(has_is_poisoned<poison_int>);
+static_assert(!has_is_poisoned<safe_int<int, safe_int_terminate_policy>>);
+
 }  // namespace